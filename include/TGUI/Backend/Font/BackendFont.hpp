@@ -33,6 +33,8 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cstdint>
+    #include <unordered_map>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -46,6 +48,18 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Information about the usage of a texture page in which glyphs are stored
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct TexturePageStatistics
+        {
+            Vector2u size;               //!< Size of the texture page
+            std::size_t glyphCount = 0;  //!< Amount of glyphs that are stored in the page
+            std::size_t usedPixels = 0;  //!< Amount of pixels occupied by glyphs (including their padding)
+            std::size_t memoryUsage = 0; //!< Amount of bytes used on the CPU side to store the pixels of the page
+            float fillRatio = 0;         //!< Ratio between the used pixels and the total amount of pixels in the page
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -246,6 +260,73 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD virtual Vector2u getTextureSize(unsigned int characterSize) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of textures that are used to store glyphs of the given character size
+        ///
+        /// @param characterSize  Size of the characters that should be part of the textures
+        ///
+        /// Glyphs are stored in multiple texture pages when they no longer fit in a single texture.
+        /// The default implementation returns 1, for fonts that only use a single texture.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual unsigned int getTexturePageCount(unsigned int characterSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns one of the textures that is used to store glyphs of the given character size
+        ///
+        /// @param characterSize  Size of the characters that should be part of the texture
+        /// @param pageIndex      Index of the texture page, as returned in the texturePage member of FontGlyph
+        ///
+        /// @return Texture to render text glyphs with, or nullptr if the page doesn't exist
+        ///
+        /// Page 0 is the texture returned by getTexture. All pages are updated when getTexture is called, so getTexture
+        /// has to be called first to check whether the textures have changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual std::shared_ptr<BackendTexture> getTexturePage(unsigned int characterSize, unsigned int pageIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of one of the textures that is used to store glyphs of the given character size
+        ///
+        /// @param characterSize  Size of the characters that should be part of the texture
+        /// @param pageIndex      Index of the texture page, as returned in the texturePage member of FontGlyph
+        ///
+        /// @return Size of the texture page that holds the glyphs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual Vector2u getTexturePageSize(unsigned int characterSize, unsigned int pageIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about how the texture pages of the font are being used
+        ///
+        /// @return Information about each texture page, or an empty list if the font doesn't provide this information
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual std::vector<TexturePageStatistics> getTexturePageStatistics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum size of a texture page
+        ///
+        /// @param size  Maximum width and height of each texture that stores glyphs
+        ///
+        /// This setting is only used by fonts that can store glyphs in multiple texture pages.
+        /// The first texture page starts small and grows until it reaches this size. Once a page is full, glyphs are placed
+        /// in new pages that are created with this size. The size is also limited by the maximum texture size of the renderer.
+        /// The default maximum size is 1024. Changing the size only affects pages that are created afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setMaximumTexturePageSize(unsigned int size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum size of a texture page
+        ///
+        /// @return Maximum width and height of each texture that stores glyphs
+        ///
+        /// @see setMaximumTexturePageSize
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getMaximumTexturePageSize() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Enable or disable the smooth filter
         ///
@@ -304,11 +385,48 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD std::uint64_t constructGlyphKey(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness);
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a key for each unique pair of characters for which the kerning is cached
+        ///
+        /// @param first         Unicode code point of the first character
+        /// @param second        Unicode code point of the second character
+        /// @param characterSize Size of the characters
+        /// @param bold          Are the glyphs bold or regular?
+        ///
+        /// @return Id that is specific to the provided parameters
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::uint64_t constructKerningKey(char32_t first, char32_t second, unsigned int characterSize, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Looks up the kerning of a pair of characters that was cached earlier
+        ///
+        /// @param key      Key returned by constructKerningKey
+        /// @param kerning  Kerning value that was cached, only changed when the function returns true
+        ///
+        /// @return True if the kerning was cached, false if it still has to be calculated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool findCachedKerning(std::uint64_t key, float& kerning) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stores the kerning of a pair of characters, so that it doesn't need to be calculated again
+        ///
+        /// @param key      Key returned by constructKerningKey
+        /// @param kerning  Kerning value to store
+        ///
+        /// The cache is cleared when the font scale changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void cacheKerning(std::uint64_t key, float kerning);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         bool m_isSmooth = true;
         float m_fontScale = 1;
+        unsigned int m_maxTexturePageSize = 1024;
+        std::unordered_map<std::uint64_t, float> m_cachedKerning; // Kerning between pairs of characters, per character size
     };
 }
 
@@ -202,6 +202,46 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD Vector2u getTextureSize(unsigned int characterSize) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of textures that are used to store glyphs
+        ///
+        /// @param characterSize  Size of the characters that should be part of the textures
+        ///
+        /// A new texture page is created when a glyph no longer fits in any of the existing pages.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getTexturePageCount(unsigned int characterSize) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns one of the textures that is used to store glyphs
+        ///
+        /// @param characterSize  Size of the characters that should be part of the texture
+        /// @param pageIndex      Index of the texture page, as returned in the texturePage member of FontGlyph
+        ///
+        /// @return Texture to render text glyphs with, or nullptr if the page doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::shared_ptr<BackendTexture> getTexturePage(unsigned int characterSize, unsigned int pageIndex) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of one of the textures that is used to store glyphs
+        ///
+        /// @param characterSize  Size of the characters that should be part of the texture
+        /// @param pageIndex      Index of the texture page, as returned in the texturePage member of FontGlyph
+        ///
+        /// @return Size of the texture page that holds the glyphs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Vector2u getTexturePageSize(unsigned int characterSize, unsigned int pageIndex) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about how the texture pages of the font are being used
+        ///
+        /// @return Information about each texture page
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::vector<TexturePageStatistics> getTexturePageStatistics() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Enable or disable the smooth filter
         ///
@@ -234,6 +274,7 @@ TGUI_MODULE_EXPORT namespace tgui
             float     rsbDelta = 0;  //!< Right offset after forced autohint. Internally used by getKerning()
             FloatRect bounds;        //!< Bounding rectangle of the glyph, in coordinates relative to the baseline
             UIntRect  textureRect;   //!< Texture coordinates of the glyph inside the font's texture
+            unsigned int texturePage = 0; //!< Index of the texture page that contains the glyph
         };
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -247,9 +288,41 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD Glyph getInternalGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Reserves space in the texture to place the glyph
+        // Returns the index of a character in the font face, the index is cached to avoid searching for it again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getGlyphIndex(char32_t codePoint);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the kerning of two characters when it wasn't cached yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float calculateKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reserves space in one of the texture pages to place the glyph.
+        // An empty rect is returned if the glyph is too large for the maximum texture size.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD UIntRect findAvailableGlyphRect(unsigned int width, unsigned int height, unsigned int& pageIndex);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates an empty texture page of the given size
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD UIntRect findAvailableGlyphRect(unsigned int width, unsigned int height);
+        void addTexturePage(unsigned int size);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Doubles the size of a texture page, the existing pixels are kept in the top left quadrant
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void growTexturePage(unsigned int pageIndex);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks part of a texture page as changed, so that only that part needs to be copied to the texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addDirtyRect(unsigned int pageIndex, const UIntRect& rect);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Uploads the pixels of the texture pages that were changed since the last time their texture was updated.
+        // Only the changed parts are uploaded unless the page was resized or the texture doesn't support partial updates.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTexturePages();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Sets the character size on which the freetype operations are performed
@@ -273,6 +346,19 @@ TGUI_MODULE_EXPORT namespace tgui
             unsigned int height; //!< Height of the row
         };
 
+        struct TexturePage
+        {
+            std::unique_ptr<std::uint8_t[]> pixels;      //!< Alpha value of each pixel, the color of the glyphs is always white
+            std::shared_ptr<BackendTexture> texture;     //!< Texture that contains the pixels once they have been uploaded
+            bool                  needsUpload = true;    //!< Does the entire texture need to be (re)loaded?
+            std::vector<UIntRect> dirtyRects;            //!< Parts of the texture that changed since the last upload
+            std::vector<Row>      rows;                  //!< Rows in which glyphs are placed
+            unsigned int          size = 0;              //!< Width and height of the page
+            unsigned int          nextRow = 0;           //!< Y position of the next new row in the page
+            std::size_t           glyphCount = 0;        //!< Amount of glyphs in the page
+            std::size_t           usedPixels = 0;        //!< Amount of pixels occupied by glyphs (including padding)
+        };
+
         FT_Library  m_library = nullptr;  // Handle to the freetype library
         FT_Face     m_face    = nullptr;  // Contains the font (typeface and style)
         FT_Stroker  m_stroker = nullptr;  // Used for rendering outlines
@@ -283,13 +369,10 @@ TGUI_MODULE_EXPORT namespace tgui
         std::unordered_map<unsigned int, float> m_cachedDescents;
 
         std::unordered_map<std::uint64_t, Glyph> m_glyphs;
-        unsigned int     m_nextRow = 3; //!< Y position of the next new row in the texture (first 2 rows contain pixels for underlining)
-        std::vector<Row> m_rows;
+        std::unordered_map<char32_t, unsigned int> m_glyphIndices;
+        std::vector<TexturePage> m_pages; //!< Textures in which the glyphs are stored (first 2 rows of first page contain pixels for underlining)
 
         std::unique_ptr<std::uint8_t[]> m_fileContents;
-        std::unique_ptr<std::uint8_t[]> m_pixels;
-        std::shared_ptr<BackendTexture> m_texture;
-        unsigned int m_textureSize = 0;
         unsigned int m_textureVersion = 0;
     };
 
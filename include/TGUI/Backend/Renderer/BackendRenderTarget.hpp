@@ -48,6 +48,64 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Counters that are collected while drawing a frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct FrameStatistics
+        {
+            std::size_t drawCalls = 0;        //!< Amount of draw calls that were passed to the underlying graphics library
+            std::size_t mergedDrawCalls = 0;  //!< Amount of drawVertexArray calls that were merged into another draw call
+            std::size_t uploadedVertices = 0; //!< Amount of vertices that were passed to the underlying graphics library
+            std::size_t cachedWidgets = 0;    //!< Amount of widgets that were drawn by repeating their recorded draw calls
+            std::size_t redrawnPixels = 0;    //!< Amount of pixels that were redrawn (only counted when partial redraw is supported)
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Draw calls that were recorded while drawing a widget, so that they can be repeated while the widget doesn't change
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct RenderCache
+        {
+            enum class CommandType
+            {
+                DrawVertices,
+                AddClippingLayer,
+                RemoveClippingLayer
+            };
+
+            struct Command
+            {
+                CommandType type = CommandType::DrawVertices;
+                Transform transform;
+                FloatRect clipRect;
+                std::size_t firstVertex = 0;
+                std::size_t vertexCount = 0;
+                std::size_t firstIndex = 0;
+                std::size_t indexCount = 0;
+                std::shared_ptr<BackendTexture> texture;
+            };
+
+            // Texture coordinates of recorded texts are only valid while the font texture doesn't change
+            struct FontTexture
+            {
+                std::shared_ptr<BackendFont> font;
+                unsigned int characterSize = 0;
+                unsigned int textureVersion = 0;
+            };
+
+            bool valid = false;
+            Transform transform;
+            FloatRect clipRect;
+            std::vector<Command> commands;
+            std::vector<Vertex> vertices;
+            std::vector<unsigned int> indices;
+            std::vector<FontTexture> fontTextures;
+            bool containsSvgSprites = false;    // SVG sprites can receive a new texture without their widget knowing
+            unsigned int svgTextureVersion = 0;
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Virtual destructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,6 +148,9 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /// @param states  Render states to use for drawing
         /// @param widget  The widget to draw
+        ///
+        /// If the widget has render caching enabled and didn't change since the previous time it was drawn at the same location,
+        /// then the recorded draw calls are repeated instead of calling the draw function of the widget.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void drawWidget(const RenderStates& states, const std::shared_ptr<Widget>& widget);
 
@@ -207,9 +268,163 @@ TGUI_MODULE_EXPORT namespace tgui
                                      const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether consecutive draw calls should be merged into a single draw call where possible
+        ///
+        /// @param enabled  Should vertices be batched?
+        ///
+        /// When batching is enabled, the vertices are transformed on the CPU and collected in a buffer that is reused between frames.
+        /// Consecutive calls to drawVertexArray that use the same texture and clipping are drawn together with a single draw call.
+        /// The batch is flushed when the texture changes, when a clipping layer is added or removed and at the end of the frame.
+        ///
+        /// Batching is disabled by default. Render targets that don't call batchVertexArray in their drawVertexArray function
+        /// ignore this setting.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBatchingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether consecutive draw calls are merged into a single draw call where possible
+        ///
+        /// @return Is batching enabled?
+        ///
+        /// @see setBatchingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isBatchingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the render target can keep the contents of the previous frame and only redraw parts of it
+        ///
+        /// @return True if setRedrawAreas is supported, false if the entire gui is always drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual bool isPartialRedrawSupported() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Limits the next call to drawGui to only redraw the given areas, keeping the rest of the previous frame
+        ///
+        /// @param areas  Areas in view coordinates that have to be redrawn
+        ///
+        /// This function is called by the gui when partial redraw is enabled. It is ignored by render targets that don't
+        /// support partial redraw.
+        ///
+        /// @see BackendGui::setPartialRedrawEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRedrawAreas(std::vector<FloatRect> areas);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Makes the next call to drawGui draw the entire gui again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetRedrawAreas();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Invalidates the widgets that drew an SVG image while it was still being rasterized in the background
+        ///
+        /// This function is called by the gui when SVG sprites received a new texture, so that the area of these widgets is
+        /// redrawn. Widgets whose images are still being rasterized will be remembered again when they are drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateWidgetsWithPendingSvgSprites();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets whether the areas that were redrawn should be highlighted, for debugging partial redraw
+        ///
+        /// @param enabled  Should a translucent rectangle be drawn on top of each area that was redrawn?
+        ///
+        /// @see BackendGui::setPartialRedrawEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRedrawAreasOverlayEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the areas that were redrawn are highlighted
+        ///
+        /// @return Is the debug overlay enabled?
+        ///
+        /// @see setRedrawAreasOverlayEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isRedrawAreasOverlayEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the counters that were collected while drawing the last frame
+        ///
+        /// @return Statistics about the draw calls of the last completed frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD FrameStatistics getFrameStatistics() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resets the frame statistics. Should be called from drawGui before the widgets are drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginFrame();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the pending batch and stores the frame statistics. Should be called from drawGui after the widgets are drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endFrame();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds vertices to the current batch, to be called at the start of drawVertexArray
+        ///
+        /// @param states       Render states to use for drawing
+        /// @param vertices     Pointer to first element in array of vertices
+        /// @param vertexCount  Amount of elements in the vertex array
+        /// @param indices      Pointer to first element in array of indices
+        /// @param indexCount   Amount of elements in the indices array
+        /// @param texture      Texture to use, or nullptr when drawing colored triangles
+        ///
+        /// @return True if the vertices were added to the batch, false if drawVertexArray should draw them immediately
+        ///
+        /// The vertices in the batch are drawn by calling drawVertexArray with default render states when the batch is flushed.
+        /// This function also records the draw call for widgets that have render caching enabled, so render targets that don't
+        /// call it can't draw widgets from their cache.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool batchVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
+                              const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the vertices that were collected in the current batch
+        ///
+        /// This has to be called before changing any state that affects how the vertices are drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushBatch();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Transforms vertices on the CPU, for render targets that can't pass the transform to the GPU
+        ///
+        /// @param transform    Transform to apply to the positions of the vertices
+        /// @param vertices     Pointer to first element in array of vertices
+        /// @param vertexCount  Amount of elements in the vertex array
+        ///
+        /// @return Pointer to the transformed vertices, which remains valid until the next call to this function
+        ///
+        /// The vertices are written to a buffer that is reused for every draw call, so no memory is allocated while drawing.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const Vertex* transformVertices(const Transform& transform, const Vertex* vertices, std::size_t vertexCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Highlights the areas that were redrawn, to be called at the end of drawGui when the overlay is enabled
+        ///
+        /// @param areas  Areas that were redrawn, in view coordinates
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawRedrawAreasOverlay(const std::vector<FloatRect>& areas);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Called from addClippingLayer and removeClippingLayer to apply the clipping
         ///
@@ -230,6 +445,28 @@ TGUI_MODULE_EXPORT namespace tgui
 
         std::vector<std::pair<FloatRect, FloatRect>> m_clipLayers;
         Vector2f m_pixelsPerPoint = {1, 1};
+
+        bool m_batchingEnabled = false;
+        bool m_flushingBatch = false;
+        std::vector<Vertex> m_batchVertices;
+        std::vector<unsigned int> m_batchIndices;
+        std::shared_ptr<BackendTexture> m_batchTexture;
+
+        std::vector<Vertex> m_transformedVertices; // Scratch buffer that is reused by transformVertices
+
+        FrameStatistics m_frameStatistics;
+        FrameStatistics m_lastFrameStatistics;
+
+        // Caches of the widgets that are currently being drawn with render caching enabled, they record every draw call
+        std::vector<RenderCache*> m_recordingCaches;
+
+        // Widget that is currently being drawn and the widgets that drew SVG images that were still being rasterized
+        Widget* m_drawnWidget = nullptr;
+        std::vector<std::weak_ptr<Widget>> m_widgetsWithPendingSvgSprites;
+
+        // Areas that have to be redrawn in the next frame, or an empty object when the entire gui has to be drawn
+        Optional<std::vector<FloatRect>> m_redrawAreas;
+        bool m_redrawAreasOverlayEnabled = false;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
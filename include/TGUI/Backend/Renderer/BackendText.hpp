@@ -160,6 +160,9 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the top-left position of the character at the provided index
         /// @param index  Index of the character for which the position should be returned
+        ///
+        /// The positions of all characters are calculated and cached the first time this function is called after the text
+        /// was changed, so finding the position of other characters afterwards doesn't require iterating over the string.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual Vector2f findCharacterPos(std::size_t index) const;
 
@@ -180,6 +183,18 @@ TGUI_MODULE_EXPORT namespace tgui
         void updateVertices();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the positions of all characters, which are returned by findCharacterPos
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateCharacterPositions() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Helper function used by updateVertices to get the vertices of glyphs that are stored in a certain font texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::vector<Vertex>& getPageVertices(std::vector<std::shared_ptr<std::vector<Vertex>>>& verticesPerPage, unsigned int pageIndex);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Helper function used by updateVertices to add vertices for a glyph
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -208,9 +223,13 @@ TGUI_MODULE_EXPORT namespace tgui
         TextStyles m_style = TextStyle::Regular;
 
         Vector2f m_size;
-        std::shared_ptr<std::vector<Vertex>> m_vertices;
-        std::shared_ptr<std::vector<Vertex>> m_outlineVertices;
+        std::vector<std::shared_ptr<std::vector<Vertex>>> m_vertices; // Vertices for each font texture page
+        std::vector<std::shared_ptr<std::vector<Vertex>>> m_outlineVertices;
         bool m_verticesNeedUpdate = true;
+
+        mutable std::vector<Vector2f> m_characterPositions; // Top-left position of each character, plus the end of the string
+        mutable float m_characterPositionsFontScale = 0;
+        mutable bool m_characterPositionsNeedUpdate = true;
     };
 }
 
@@ -31,6 +31,7 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <memory>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -44,6 +45,17 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Decides what is kept in CPU memory from the pixels that are passed to the load function
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class PixelStorage
+        {
+            Full,      //!< Keep all RGBA pixels (4 bytes per pixel), so that both getPixels and isTransparentPixel work
+            AlphaMask, //!< Only keep 1 bit per pixel that tells whether it is transparent, getPixels will return nullptr
+            None       //!< Don't keep anything, isTransparentPixel will always return false and getPixels will return nullptr
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Virtual destructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -56,6 +68,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param size   Width and height of the image to create
         /// @param pixels Moved pointer to array of size.x*size.y*4 bytes with RGBA pixels, or nullptr to create an empty texture
         /// @param smooth Should the smooth filter be enabled or not?
+        ///
+        /// Which part of the pixels is kept in CPU memory after the texture is created depends on getPixelStorage().
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels, bool smooth);
 
@@ -72,6 +86,50 @@ TGUI_MODULE_EXPORT namespace tgui
         virtual bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the texture from an array of 8-bit alpha values, where the color of every pixel is white
+        ///
+        /// @param size        Width and height of the image to create
+        /// @param alphaPixels Pointer to array of size.x*size.y bytes with alpha values, or nullptr to create an empty texture
+        /// @param smooth      Should the smooth filter be enabled or not?
+        ///
+        /// Backends that can sample from a single-channel texture only store one byte per pixel. The default implementation
+        /// converts the alpha values to RGBA pixels and passes them to loadTextureOnly.
+        ///
+        /// @warning Like loadTextureOnly, this function won't store the pixels and isTransparentPixel thus won't work
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool loadAlphaTextureOnly(Vector2u size, const std::uint8_t* alphaPixels, bool smooth);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the pixels inside a part of the texture
+        ///
+        /// @param region  Part of the texture that should be changed, it has to lie inside the texture
+        /// @param pixels  Pointer to array of region.width*region.height*4 bytes with RGBA pixels
+        ///
+        /// @return True if the texture was updated, false if the backend doesn't support partial updates of the texture.
+        ///         The texture has to be loaded again with the full image when false is returned.
+        ///
+        /// If the pixels were stored by the load function, then the stored pixels will also be updated.
+        /// The default implementation only updates the stored pixels and returns false.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool updateTextureRegion(UIntRect region, const std::uint8_t* pixels);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the pixels inside a part of a texture that was loaded with loadAlphaTextureOnly
+        ///
+        /// @param region      Part of the texture that should be changed, it has to lie inside the texture
+        /// @param alphaPixels Pointer to array of region.width*region.height bytes with alpha values
+        ///
+        /// @return True if the texture was updated, false if the backend doesn't support partial updates of the texture.
+        ///         The texture has to be loaded again with the full image when false is returned.
+        ///
+        /// The default implementation converts the alpha values to RGBA pixels and passes them to updateTextureRegion.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool updateAlphaTextureRegion(UIntRect region, const std::uint8_t* alphaPixels);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size of the entire image
         /// @return Texture size
@@ -100,7 +158,7 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /// @param pixel  Coordinate of the pixel
         ///
-        /// @return True when the pixel is transparent, false when it is not
+        /// @return True when the pixel is transparent, false when it is not or when neither the pixels nor the alpha mask are stored
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD bool isTransparentPixel(Vector2u pixel) const;
 
@@ -113,12 +171,79 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD const std::uint8_t* getPixels() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes what is kept in CPU memory from the pixels of this texture
+        ///
+        /// @param storage  What should be kept from the pixels that are passed to the load function
+        ///
+        /// The new value is used the next time the load function is called. If the texture is already loaded then the pixels
+        /// that are kept in memory are reduced immediately, e.g. switching from Full to AlphaMask frees the RGBA pixels.
+        /// Switching to a storage that keeps more information only takes effect when the texture is loaded again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPixelStorage(PixelStorage storage);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns what is kept in CPU memory from the pixels of this texture
+        ///
+        /// @return What is kept from the pixels that are passed to the load function
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD PixelStorage getPixelStorage() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of CPU memory used to store the pixels or alpha mask of this texture
+        ///
+        /// @return Bytes that are used in CPU memory, which doesn't include the memory used by the texture on the GPU
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getPixelMemoryUsage() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much CPU memory is saved by not keeping a full copy of the pixels that were passed to load
+        ///
+        /// @return Bytes that would have been used when the pixel storage was Full, minus the bytes that are used now
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getPixelMemorySaved() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes what is kept in CPU memory from the pixels of textures that are created afterwards
+        ///
+        /// @param storage  What should be kept from the pixels that are passed to the load function
+        ///
+        /// By default the full RGBA pixels are kept. Storing only the alpha mask reduces the CPU memory used by images to
+        /// 1/32 of their size while transparent pixels can still be ignored by mouse events. Textures that were loaded from
+        /// memory can however no longer be saved to a widget file when their RGBA pixels aren't kept.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setDefaultPixelStorage(PixelStorage storage);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns what is kept in CPU memory from the pixels of textures that are created
+        ///
+        /// @return What is kept by default from the pixels that are passed to the load function
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static PixelStorage getDefaultPixelStorage();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Builds the mask that contains 1 bit per pixel that is set when the pixel is fully transparent
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void buildAlphaMask(const std::uint8_t* pixels);
+
+
         Vector2u m_imageSize;
         std::unique_ptr<std::uint8_t[]> m_pixels;
+        std::vector<std::uint8_t> m_alphaMask;
         bool m_isSmooth = true;
+        bool m_loadedWithPixels = false; // Were the pixels passed to the load function instead of to loadTextureOnly?
+        PixelStorage m_pixelStorage = getDefaultPixelStorage();
+
+        static PixelStorage m_defaultPixelStorage;
     };
 }
 
@@ -62,6 +62,41 @@ TGUI_MODULE_EXPORT namespace tgui
         bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the texture from an array of 8-bit alpha values, where the color of every pixel is white
+        ///
+        /// @param size        Width and height of the image to create
+        /// @param alphaPixels Pointer to array of size.x*size.y bytes with alpha values, or nullptr to create an empty texture
+        /// @param smooth      Should the smooth filter be enabled or not?
+        ///
+        /// The texture is stored with a single channel and a swizzle mask is used to sample it as white pixels.
+        /// When OpenGL ES 3.0 isn't available, the pixels are converted to RGBA instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadAlphaTextureOnly(Vector2u size, const std::uint8_t* alphaPixels, bool smooth) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the pixels inside a part of the texture
+        ///
+        /// @param region  Part of the texture that should be changed, it has to lie inside the texture
+        /// @param pixels  Pointer to array of region.width*region.height*4 bytes with RGBA pixels
+        ///
+        /// @return True if the texture was updated, false if the texture was loaded with loadAlphaTextureOnly
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTextureRegion(UIntRect region, const std::uint8_t* pixels) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the pixels inside a part of a texture that was loaded with loadAlphaTextureOnly
+        ///
+        /// @param region      Part of the texture that should be changed, it has to lie inside the texture
+        /// @param alphaPixels Pointer to array of region.width*region.height bytes with alpha values
+        ///
+        /// @return True if the texture was updated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateAlphaTextureRegion(UIntRect region, const std::uint8_t* alphaPixels) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes whether the smooth filter is enabled or not
         ///
@@ -77,10 +112,25 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD unsigned int getInternalTexture() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Helper function that is used by both loadTextureOnly and loadAlphaTextureOnly
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadTextureWithFormat(Vector2u size, const std::uint8_t* pixels, bool smooth, bool alphaOnly);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Helper function that is used by both updateTextureRegion and updateAlphaTextureRegion
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateRegionWithFormat(UIntRect region, const std::uint8_t* pixels, bool alphaOnly);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         unsigned int m_textureId = 0;
+        bool m_alphaOnly = false;
     };
 }
 
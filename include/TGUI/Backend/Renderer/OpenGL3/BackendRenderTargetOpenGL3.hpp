@@ -104,6 +104,14 @@ TGUI_MODULE_EXPORT namespace tgui
                              const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the render target can keep the contents of the previous frame and only redraw parts of it
+        ///
+        /// @return True unless creating the offscreen framebuffer, to which the gui is drawn before copying it to the window, failed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isPartialRedrawSupported() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -125,6 +133,13 @@ TGUI_MODULE_EXPORT namespace tgui
         void createBuffers();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates or resizes the framebuffer that keeps the contents of the previous frame for partial redraw.
+        // Returns false if the framebuffer can't be used.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateRetainedFramebuffer();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -140,6 +155,15 @@ TGUI_MODULE_EXPORT namespace tgui
 
         Transform m_projectionTransform;
         int m_projectionMatrixShaderUniformLocation = 0;
+
+        // Offscreen framebuffer in which the gui is drawn when only parts of the screen are redrawn
+        unsigned int m_retainedFramebuffer = 0;
+        unsigned int m_retainedFramebufferTexture = 0;
+        Vector2u m_retainedFramebufferSize;
+        bool m_retainedFramebufferValid = false;
+        bool m_retainedFramebufferSupported = true;
+        FloatRect m_retainedFramebufferView;
+        FloatRect m_retainedFramebufferViewport;
     };
 }
 
@@ -364,6 +364,26 @@ TGUI_MODULE_EXPORT namespace tgui
         void unregisterSvgSprite(Sprite* sprite);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Gives the SVG sprites that were waiting on a background rasterization the texture that they requested
+        ///
+        /// This function gets called internally by the gui each frame.
+        ///
+        /// @return True when the texture of at least one sprite was changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updatePendingSvgSprites();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns a number that is increased each time SVG sprites receive a new texture without their widget knowing
+        ///
+        /// This happens when a background rasterization finishes or when the font scale changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getSvgTextureVersion() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -377,6 +397,7 @@ TGUI_MODULE_EXPORT namespace tgui
         std::set<BackendGui*> m_guis;
         std::set<BackendFont*> m_registeredFonts;
         std::set<Sprite*> m_registeredSvgSprites;
+        unsigned int m_svgTextureVersion = 1;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
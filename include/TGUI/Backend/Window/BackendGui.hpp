@@ -33,8 +33,12 @@
 #include <TGUI/TwoFingerScrollDetect.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <condition_variable>
+    #include <functional>
     #include <chrono>
+    #include <mutex>
     #include <stack>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -48,6 +52,23 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /// Counters that show how often the main loop wakes up while idle and how fast it responds to input
+        struct MainLoopStatistics
+        {
+            std::size_t wakeUps = 0; //!< Number of times that the main loop stopped waiting for events, timers or posted tasks
+            std::size_t framesPresented = 0; //!< Number of frames that the main loop has drawn to the screen
+            std::size_t postedTasksExecuted = 0; //!< Number of functions passed to post() that have been executed
+            Duration lastInputLatency; //!< Time between handling an event and presenting the frame that shows its result
+            Duration maxInputLatency; //!< Highest input latency since the statistics were last reset
+        };
+
+        /// Counters that show how many events were merged by event coalescing
+        struct EventStatistics
+        {
+            std::size_t eventsReceived = 0; //!< Number of events that were passed to handleEvent
+            std::size_t eventsDispatched = 0; //!< Number of events that were actually sent to the widgets
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -153,10 +174,74 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /// @return Has the event been consumed?
         ///         When this function returns false, then the event was ignored by all widgets.
+        ///         When event coalescing is enabled, mouse move and wheel events are held back and false is returned for them.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool handleEvent(Event event);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether consecutive mouse move and mouse wheel events are merged before they are sent to the widgets
+        ///
+        /// @param enabled  Should consecutive mouse move and wheel events be merged?
+        ///
+        /// High-rate mice and touchpads may generate many more mouse move events than frames that are drawn, and each event
+        /// searches the widget below the mouse. When coalescing is enabled, a mouse move or wheel event isn't handled
+        /// immediately. Consecutive mouse moves are replaced by the last one, and consecutive wheel events at the same position
+        /// are added together. The held back event is handled before the next event of a different type (so that e.g. a mouse
+        /// press still happens at the correct position), when updateTime() is called and when the gui is drawn.
+        ///
+        /// Widgets that need every intermediate mouse position, such as a canvas on which the user draws, can still get them
+        /// by calling getCoalescedMousePositions() while handling the mouse move.
+        ///
+        /// Coalescing is disabled by default. Disabling it handles the event that is being held back.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setEventCoalescingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether consecutive mouse move and mouse wheel events are merged before they are sent to the widgets
+        ///
+        /// @return Is event coalescing enabled?
+        ///
+        /// @see setEventCoalescingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isEventCoalescingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sends the mouse move or wheel event that was held back by event coalescing to the widgets
+        ///
+        /// @return Has the event been consumed? False is also returned when there was no event that was being held back.
+        ///
+        /// You only need to call this function yourself if you need the widgets to be updated before calling updateTime or draw.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool handlePendingEvents();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the positions of all mouse move events that were merged into the mouse move that is being handled
+        ///
+        /// @return Mouse positions in gui coordinates, in the order in which they arrived. The last one is the current position.
+        ///
+        /// When event coalescing is disabled, this only contains the position of the last mouse move event.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const std::vector<Vector2f>& getCoalescedMousePositions() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of events that were passed to handleEvent and that were actually sent to the widgets
+        ///
+        /// @return Event counters
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD EventStatistics getEventStatistics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resets the counters returned by getEventStatistics to 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetEventStatistics();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief When the tab key usage is enabled, pressing tab will focus another widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -169,6 +254,52 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD bool isTabKeyUsageEnabled() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets whether only the parts of the screen that changed since the previous frame should be redrawn
+        ///
+        /// @param enabled  Should the render target keep its previous contents and only redraw the damaged areas?
+        ///
+        /// When enabled, widgets report the areas that they occupy when they change and only the widgets that intersect with
+        /// these areas are drawn again. The entire gui is only redrawn when the view or the size of the window changes.
+        /// Custom widgets have to call Widget::invalidateRenderCache() when they change in a way that affects how they are drawn.
+        ///
+        /// Partial redraw is only meant for when the gui is the only thing drawn on the window (e.g. when using mainLoop), as
+        /// the rest of the window is drawn from the contents of the previous frame. It is disabled by default and renderers
+        /// that can't retain the contents of the screen will ignore this setting and always draw everything.
+        ///
+        /// @see BackendRenderTarget::setRedrawAreasOverlayEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPartialRedrawEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether only the parts of the screen that changed since the previous frame are redrawn
+        ///
+        /// @return Is partial redraw enabled?
+        ///
+        /// @see setPartialRedrawEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isPartialRedrawEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Marks an area of the gui (in view coordinates) that has to be redrawn in the next frame
+        ///
+        /// @param area  Area that changed since the previous frame
+        ///
+        /// This function is called by widgets and has no effect when partial redraw is disabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addDamagedArea(const FloatRect& area);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Makes certain that the entire gui is redrawn in the next frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestFullRedraw();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draws all the widgets that were added to the gui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -600,9 +731,95 @@ TGUI_MODULE_EXPORT namespace tgui
         virtual void mainLoop(Color clearColor = {240, 240, 240}) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Queues a function to be executed on the thread that updates the gui
+        ///
+        /// @param func  Function to call during the next updateTime() call
+        ///
+        /// This function may be called from any thread. It wakes up the main loop when it is waiting for events, so that
+        /// worker threads can hand their results to the gui without having to wait until the user moves the mouse.
+        /// When you use your own main loop, the function is executed the next time that updateTime() is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> func);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum time that the main loop waits for events before it updates the gui
+        ///
+        /// @param maxWaitTime  Longest time to wait for an event, timer or posted task (50ms by default)
+        ///
+        /// The main loop sleeps until an event arrives, a task is posted, a timer expires or a tool tip has to be shown.
+        /// Some things such as the blinking edit cursor aren't scheduled and are only updated when the loop wakes up, so
+        /// the wait time is limited by this value. A higher value causes fewer wake-ups when the gui is idle.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMaxIdleWaitTime(Duration maxWaitTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum time that the main loop waits for events before it updates the gui
+        ///
+        /// @return Longest time to wait for an event, timer or posted task
+        ///
+        /// @see setMaxIdleWaitTime
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Duration getMaxIdleWaitTime() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns counters that allow measuring the idle wake-ups and the input latency of the main loop
+        ///
+        /// @return Statistics of the main loop
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD MainLoopStatistics getMainLoopStatistics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resets all counters returned by getMainLoopStatistics
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetMainLoopStatistics();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sends the event to the widgets, bypassing event coalescing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool dispatchEvent(Event event);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Interrupts the main loop when it is waiting for events. This function is called from post(), possibly from another
+        // thread. Backends that wait for events of the window should push an event here and call the base class function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void wakeUpMainLoop();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns how long the main loop can wait for events before the gui has to be updated again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Duration getIdleWaitTime() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sleeps until a task is posted or until the timeout expires, for backends that can't wait for window events.
+        // Returns whether there are posted tasks waiting to be executed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool waitForPostedTasks(Duration timeout);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Executes the functions that were passed to post(). Returns whether any function was executed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool executePostedTasks();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remembers that an event was handled which won't be visible until the next frame, to measure the input latency
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void markEventUnpresented();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the statistics after the main loop presented a frame to the screen
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recordPresentedFrame();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Handles the backend-independent part of the two finger scrolling.
         // Returns whether the touch event should be absorbed by the gui.
@@ -645,10 +862,29 @@ TGUI_MODULE_EXPORT namespace tgui
         bool m_drawUpdatesTime = true;
         bool m_tabKeyUsageEnabled = true;
 
+        bool m_partialRedrawEnabled = false;
+        bool m_fullRedrawRequired = true;
+        unsigned int m_lastSvgTextureVersion = 1;
+        std::vector<FloatRect> m_damagedAreas;
+
         Cursor::Type m_requestedMouseCursor = Cursor::Type::Arrow;
         std::stack<Cursor::Type> m_overrideMouseCursors;
 
         std::shared_ptr<BackendRenderTarget> m_backendRenderTarget = nullptr;
+
+        std::mutex m_postedTasksMutex;
+        std::condition_variable m_postedTasksCondition;
+        std::vector<std::function<void()>> m_postedTasks; // Protected by m_postedTasksMutex
+
+        Duration m_maxIdleWaitTime = std::chrono::milliseconds(50);
+        MainLoopStatistics m_mainLoopStatistics;
+        std::chrono::steady_clock::time_point m_firstUnpresentedEventTime; // Time at which an event was handled that isn't shown yet
+
+        bool m_eventCoalescingEnabled = false;
+        Optional<Event> m_pendingEvent; // Mouse move or wheel event that is held back by event coalescing
+        std::vector<Vector2i> m_pendingMousePositions; // Positions of the mouse moves that were merged into the pending event
+        std::vector<Vector2f> m_coalescedMousePositions;
+        EventStatistics m_eventStatistics;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -241,10 +241,17 @@ TGUI_MODULE_EXPORT namespace tgui
         void updateContainerSize() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Posts an empty event to interrupt glfwWaitEventsTimeout in the main loop
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void wakeUpMainLoop() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         GLFWwindow* m_window = nullptr;
+        bool m_windowRefreshRequired = false; // Set by the refresh callback in mainLoop when the window contents got lost
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -142,6 +142,12 @@ TGUI_MODULE_EXPORT namespace tgui
         void updateContainerSize() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Pushes a user event to interrupt SDL_WaitEventTimeout in the main loop
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void wakeUpMainLoop() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
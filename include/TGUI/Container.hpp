@@ -36,6 +36,11 @@
 
 TGUI_MODULE_EXPORT namespace tgui
 {
+    namespace priv
+    {
+        class ContainerSpatialIndex;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Container widget
     ///
@@ -388,6 +393,33 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD virtual Widget::Ptr getWidgetAtPosition(Vector2f pos) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Enables or disables a grid that is used to speed up finding the child widget below the mouse
+        ///
+        /// @param cellSize  Width and height of each cell in the grid, or 0 to disable the grid
+        ///
+        /// Without the grid, every child widget has to be checked to find out which widget is below the mouse. If the container
+        /// has thousands of child widgets (e.g. markers on a map) then the grid allows only checking the widgets near the mouse.
+        /// The cell size should be similar to the size of the child widgets.
+        ///
+        /// The grid is based on the bounding box of each child widget, which is updated when the widget is moved, resized,
+        /// rotated or scaled. When the grid is enabled, widgets can't react to the mouse outside their bounding box.
+        ///
+        /// The grid is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexCellSize(float cellSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the cells in the grid that is used to speed up finding the child widget below the mouse
+        ///
+        /// @return Width and height of each cell in the grid, or 0 when the grid is disabled
+        ///
+        /// @see setSpatialIndexCellSize
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getSpatialIndexCellSize() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses the next widget in this container
         ///
@@ -480,6 +512,13 @@ TGUI_MODULE_EXPORT namespace tgui
         void childWidgetFocused(const Widget::Ptr& child);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when one of the child widgets of this container is moved, resized, rotated or scaled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetBoundsChanged(const Widget* child);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -672,6 +711,9 @@ TGUI_MODULE_EXPORT namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        // Grid containing the bounding boxes of the child widgets, or nullptr when the grid is disabled
+        std::unique_ptr<priv::ContainerSpatialIndex> m_spatialIndex;
+
 
         friend class SubwidgetContainer; // Needs access to save and load functions
 
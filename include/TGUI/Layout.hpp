@@ -32,8 +32,12 @@
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <type_traits>
     #include <functional>
+    #include <unordered_set>
+    #include <cstdint>
     #include <memory>
     #include <string>
+    #include <utility>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -74,6 +78,15 @@ TGUI_MODULE_EXPORT namespace tgui
             BindingString
         };
 
+        /// Counters of the deferred layout solver, see setDeferredUpdatesEnabled
+        struct SolverStatistics
+        {
+            std::size_t flushes = 0; //!< Number of times that flushLayouts found layouts to recalculate
+            std::size_t lastFlushEvaluations = 0; //!< Number of layouts that were recalculated during the last flush
+            std::size_t lastFlushPasses = 0; //!< Number of passes over the dependency graph during the last flush
+            std::uint64_t totalEvaluations = 0; //!< Number of layouts that were recalculated in all flushes together
+        };
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
@@ -233,6 +246,69 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD Layout* getRightOperand() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether changes to the position or size of widgets are propagated to the layouts that depend on them
+        ///        immediately or only when flushLayouts is called
+        ///
+        /// @param deferred  Should layouts only be recalculated when flushLayouts is called?
+        ///
+        /// By default a widget that changes its position or size immediately recalculates all layouts that are bound to it,
+        /// which recursively resizes and moves the widgets that use these layouts. When the same widgets depend on many
+        /// others, they are recalculated many times while e.g. the window is being resized.
+        ///
+        /// When updates are deferred, the layouts are only marked as dirty. The gui calls flushLayouts once per frame (and
+        /// before handling an event), which recalculates each dirty layout exactly once, in the order of their dependencies.
+        /// Until the layouts are flushed, widgets that depend on a changed widget still report their old position and size.
+        ///
+        /// Disabling deferred updates flushes the pending layouts.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setDeferredUpdatesEnabled(bool deferred);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether changes to the position or size of widgets are only propagated when flushLayouts is called
+        ///
+        /// @return Are layout updates deferred?
+        ///
+        /// @see setDeferredUpdatesEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool isDeferredUpdatesEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Recalculates all layouts that were marked as dirty while updates were deferred
+        ///
+        /// @return True if any layout was recalculated, false if there was nothing to do
+        ///
+        /// This function is called automatically by the gui. You only need to call it yourself when you want to query the
+        /// position or size of widgets after changing a widget on which they depend.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool flushLayouts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the counters of the deferred layout solver
+        ///
+        /// @return Statistics about the recalculated layouts
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static SolverStatistics getSolverStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resets all counters returned by getSolverStatistics to 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void resetSolverStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Recalculates the given layouts, or marks them as dirty when updates are deferred
+        ///
+        /// This is called by a widget with the layouts that are bound to its position or size after they changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void recalculateLayouts(const std::unordered_set<Layout*>& layouts);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -262,6 +338,50 @@ TGUI_MODULE_EXPORT namespace tgui
         void parseBindingString(const String& expression, Widget* widget, bool xAxis);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the value of this layout from its operands or bound widget, without informing the parent layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateValue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the operands and then the layout itself. Returns whether the value of the layout has changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool recalculateTree();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the topmost layout, which is the one that is connected to a widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Layout* getRootLayout();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // The x and y components of the position or size of a widget are recalculated together, so that the widget is only moved
+        // or resized once. This returns the x component in that case and the layout itself otherwise.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Layout* getSolverNode();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the y component if this layout is the x component of the position or size of a widget, or nullptr otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Layout* getSolverNodeSibling() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the solver nodes that depend on the widget value that is stored in this solver node
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void getDependentLayouts(std::vector<Layout*>& dependentLayouts) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the solver nodes of the dirty layouts and of the layouts that depend on them (with the sibling of each node),
+        // sorted so that each node comes after the ones that it uses
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::vector<std::pair<Layout*, Layout*>> sortDirtyLayouts();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -273,6 +393,7 @@ TGUI_MODULE_EXPORT namespace tgui
         Widget* m_boundWidget = nullptr; // The widget on which this layout depends in case the operation is a binding
         String m_boundString; // String referring to a widget on which this layout depends in case the layout was created from a string and contains a binding operation
         std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout and sublayouts are not all constants
+        Widget* m_connectedWidget = nullptr; // The widget of which this layout stores the position or size, if the callback is set
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
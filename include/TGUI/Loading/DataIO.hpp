@@ -105,6 +105,19 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD static std::unique_ptr<Node> parse(std::stringstream& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file that is stored in memory
+        ///
+        /// @param data  UTF-8 encoded contents of the widget file
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /// The data is parsed in-place, it is only copied for values that contain comments or multiple whitespace characters.
+        /// The buffer only has to remain valid during this function call, the returned nodes don't reference it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::unique_ptr<Node> parse(CharStringView data);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Emits the widget file
         ///
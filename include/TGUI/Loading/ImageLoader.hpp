@@ -33,6 +33,7 @@
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cstdint>
     #include <memory>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -46,6 +47,17 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Image that was decoded in the background
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct DecodedFile
+        {
+            String filename;                        //!< Filename that was passed to decodeFileAsync
+            Vector2u size;                          //!< Width and height of the image
+            std::unique_ptr<std::uint8_t[]> pixels; //!< RGBA array of pixels, or nullptr if the image couldn't be loaded
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads an image from a file
         ///
@@ -57,6 +69,63 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD static std::unique_ptr<std::uint8_t[]> loadFromFile(const String& filename, Vector2u& imageSize);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Decodes multiple image files in parallel, so that loading them afterwards doesn't require decoding them
+        ///
+        /// @param filenames  Files to load
+        ///
+        /// The images are decoded on multiple threads and this function returns when all of them have been decoded.
+        /// The next call to loadFromFile for one of these files will return the decoded pixels instead of reading the file.
+        /// Images that fail to load are ignored, loadFromFile will report the error when trying to load them again.
+        ///
+        /// @see clearPreloadedFiles
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void preloadFiles(const std::vector<String>& filenames);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Frees the memory of images that were decoded by preloadFiles but haven't been loaded with loadFromFile yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearPreloadedFiles();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts decoding an image file on a background thread
+        ///
+        /// @param filename  The file to load
+        ///
+        /// The function returns immediately. The decoded image can be retrieved with takeDecodedFiles once it is ready.
+        /// The threads that decode the images are only created the first time this function is called.
+        ///
+        /// @see takeDecodedFiles
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void decodeFileAsync(const String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the images that were decoded in the background since the last time this function was called
+        ///
+        /// @return Images passed to decodeFileAsync that finished decoding, including the ones that failed to load
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::vector<DecodedFile> takeDecodedFiles();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops the threads that decode images in the background and discards the images that weren't retrieved yet
+        ///
+        /// Images that are being decoded while this function is called are finished first.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void cancelAsyncDecoding();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of images that were decoded by preloadFiles but haven't been loaded with loadFromFile yet
+        ///
+        /// @return Number of preloaded images waiting to be used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getPreloadedFilesCount();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads an image from memory (data in memory should contain the entire file, not just the pixels)
         ///
@@ -192,6 +192,60 @@ TGUI_MODULE_EXPORT namespace tgui
         static void flushCache(const String& filename = "");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes the cached contents of a theme file to a binary file, which can be loaded without parsing the theme
+        ///
+        /// @param filename       Filename of the theme file, which will be loaded first if it wasn't cached yet
+        /// @param cacheFilename  Filename of the binary file to create
+        ///
+        /// The binary file contains the property-value pairs after references were resolved. Strings that occur multiple
+        /// times in the theme are only stored once.
+        ///
+        /// @exception Exception when the theme file couldn't be loaded or the binary file couldn't be written
+        ///
+        /// @see loadBinaryCache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveBinaryCache(const String& filename, const String& cacheFilename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Fills the cache of a theme file with the contents of a binary file that was created with saveBinaryCache
+        ///
+        /// @param filename       Filename of the theme file, which is used by the themes to access the cached properties
+        /// @param cacheFilename  Filename of the binary file to load
+        ///
+        /// If the theme file still exists then the binary file is only used when it was created from a theme file with the
+        /// same contents. When this function succeeds, loading a theme with the given filename no longer parses the theme file.
+        ///
+        /// @return True if the cache was filled, false if the binary file was missing, invalid or outdated
+        ///
+        /// @see saveBinaryCache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadBinaryCache(const String& filename, const String& cacheFilename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets whether the images used by a theme are already decoded when the theme file is loaded
+        ///
+        /// @param enabled  Should the images be decoded in parallel when loading the theme file?
+        ///
+        /// When enabled, all images that are referenced in the theme file are decoded on multiple threads while the theme is
+        /// loaded, instead of decoding them one by one when a widget first uses them. Images that aren't used by any widget
+        /// remain in memory until ImageLoader::clearPreloadedFiles is called. This option is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setImagePreloadingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the images used by a theme are already decoded when the theme file is loaded
+        ///
+        /// @return Are images decoded in parallel when loading a theme file?
+        ///
+        /// @see setImagePreloadingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool isImagePreloadingEnabled();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -205,10 +259,19 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD virtual std::unique_ptr<DataIO::Node> readFile(const String& filename) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Decodes all images that are used in a cached theme file in parallel
+        ///
+        /// @param filename  Filename of the theme file, which must already be cached
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preloadImages(const String& filename) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
         static std::map<String, std::map<String, std::map<String, String>>> m_propertiesCache;
         static std::map<String, std::map<String, String>> m_globalPropertiesCache;
+        static bool m_imagePreloadingEnabled;
     };
 
 
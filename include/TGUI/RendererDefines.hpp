@@ -31,12 +31,20 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Registers the type of the property when the library is loaded, so that theme values can be deserialized in advance
+#define TGUI_RENDERER_PROPERTY_REGISTER_TYPE(CLASS, NAME, TYPE) \
+    static const tgui::RendererPropertyId CLASS##NAME##PropertyType{U"" #NAME, tgui::ObjectConverter::Type::TYPE};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #define TGUI_RENDERER_PROPERTY_OUTLINE(CLASS, NAME) \
+    TGUI_RENDERER_PROPERTY_REGISTER_TYPE(CLASS, NAME, Outline) \
     tgui::Outline CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getOutline(); \
+        static const tgui::RendererPropertyId propertyId{U"" #NAME}; \
+        tgui::ObjectConverter* value = m_data->propertyValuePairs.lookup(propertyId); \
+        if (value) \
+            return value->getOutline(); \
         else \
             return {}; \
     } \
@@ -48,11 +56,13 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define TGUI_RENDERER_PROPERTY_COLOR(CLASS, NAME, DEFAULT) \
+    TGUI_RENDERER_PROPERTY_REGISTER_TYPE(CLASS, NAME, Color) \
     tgui::Color CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getColor(); \
+        static const tgui::RendererPropertyId propertyId{U"" #NAME}; \
+        tgui::ObjectConverter* value = m_data->propertyValuePairs.lookup(propertyId); \
+        if (value) \
+            return value->getColor(); \
         else \
             return DEFAULT; \
     } \
@@ -64,11 +74,13 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define TGUI_RENDERER_PROPERTY_TEXT_STYLE(CLASS, NAME, DEFAULT) \
+    TGUI_RENDERER_PROPERTY_REGISTER_TYPE(CLASS, NAME, TextStyle) \
     tgui::TextStyles CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getTextStyle(); \
+        static const tgui::RendererPropertyId propertyId{U"" #NAME}; \
+        tgui::ObjectConverter* value = m_data->propertyValuePairs.lookup(propertyId); \
+        if (value) \
+            return value->getTextStyle(); \
         else \
             return DEFAULT; \
     } \
@@ -80,11 +92,13 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
+    TGUI_RENDERER_PROPERTY_REGISTER_TYPE(CLASS, NAME, Number) \
     float CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getNumber(); \
+        static const tgui::RendererPropertyId propertyId{U"" #NAME}; \
+        tgui::ObjectConverter* value = m_data->propertyValuePairs.lookup(propertyId); \
+        if (value) \
+            return value->getNumber(); \
         else \
             return DEFAULT; \
     }
@@ -99,11 +113,13 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
+    TGUI_RENDERER_PROPERTY_REGISTER_TYPE(CLASS, NAME, Bool) \
     bool CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getBool(); \
+        static const tgui::RendererPropertyId propertyId{U"" #NAME}; \
+        tgui::ObjectConverter* value = m_data->propertyValuePairs.lookup(propertyId); \
+        if (value) \
+            return value->getBool(); \
         else \
             return DEFAULT; \
     }
@@ -118,15 +134,18 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define TGUI_RENDERER_PROPERTY_TEXTURE(CLASS, NAME) \
+    TGUI_RENDERER_PROPERTY_REGISTER_TYPE(CLASS, NAME, Texture) \
     const tgui::Texture& CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getTexture(); \
+        static const tgui::RendererPropertyId propertyId{U"" #NAME}; \
+        tgui::ObjectConverter* value = m_data->propertyValuePairs.lookup(propertyId); \
+        if (value) \
+            return value->getTexture(); \
         else \
         { \
-            m_data->propertyValuePairs[tgui::String(#NAME)] = {tgui::Texture{}}; \
-            return m_data->propertyValuePairs[tgui::String(#NAME)].getTexture(); \
+            tgui::ObjectConverter& newValue = m_data->propertyValuePairs[propertyId]; \
+            newValue = {tgui::Texture{}}; \
+            return newValue.getTexture(); \
         } \
     } \
     void CLASS::set##NAME(const tgui::Texture& texture) \
@@ -137,15 +156,17 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define TGUI_RENDERER_PROPERTY_RENDERER_WITH_DEFAULT(CLASS, NAME, RENDERER, DEFAULT) \
+    TGUI_RENDERER_PROPERTY_REGISTER_TYPE(CLASS, NAME, RendererData) \
     std::shared_ptr<tgui::RendererData> CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getRenderer(); \
+        static const tgui::RendererPropertyId propertyId{U"" #NAME}; \
+        tgui::ObjectConverter* value = m_data->propertyValuePairs.lookup(propertyId); \
+        if (value) \
+            return value->getRenderer(); \
         else \
         { \
             const auto& renderer = tgui::Theme::getDefault()->getRendererNoThrow(RENDERER); \
-            m_data->propertyValuePairs[tgui::String(#NAME)] = {renderer ? renderer : (DEFAULT)}; \
+            m_data->propertyValuePairs[propertyId] = {renderer ? renderer : (DEFAULT)}; \
             return renderer; \
         } \
     } \
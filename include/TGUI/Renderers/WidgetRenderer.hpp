@@ -32,7 +32,11 @@
 #include <TGUI/Loading/DataIO.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <initializer_list>
     #include <unordered_set>
+    #include <cstdint>
+    #include <vector>
+    #include <memory>
     #include <map>
 #endif
 
@@ -43,6 +47,320 @@ TGUI_MODULE_EXPORT namespace tgui
     class Theme;
     class Widget;
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Interned name of a renderer property
+    ///
+    /// Every property name is given a small unique number the first time it is used. Properties can then be looked up by
+    /// that number instead of having to construct and compare strings.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RendererPropertyId
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor that creates an invalid id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererPropertyId() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the id of a property, the name is interned if this is the first time it is used
+        ///
+        /// @param name  Name of the property
+        ///
+        /// The id is normally stored in a static variable, as interning requires locking a mutex and a hash table lookup.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit RendererPropertyId(const String& name);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the id of a property and registers the type of its value
+        ///
+        /// @param name  Name of the property
+        /// @param type  Type of the value of the property
+        ///
+        /// Knowing the type allows values loaded from a theme to be deserialized before any widget requests them.
+        /// If the same name is registered with different types then the type is treated as unknown.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererPropertyId(const String& name, ObjectConverter::Type type);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the id of a property without interning the name
+        ///
+        /// @param name  Name of the property
+        ///
+        /// @return Id of the property, or an invalid id if the name was never interned before
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static RendererPropertyId find(const String& name);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the name of the property
+        ///
+        /// @return Property name, or an empty string if the id is invalid
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const String& getName() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the type of the value that was registered for the property
+        ///
+        /// @return Type of the property, or ObjectConverter::Type::None if the type isn't known
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD ObjectConverter::Type getType() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Converts a value that is still stored as a string to the type that was registered for the property
+        ///
+        /// @param value  Value to convert
+        ///
+        /// @return True if the value was converted, false if it was left unchanged
+        ///
+        /// The value is left unchanged when the type of the property isn't known, when deserialization fails (the error will
+        /// then be reported when the value is actually used) or when the value is a texture and no backend exists yet.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool deserializeValue(ObjectConverter& value) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the number that was assigned to the property name
+        ///
+        /// @return Index of the property, which is smaller than the amount of interned names
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::uint32_t getIndex() const
+        {
+            return m_index;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the id refers to an interned property name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isValid() const
+        {
+            return m_index != invalidIndex;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Compares two ids
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool operator==(const RendererPropertyId& other) const
+        {
+            return m_index == other.m_index;
+        }
+
+        TGUI_NODISCARD bool operator!=(const RendererPropertyId& other) const
+        {
+            return m_index != other.m_index;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        static constexpr std::uint32_t invalidIndex = 0xFFFFFFFF;
+
+        std::uint32_t m_index = invalidIndex;
+
+        friend class RendererPropertyMap;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Property-value pairs of a renderer
+    ///
+    /// The properties are stored in a map sorted by name, but the class also keeps a flat hash table that allows finding
+    /// the values based on a RendererPropertyId.
+    ///
+    /// Copies of the map share their storage until one of them is modified (copy-on-write), so renderers that are copied from
+    /// a theme section reference the values that were deserialized when the theme was loaded. Functions that give write access
+    /// (operator[], erase, clear and the non-const iterators) detach the map from the shared storage first. The lookup function
+    /// doesn't detach: it may only be used to read the value, or to convert a serialized value into its typed form.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RendererPropertyMap
+    {
+    public:
+
+        using Map = std::map<String, ObjectConverter>;
+        using iterator = Map::iterator;
+        using const_iterator = Map::const_iterator;
+
+        RendererPropertyMap() = default;
+        RendererPropertyMap(const Map& map);
+        RendererPropertyMap(const RendererPropertyMap& other);
+        RendererPropertyMap(RendererPropertyMap&& other) noexcept;
+        RendererPropertyMap& operator=(const RendererPropertyMap& other);
+        RendererPropertyMap& operator=(RendererPropertyMap&& other) noexcept;
+        RendererPropertyMap& operator=(const Map& map);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the properties as a map that is sorted by name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const Map& getMap() const;
+
+        operator const Map&() const
+        {
+            return getMap();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the value of a property based on its interned name
+        ///
+        /// @param id  Id of the property
+        ///
+        /// @return Pointer to the value of the property, or a nullptr if the property doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD ObjectConverter* lookup(RendererPropertyId id) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of a property based on its interned name, the property is added if it didn't exist yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter& operator[](RendererPropertyId id);
+
+        ObjectConverter& operator[](const String& property);
+
+        TGUI_NODISCARD iterator find(const String& property);
+
+        TGUI_NODISCARD const_iterator find(const String& property) const
+        {
+            return getMap().find(property);
+        }
+
+        iterator erase(const_iterator it);
+
+        std::size_t erase(const String& property);
+
+        void clear();
+
+        TGUI_NODISCARD bool empty() const
+        {
+            return !m_storage || m_storage->map.empty();
+        }
+
+        TGUI_NODISCARD std::size_t size() const
+        {
+            return m_storage ? m_storage->map.size() : 0;
+        }
+
+        TGUI_NODISCARD iterator begin();
+
+        TGUI_NODISCARD iterator end();
+
+        TGUI_NODISCARD const_iterator begin() const
+        {
+            return getMap().begin();
+        }
+
+        TGUI_NODISCARD const_iterator end() const
+        {
+            return getMap().end();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Converts all values that are still stored as a string to the type that was registered for their property
+        ///
+        /// This is done when loading a theme, so that widgets using the renderer don't have to parse the values.
+        /// The values are converted in-place, so all copies that share the storage benefit from it.
+        ///
+        /// @see RendererPropertyId::deserializeValue
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void deserializeValues();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the map shares its storage with a copy of it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isStorageShared() const
+        {
+            return m_storage && (m_storage.use_count() > 1);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a value to the hash table, the table is grown when needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToIndex(RendererPropertyId id, ObjectConverter* value);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recreates the hash table from the contents of the map
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildIndex();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes certain that the map has storage that isn't shared with any copy, so that it can be modified
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void detach();
+
+        struct Storage
+        {
+            Map map;
+
+            // Open addressing hash table with linear probing, the size is always 0 or a power of 2.
+            // The values point inside the map, whose nodes never move in memory.
+            std::vector<std::pair<std::uint32_t, ObjectConverter*>> index;
+            std::size_t indexCount = 0;
+        };
+
+        std::shared_ptr<Storage> m_storage; // Null when the map is empty and was never modified
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    /// @brief Table that maps renderer properties to the function that handles changes to the property inside a widget
+    ///
+    /// This is used in rendererChanged to avoid comparing the property name against every name that the widget supports.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename WidgetType>
+    class RendererPropertyHandlers
+    {
+    public:
+
+        using Handler = void(*)(WidgetType&, const String&);
+
+        RendererPropertyHandlers(std::initializer_list<std::pair<const char32_t*, Handler>> handlers)
+        {
+            for (const auto& pair : handlers)
+            {
+                const RendererPropertyId id{pair.first};
+                if (id.getIndex() >= m_handlers.size())
+                    m_handlers.resize(id.getIndex() + 1, nullptr);
+
+                m_handlers[id.getIndex()] = pair.second;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls the function that handles the property
+        ///
+        /// @return True when the property was handled, false when there was no function for the property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool call(WidgetType& widget, const String& property) const
+        {
+            const RendererPropertyId id = RendererPropertyId::find(property);
+            if (!id.isValid() || (id.getIndex() >= m_handlers.size()) || !m_handlers[id.getIndex()])
+                return false;
+
+            m_handlers[id.getIndex()](widget, property);
+            return true;
+        }
+
+    private:
+
+        std::vector<Handler> m_handlers; // Indexed by RendererPropertyId
+    };
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Shared data used in renderer classes
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,7 +375,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @internal
         TGUI_NODISCARD static std::shared_ptr<RendererData> createFromDataIONode(const DataIO::Node* rendererNode);
 
-        std::map<String, ObjectConverter> propertyValuePairs;
+        RendererPropertyMap propertyValuePairs;
         std::unordered_set<Widget*> observers;
         Theme* connectedTheme = nullptr;
         bool themePropertiesInherited = false;
@@ -135,11 +135,11 @@ TGUI_MODULE_EXPORT namespace tgui
             const auto id = ++m_lastSignalId;
 #if defined(__cpp_if_constexpr) && (__cpp_if_constexpr >= 201606L)
             if constexpr(sizeof...(BoundArgs) == 0)
-                m_handlers[id] = func;
+                addHandler(id, func);
             else
 #endif
             {
-                m_handlers[id] = [=]{ invokeFunc(func, args...); };
+                addHandler(id, [=]{ invokeFunc(func, args...); });
             }
 
             return id;
@@ -230,6 +230,12 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a handler to the list of handlers, the list is copied first if it is currently being emitted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addHandler(unsigned int id, std::function<void()> handler);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Extracts the widget stored in the first parameter
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -273,7 +279,12 @@ TGUI_MODULE_EXPORT namespace tgui
 
         bool m_enabled = true;
         String m_name;
-        std::unordered_map<unsigned int, std::function<void()>> m_handlers;
+
+        // The handlers are stored in the order in which they were connected. The list is shared with emit while the handlers
+        // are being called, so connecting or disconnecting during that time replaces the list instead of changing it.
+        // The pointer is a nullptr when there are no handlers.
+        using HandlerList = std::vector<std::pair<unsigned int, std::function<void()>>>;
+        std::shared_ptr<HandlerList> m_handlers;
 
         static unsigned int m_lastSignalId;
         static std::deque<const void*> m_parameters;
@@ -355,7 +366,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, T param)
         {
-            if (m_handlers.empty())
+            if (!m_handlers)
                 return false;
 
             m_parameters[1] = static_cast<const void*>(&param);
@@ -440,7 +451,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, T1 param1, T2 param2)
         {
-            if (m_handlers.empty())
+            if (!m_handlers)
                 return false;
 
             m_parameters[1] = static_cast<const void*>(&param1);
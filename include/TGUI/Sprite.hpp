@@ -252,6 +252,16 @@ TGUI_MODULE_EXPORT namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether the SVG texture is a placeholder while the image is being rasterized at the correct size.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isSvgRasterizationPending() const
+        {
+            return m_svgRasterizationPending;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// Returns the internal vertices for drawing.
@@ -274,7 +284,7 @@ TGUI_MODULE_EXPORT namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// Updates the location of the vertices. In case of an SVG texture, this function also performs the rasterization again.
+        /// Updates the location of the vertices. In case of an SVG texture, this function also gets the image rasterized at the new size.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateVertices();
 
@@ -285,6 +295,7 @@ TGUI_MODULE_EXPORT namespace tgui
         Vector2f    m_size;
         Texture     m_texture;
         std::shared_ptr<BackendTexture> m_svgTexture;
+        bool m_svgRasterizationPending = false;
         std::vector<Vertex> m_vertices;
         std::vector<unsigned int> m_indices;
 
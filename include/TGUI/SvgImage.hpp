@@ -30,6 +30,7 @@
 #include <TGUI/Vector2.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cstddef>
     #include <memory>
 #endif
 
@@ -99,6 +100,87 @@ TGUI_MODULE_EXPORT namespace tgui
         void rasterize(BackendTexture& texture, Vector2u size);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns a texture containing the image rasterized at the given size
+        ///
+        /// @param size                  Size that the texture should have (before the font scale is applied)
+        /// @param rasterizationPending  Set to true when the returned texture has a different size than requested,
+        ///                              because the requested size is still being rasterized in the background
+        ///
+        /// @return Texture that is shared with all other sprites that show this image at the same size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::shared_ptr<BackendTexture> getRasterizedTexture(Vector2u size, bool& rasterizationPending);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether svg images are rasterized on background threads
+        ///
+        /// @param enabled  Should a new size of an image be rasterized in the background?
+        ///
+        /// When enabled, a sprite that needs an image at a size that isn't cached yet will temporarily show the image
+        /// at the closest size that was already rasterized, while the requested size is rendered on a background thread.
+        /// The image is always rasterized immediately when it isn't available at any size yet.
+        ///
+        /// Background rasterization is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAsyncRasterizationEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether svg images are rasterized on background threads
+        ///
+        /// @return Is a new size of an image rasterized in the background?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool isAsyncRasterizationEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of memory that the rasterized images may use before the least recently used ones are removed
+        ///
+        /// @param bytes  Maximum amount of memory used by the cached textures
+        ///
+        /// Rasterized images are shared between all sprites that show the same svg at the same size. A removed image remains
+        /// valid for the sprites that are still showing it, but new sprites will have to rasterize the image again.
+        ///
+        /// The default budget is 64 MB.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setRasterCacheMemoryBudget(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of memory that the rasterized images may use before the least recently used ones are removed
+        ///
+        /// @return Maximum amount of memory used by the cached textures
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getRasterCacheMemoryBudget();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of memory currently used by the cached rasterized images
+        ///
+        /// @return Memory used by the cached textures, in bytes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getRasterCacheMemoryUsage();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all rasterized images from the cache and stops the background threads
+        ///
+        /// This function is called automatically when the backend is destroyed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearRasterCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Creates the textures for the images that finished rasterizing in the background
+        ///
+        /// @return True when sprites that are waiting for a background rasterization should request their texture again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool finishBackgroundRasterizations();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -164,6 +164,34 @@ TGUI_MODULE_EXPORT namespace tgui
                   const UIntRect& middleRect = {},
                   bool smooth = m_defaultSmooth);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a texture without blocking the gui, by decoding the image on a background thread
+        ///
+        /// @param id         Id for the the image to load (for the default loader, the id is the filename)
+        /// @param func       Function that receives the loaded texture, or an empty texture (without data) when loading failed
+        /// @param partRect   Load only part of the image. Don't pass this parameter if you want to load the full image
+        /// @param middleRect Choose the middle part of the image for 9-slice scaling (relative to the part defined by partRect)
+        /// @param smooth     Enable smoothing on the texture
+        ///
+        /// The function is called on the gui thread, from within the updateTime function of the gui, once the image is ready.
+        /// A widget can show a placeholder image until then:
+        /// @code
+        /// auto picture = tgui::Picture::create("Placeholder.png");
+        /// tgui::Texture::loadAsync("Photo.jpg", [picture](const tgui::Texture& texture) {
+        ///     if (texture.getData())
+        ///         picture->getRenderer()->setTexture(texture);
+        /// });
+        /// @endcode
+        ///
+        /// The function is called immediately when the image was already loaded, when it is an svg image or when a custom
+        /// texture loader or backend texture loader is being used. Multiple requests for the same file only decode it once.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void loadAsync(const String& id,
+                              std::function<void(const Texture&)> func,
+                              const UIntRect& partRect = {},
+                              const UIntRect& middleRect = {},
+                              bool smooth = m_defaultSmooth);
+
 #if TGUI_HAS_RENDERER_BACKEND_SFML_GRAPHICS
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Creates the texture from an existing sf::Texture
@@ -62,6 +62,8 @@ TGUI_MODULE_EXPORT namespace tgui
         String  filename;
         bool smooth = true;
         unsigned int users = 0;
+        std::size_t gpuMemoryUsage = 0;
+        std::size_t cpuMemoryUsage = 0;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
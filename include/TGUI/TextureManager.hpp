@@ -31,9 +31,11 @@
 #include <TGUI/TextureData.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <functional>
     #include <memory>
     #include <list>
-    #include <map>
+    #include <unordered_map>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -47,6 +49,22 @@ TGUI_MODULE_EXPORT namespace tgui
     class TGUI_API TextureManager
     {
     public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Counters that can be used to monitor the texture cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Statistics
+        {
+            std::size_t hits = 0;                 //!< Number of times a requested image was already loaded
+            std::size_t misses = 0;               //!< Number of times a requested image had to be loaded from its file
+            std::size_t evictions = 0;            //!< Number of images that were removed from memory after no texture used them
+            std::size_t gpuMemoryUsage = 0;       //!< Bytes used by the stored images on the GPU
+            std::size_t cpuMemoryUsage = 0;       //!< Bytes used by the copies of the pixels that are kept in CPU memory
+            std::size_t releasedMemoryUsage = 0;  //!< Part of the used memory that belongs to images no longer used by any texture
+            std::size_t releasedImages = 0;       //!< Number of images that are kept in memory while no texture uses them
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads a texture
         ///
@@ -76,17 +94,104 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /// @param textureDataToRemove  The texture data that should be removed
         ///
-        /// When no other texture is using the same image then the image will be removed from memory.
+        /// When no other texture is using the same image then the image will be released. A released image is kept in memory
+        /// for as long as the memory budget allows it, so that loading the same file again doesn't require decoding it again.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void removeTexture(const std::shared_ptr<TextureData>& textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads an image without blocking, by decoding it on a background thread
+        ///
+        /// @param filename   Filename of the image to load
+        /// @param smooth     Enable smoothing on the texture
+        /// @param func       Function to call on the gui thread once the image is loaded or failed to load
+        ///
+        /// While func is being called, getTexture can load the image without having to decode it (unless decoding failed).
+        /// If the image was already loaded then func is called immediately. Requests for an image that is already being
+        /// decoded don't decode it again, they are finished together with the first request.
+        ///
+        /// This function always decodes the file with ImageLoader, it should not be used with a custom texture loader.
+        ///
+        /// @see Texture::loadAsync
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void loadTextureAsync(const String& filename, bool smooth, std::function<void()> func);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Creates the textures of the images that were decoded in the background and calls the functions waiting on them
+        ///
+        /// @return True when at least one function was called
+        ///
+        /// This function gets called internally by the gui each frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool finishAsyncLoads();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops loading images in the background, without calling the functions that were waiting on them
+        ///
+        /// This function is called automatically when the backend is destroyed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void cancelAsyncLoads();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of images that are still being loaded in the background
+        ///
+        /// @return Number of images of which the functions passed to loadTextureAsync haven't been called yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getAsyncLoadsCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of memory that loaded images may use before released images are removed from memory
+        ///
+        /// @param bytes  Memory budget in bytes, counting both the GPU textures and the pixels that are kept in CPU memory
+        ///
+        /// Images that are still being used by a texture are never removed, so the budget can be exceeded when all images are
+        /// in use. Released images are removed in the order in which they were released, starting with the oldest one.
+        ///
+        /// The default budget is 0, which means that images are removed as soon as no texture uses them anymore.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setMemoryBudget(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of memory that loaded images may use before released images are removed from memory
+        ///
+        /// @return Memory budget in bytes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getMemoryBudget();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all images from memory that are no longer used by any texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removeReleasedImages();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the cache counters and the amount of memory used by the loaded images
+        ///
+        /// @return Statistics of the texture manager
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static Statistics getStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resets the hit, miss and eviction counters to 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void resetStatistics();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Returns how many textures are stored in the texture manager
         ///
-        /// @return Number of images in the texture manager
+        /// @return Number of images in the texture manager, including released images that are still kept in memory
         ///
         /// This function is used in the tests to verify that there are no textures being leaked when the tests are finished.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -96,7 +201,69 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        static std::map<String, std::list<TextureDataHolder>> m_imageMap;
+        struct FilenameHasher
+        {
+            TGUI_NODISCARD std::size_t operator()(const String& filename) const;
+        };
+
+        struct ImageLocation
+        {
+            std::list<TextureDataHolder>::iterator holder;
+            std::list<const TextureData*>::iterator releasedPosition; // Only valid when no texture uses the image
+        };
+
+        using ImageLocationMap = std::unordered_map<const TextureData*, ImageLocation>;
+
+        struct AsyncLoadRequest
+        {
+            bool smooth = true;
+            std::function<void()> func;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the bookkeeping after an image was added to the end of the list
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addLoadedImage(std::list<TextureDataHolder>& images);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores an image that was decoded in the background, the returned data has to be passed to removeTexture afterwards
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::shared_ptr<TextureData> addDecodedImage(const String& filename, bool smooth, Vector2u size, std::unique_ptr<std::uint8_t[]> pixels);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Releases an image that is no longer used by any texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void releaseImage(const TextureData* data);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes released images, starting with the oldest one, until the memory budget is no longer exceeded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void evictReleasedImages(std::size_t memoryBudget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes an image that is no longer used from memory
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removeImage(ImageLocationMap::iterator locationIt);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the memory usage of an image that changed what it keeps in CPU memory (e.g. with setPixelStorage).
+        // This isn't done for all images when evicting, so that loading and releasing images doesn't depend on the cache size.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void updatePixelMemoryUsage(TextureDataHolder& dataHolder);
+
+
+        static std::unordered_map<String, std::list<TextureDataHolder>, FilenameHasher> m_imageMap;
+        static ImageLocationMap m_imageLocations;
+        static std::list<const TextureData*> m_releasedImages; // Images that are no longer used, the oldest one first
+        static std::size_t m_memoryBudget;
+        static Statistics m_statistics;
+        static std::unordered_map<String, std::vector<AsyncLoadRequest>, FilenameHasher> m_asyncLoads;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,7 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <functional>
+    #include <cstdint>
     #include <memory>
     #include <vector>
 #endif
@@ -183,14 +184,48 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the first timer has to be triggered before the second one
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool isScheduledBefore(const Timer& first, const Timer& second);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the timer at the given index in m_activeTimers to the correct position in the heap
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void updateHeapPosition(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places a timer at the given index in m_activeTimers and updates the index stored inside the timer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void placeInHeap(std::size_t index, std::shared_ptr<Timer> timer);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the timer at the given index from m_activeTimers
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removeFromHeap(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // The active timers form a binary min-heap, ordered on their deadline
         static std::vector<std::shared_ptr<Timer>> m_activeTimers;
 
+        // Sum of all elapsed times passed to updateTime, the deadlines of the timers are relative to this time
+        static Duration m_currentTime;
+
+        static std::uint64_t m_lastScheduleId;
+
         bool m_repeats = false;
         bool m_enabled = false;
         Duration m_interval;
         std::function<void()> m_callback;
 
-        Duration m_remainingDuration;
+        Duration m_deadline;
+        std::uint64_t m_scheduleId = 0; // Timers with the same deadline are triggered in the order in which they were started
+        std::size_t m_heapIndex = 0;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
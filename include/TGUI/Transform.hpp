@@ -30,6 +30,7 @@
 
 #include <TGUI/Config.hpp>
 #include <TGUI/Rect.hpp>
+#include <TGUI/Vertex.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <array>
@@ -116,6 +117,31 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD Vector2f transformPoint(const Vector2f& point) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Transform multiple 2D points at once
+        ///
+        /// @param points  Pointer to the first point to transform
+        /// @param output  Pointer to where the transformed points are written, which may be the same as the points parameter
+        /// @param count   Amount of points to transform
+        ///
+        /// This gives the same result as calling transformPoint for each point, but SSE or NEON instructions are used when
+        /// the compiler targets a CPU that supports them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void transformPoints(const Vector2f* points, Vector2f* output, std::size_t count) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Transform the positions of multiple vertices at once
+        ///
+        /// @param vertices  Pointer to the first vertex to transform
+        /// @param output    Pointer to where the transformed vertices are written, which may be the same as the vertices parameter
+        /// @param count     Amount of vertices to transform
+        ///
+        /// The colors and texture coordinates of the vertices are copied unchanged.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void transformPoints(const Vertex* vertices, Vertex* output, std::size_t count) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Transform a rectangle
         ///
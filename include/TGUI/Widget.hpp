@@ -828,6 +828,47 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD bool isFocusable() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the draw calls of the widget are recorded and repeated in the next frames
+        ///
+        /// @param enabled  Should the widget be drawn from a cache while it doesn't change?
+        ///
+        /// When enabled, the vertices created while drawing the widget (and its child widgets in case of a container) are stored.
+        /// As long as the widget isn't changed, it is drawn by passing the stored vertices to the render target again instead
+        /// of recreating them. This is useful for widgets that rarely change but are expensive to draw.
+        ///
+        /// The cache is cleared when the widget is moved, resized, receives an event, changes renderer properties, when a
+        /// function specific to its type changes how it looks (e.g. ListBox::addItem) or when a child widget is added, removed
+        /// or changed.
+        ///
+        /// Render caching is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRenderCachingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the draw calls of the widget are recorded and repeated in the next frames
+        ///
+        /// @return Is the widget drawn from a cache while it doesn't change?
+        ///
+        /// @see setRenderCachingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isRenderCachingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes certain that the widget and its parents are drawn from scratch in the next frame
+        ///
+        /// The built-in widgets call this function themselves whenever they change. It only has to be called by custom widgets
+        /// that use render caching or partial redraw, after changing their state in a way that affects how they are drawn.
+        /// Besides clearing the render caches, it informs the gui that the area occupied by the widget has to be redrawn.
+        ///
+        /// @see setRenderCachingEnabled
+        /// @see BackendGui::setPartialRedrawEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateRenderCache();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Makes all animations of the widget finish immediately
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1076,6 +1117,20 @@ TGUI_MODULE_EXPORT namespace tgui
         void rendererChangedCallback(const String& property);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the recorded draw calls of the widget, or nullptr when render caching is disabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD BackendRenderTarget::RenderCache* getRenderCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Called by the render target to inform the widget about the area it covers on the screen (in gui coordinates)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setLastDrawnArea(const FloatRect& area);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Called when the text size is changed (either by setTextSize or via the renderer) or when font scale changes
@@ -1231,9 +1286,16 @@ TGUI_MODULE_EXPORT namespace tgui
         Any m_userData;
         Cursor::Type m_mouseCursor = Cursor::Type::Arrow;
 
+        // Recorded draw calls, only created when render caching is enabled
+        std::unique_ptr<BackendRenderTarget::RenderCache> m_renderCache;
+
+        // Area that the widget covered the last time it was drawn, which has to be redrawn when the widget changes
+        Optional<FloatRect> m_lastDrawnArea;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         friend class Container; // Container accesses save and load functions
+        friend class Layout; // Layout accesses the bound layouts to find the layouts that depend on this widget
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
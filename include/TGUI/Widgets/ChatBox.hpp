@@ -33,6 +33,7 @@
 #include <TGUI/Text.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <vector>
     #include <deque>
 #endif
 
@@ -55,6 +56,7 @@ TGUI_MODULE_EXPORT namespace tgui
         {
             Text text;
             String string;
+            float top = 0; // Position of the line, relative to a point that stays the same when lines are added or removed
         };
 
 
@@ -155,6 +157,32 @@ TGUI_MODULE_EXPORT namespace tgui
         void addLine(const String& text, Color color, TextStyles style);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple lines of text to the chat box
+        ///
+        /// This has the same result as calling addLine for each text, but the scrollbar is only updated once. When a line limit
+        /// is set, lines that would be removed again before the end of the function are skipped.
+        ///
+        /// The default text color and style will be used.
+        ///
+        /// @param texts  Texts that will be added to the chat box, each text is considered to be a separate line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLines(const std::vector<String>& texts);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple lines of text to the chat box
+        ///
+        /// This has the same result as calling addLine for each text, but the scrollbar is only updated once. When a line limit
+        /// is set, lines that would be removed again before the end of the function are skipped.
+        ///
+        /// @param texts  Texts that will be added to the chat box, each text is considered to be a separate line
+        /// @param color  Color of the texts
+        /// @param style  Text style
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLines(const std::vector<String>& texts, Color color, TextStyles style);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the contents of the requested line
         ///
@@ -377,6 +405,12 @@ TGUI_MODULE_EXPORT namespace tgui
         void recalculateLineText(Line& line);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a line without updating the scrollbar
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertLine(const String& text, Color color, TextStyles style);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates all text attributes, recalculate the full text height and update the displayed text
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -384,7 +418,7 @@ TGUI_MODULE_EXPORT namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates the space used by all the lines
+        // Recalculates the space used by all the lines and updates the scrollbar
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateFullTextHeight();
 
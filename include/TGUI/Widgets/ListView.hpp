@@ -34,6 +34,7 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <set>
+    #include <unordered_map>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -81,6 +82,37 @@ TGUI_MODULE_EXPORT namespace tgui
             ColumnAlignment alignment = ColumnAlignment::Left;
         };
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Interface that provides the contents of the list view when it is used in virtual mode
+        ///
+        /// When a data provider is set with setDataProvider, the list view no longer stores the items itself. The texts are
+        /// only requested for the rows that are visible, so the list view can display millions of rows without creating
+        /// text objects for each of them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class DataProvider
+        {
+        public:
+            virtual ~DataProvider() = default;
+
+            /// @brief Returns the amount of rows in the list view
+            TGUI_NODISCARD virtual std::size_t getRowCount() const = 0;
+
+            /// @brief Returns the text to display in a cell (column is 0 when the list view has no columns)
+            TGUI_NODISCARD virtual String getCellText(std::size_t row, std::size_t column) const = 0;
+
+            /// @brief Returns the icon to display in front of the row, or an empty texture when the row has no icon
+            TGUI_NODISCARD virtual Texture getIcon(std::size_t) const
+            {
+                return {};
+            }
+
+            /// @brief Returns the user data that is returned by ListView::getItemData for the row
+            TGUI_NODISCARD virtual Any getRowData(std::size_t) const
+            {
+                return {};
+            }
+        };
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
@@ -350,6 +382,8 @@ TGUI_MODULE_EXPORT namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes all items from the list
+        ///
+        /// If a data provider was set then it is also removed from the list view.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void removeAllItems();
 
@@ -392,6 +426,27 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD std::set<std::size_t> getSelectedItemIndices() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Selects all items between two indices
+        ///
+        /// @param firstIndex  Index of the first item to select
+        /// @param lastIndex   Index of the last item to select (inclusive)
+        ///
+        /// Unlike setSelectedItems, this function doesn't require a set with all indices, which matters when selecting a
+        /// large part of a list view that gets its items from a data provider. When multi-select is disabled, only the
+        /// first item is selected.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSelectedItemRange(std::size_t firstIndex, std::size_t lastIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets the selected items as ranges of consecutive items
+        ///
+        /// @return Sorted list of ranges, each containing the index of the first and last (inclusive) item in the range
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::vector<std::pair<std::size_t, std::size_t>> getSelectedItemRanges() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Allow multi selection of the items
         ///
@@ -432,7 +487,9 @@ TGUI_MODULE_EXPORT namespace tgui
         template <typename DataType>
         TGUI_NODISCARD DataType getItemData(std::size_t index) const
         {
-            if (index < m_items.size())
+            if (m_dataProvider && (index < m_dataProvider->getRowCount()))
+                return AnyCast<DataType>(m_dataProvider->getRowData(index));
+            else if (index < m_items.size())
                 return AnyCast<DataType>(m_items[index].data);
             else
                 throw std::bad_cast();
@@ -525,10 +582,104 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @code
         /// listView->sort(0, [](const tgui::String& a, const tgui::String& b) { return a < b; });
         /// @endcode
+        ///
+        /// This function reorders the items themselves on the calling thread, so the indices of the items change.
+        /// Use setSortOrder to only change the order in which the items are displayed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void sort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the order in which the items are displayed, without changing the indices of the items
+        ///
+        /// @param column  The index of the column for sorting
+        /// @param cmp     The comparator, or an empty function to display the items in the order in which they were added
+        ///
+        /// The items are sorted on a background thread. The list view keeps showing the old order until the new one is
+        /// ready, after which it is swapped in during the next update of the gui. Items that are added or changed later are
+        /// placed at the correct position immediately. All item indices used by the list view (e.g. in getSelectedItemIndex
+        /// and the signals) remain the indices of the items and not the rows in which they are shown.
+        ///
+        /// @warning The comparator is called from other threads, it must not throw and may not access the list view.
+        ///
+        /// This function has no effect when a data provider is set, the provider should sort its rows itself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSortOrder(std::size_t column, std::function<bool(const String&, const String&)> cmp);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only displays the items for which the filter returns true
+        ///
+        /// @param filter  Function that is given the texts of all columns of an item, or an empty function to show all items
+        ///
+        /// Just like with setSortOrder, the items are filtered on a background thread and the result is only shown once it
+        /// is ready. Selected items that are hidden by the filter are deselected at that moment.
+        ///
+        /// @warning The filter is called from another thread, it must not throw and may not access the list view.
+        ///
+        /// This function has no effect when a data provider is set.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilter(std::function<bool(const std::vector<String>&)> filter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the order set with setSortOrder or the filter set with setFilter is still being calculated
+        ///
+        /// @return Is the list view still displaying the items in an old order?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isSortOrFilterPending() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of items that are displayed in the list view
+        ///
+        /// @return Number of items that aren't hidden by the filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getDisplayedItemCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the indices of the displayed items, in the order in which they are shown
+        ///
+        /// @return Index of the item displayed in each row
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::vector<std::size_t> getDisplayedItemIndices() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Lets the list view get its items from a data provider instead of storing them itself
+        ///
+        /// @param dataProvider  Object that provides the rows, or nullptr to go back to storing the items in the list view
+        ///
+        /// Any items that were added to the list view are removed when setting a data provider. While a provider is set,
+        /// the functions that add, change, remove or sort items can't be used, the data should be changed in the provider
+        /// and updateFromDataProvider should be called afterwards. Only the visible rows are turned into texts, which are
+        /// kept in a small cache that is cleared by updateFromDataProvider.
+        ///
+        /// Because the list view doesn't look at the rows that aren't visible, the width of the items isn't taken into
+        /// account when there are no columns or when the last column is expanded. Icons from the provider are only shown
+        /// when a fixed icon size with a width was set with setFixedIconSize.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDataProvider(std::shared_ptr<DataProvider> dataProvider);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the data provider from which the list view gets its items
+        ///
+        /// @return Data provider that was set with setDataProvider, or nullptr when the items are stored in the list view
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::shared_ptr<DataProvider> getDataProvider() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the list view that the rows in the data provider were changed
+        ///
+        /// This function has to be called after rows were added, removed or changed in the data provider. It updates the
+        /// scrollbar and drops selected items that no longer exist.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateFromDataProvider();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the height of the items in the list view
         ///
@@ -841,6 +992,81 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Set of item indices that is stored as sorted ranges, so that selecting many consecutive items stays cheap
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API IndexRanges
+        {
+        public:
+            TGUI_NODISCARD bool empty() const
+            {
+                return m_ranges.empty();
+            }
+
+            // Returns the lowest index in the set. The set must not be empty.
+            TGUI_NODISCARD std::size_t front() const
+            {
+                return m_ranges.front().first;
+            }
+
+            // Returns the amount of indices in the set
+            TGUI_NODISCARD std::size_t size() const;
+
+            TGUI_NODISCARD bool contains(std::size_t index) const;
+
+            void clear()
+            {
+                m_ranges.clear();
+            }
+
+            void insert(std::size_t index)
+            {
+                insert(index, index + 1);
+            }
+
+            // Adds all indices from first to end (exclusive)
+            void insert(std::size_t first, std::size_t end);
+
+            void erase(std::size_t index);
+
+            // Removes the index and decrements all higher indices, for when the item at that index is removed
+            void eraseAndShift(std::size_t index);
+
+            // Removes all indices that are equal or higher than the given index
+            void eraseFrom(std::size_t index);
+
+            // Returns the ranges as pairs of the first index and the end index (exclusive)
+            TGUI_NODISCARD const std::vector<std::pair<std::size_t, std::size_t>>& getRanges() const
+            {
+                return m_ranges;
+            }
+
+            TGUI_NODISCARD bool operator==(const IndexRanges& other) const
+            {
+                return m_ranges == other.m_ranges;
+            }
+
+            TGUI_NODISCARD bool operator!=(const IndexRanges& other) const
+            {
+                return m_ranges != other.m_ranges;
+            }
+
+        private:
+            std::vector<std::pair<std::size_t, std::size_t>> m_ranges; // Sorted and neither overlapping nor adjacent
+        };
+
+        // Item created from a data provider row, together with the information needed to keep the cache up-to-date
+        struct CachedItem
+        {
+            std::size_t index = 0;
+            std::uint64_t lastUsed = 0;
+            Item item;
+        };
+
+        // Sorts and filters a copy of the items on a background thread (defined in ListView.cpp)
+        struct SortFilterTask;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves a signal based on its name
         ///
@@ -900,7 +1126,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Create a Text object for an item from the given caption, using the preset color, font, text size and opacity
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD Text createText(const String& caption);
+        TGUI_NODISCARD Text createText(const String& caption) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -915,6 +1141,18 @@ TGUI_MODULE_EXPORT namespace tgui
         virtual void setItemColor(std::size_t index, const Color& color);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the color that the texts of an item should have, depending on whether it is selected and/or hovered
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const Color& getItemTextColor(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the size of an icon, taking the fixed icon size into account
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Vector2f calculateIconSize(const Texture& texture) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Calculate the width of the column based on its caption when no column width was provided
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -957,6 +1195,12 @@ TGUI_MODULE_EXPORT namespace tgui
         void selectRangeFromEvent(std::size_t item);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces the selected items, emits the onItemSelect signal if the selection changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSelectedItems(IndexRanges selectedItems);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Update the maximum item width of the last column by recalculating all items' widths.
         // Returns whether the max item width was changed.
@@ -1024,6 +1268,79 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD bool findBorderBelowMouse(Vector2f pos, std::size_t& columnIndex, float& pixelOffset) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the items are displayed in a different order than they are stored, because a sort order or filter
+        // was set. When this returns false, the row of each item is the same as its index.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isSortedOrFiltered() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the item that is displayed in the given row
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getItemIndexAtRow(std::size_t row) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the row in which an item is displayed, or -1 if the item is hidden by the filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD int getRowOfItem(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called after the sort order or filter was changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sortOrFilterChanged(bool wasSortedOrFiltered);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the items and starts sorting and filtering them on a background thread
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void startSortFilterTask();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stops using the result of a running sort/filter task, a new task will be started during the next update
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void restartSortFilterTask();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces the order in which the items are displayed with the result of a sort/filter task
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDisplayedItems(std::vector<std::size_t> displayedItems);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places an item at the correct position in the displayed items, if it passes the filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertDisplayedItem(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the displayed items after items were inserted into m_items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void itemsInserted(std::size_t index, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the displayed items after an item was removed from m_items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void itemRemoved(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the displayed items after the texts of an item were changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void itemChanged(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the row of each item from the displayed items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateItemRows();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculate the size and viewport size of the scrollbars
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1052,6 +1369,19 @@ TGUI_MODULE_EXPORT namespace tgui
         void drawColumn(BackendRenderTarget& target, RenderStates states, std::size_t firstItem, std::size_t lastItem, std::size_t column, float columnWidth) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the item that should be drawn at the given index. When a data provider is set, the item is taken from
+        // the cache of visible rows and is only created when it isn't in the cache yet.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const Item& getItemForDrawing(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes all rows from the data provider cache, e.g. because the font or text size changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearDataProviderCache();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called every frame with the time passed since the last frame.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1084,7 +1414,21 @@ TGUI_MODULE_EXPORT namespace tgui
 
         std::vector<Column> m_columns;
         std::vector<Item>   m_items;
-        std::set<std::size_t> m_selectedItems;
+        IndexRanges m_selectedItems;
+
+        std::shared_ptr<DataProvider> m_dataProvider;
+        mutable std::vector<CachedItem> m_dataProviderCache;
+        mutable std::unordered_map<std::size_t, std::size_t> m_dataProviderCacheLookup; // Maps row index to index in m_dataProviderCache
+        mutable std::size_t m_dataProviderCacheCapacity = 0;
+        mutable std::uint64_t m_dataProviderCacheUseCounter = 0;
+
+        std::size_t m_sortColumn = 0;
+        std::function<bool(const String&, const String&)> m_sortCompare;
+        std::function<bool(const std::vector<String>&)> m_filter;
+        std::vector<std::size_t> m_displayedItems; // Index of the item in each row, only used when sorted or filtered
+        std::vector<std::size_t> m_itemRows; // Row of each item (or the maximum value when hidden), only used when sorted or filtered
+        std::shared_ptr<SortFilterTask> m_sortFilterTask; // Can be shared with copies of the list view
+        bool m_sortFilterTaskNeeded = false;
 
         int m_hoveredItem = -1;
         int m_firstSelectedItemIndex = -1;
@@ -51,6 +51,14 @@ TGUI_MODULE_EXPORT namespace tgui
 
         static constexpr const char StaticWidgetType[] = "TextArea"; //!< Type name of the widget
 
+        /// @brief Describes a single change to the text, as passed to the onTextEdit signal
+        struct TextEdit
+        {
+            std::size_t offset;       //!< Index of the first character that was changed
+            std::size_t removedCount; //!< Amount of characters that were removed at the offset
+            StringView insertedText;  //!< Characters that were inserted at the offset (only valid while the signal handler executes)
+        };
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
@@ -122,6 +130,9 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /// @param text  Text that will be added to the text that is already in the text area
         ///
+        /// Only the last paragraph and the added text are word-wrapped, so this function remains fast when the text area
+        /// already contains a lot of text.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void addText(String text);
 
@@ -432,6 +443,13 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD std::size_t getIndexOfSelectionPos(Vector2<std::size_t> selectionPos) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gets the line and position on that line of the character at the given index. Positions on a word-wrap boundary
+        // are placed at the end of the upper line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Vector2<std::size_t> findSelectionPos(std::size_t index) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called when you are selecting text.
         // It will find out which part of the text is selected.
@@ -446,18 +464,45 @@ TGUI_MODULE_EXPORT namespace tgui
         void deleteSelectedCharacters();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces part of the text and places the caret at the given index. Only the paragraphs that were touched by the change
+        // are split into lines again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void replaceTextRange(std::size_t offset, std::size_t removedCount, const String& insertedText, std::size_t caretIndex);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Rearrange the text inside the text area (by using word wrap).
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rearrangeText(bool keepSelection);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width that is available for a line when word wrap is used.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getWordWrapWidth() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits the paragraphs between the start and end index into lines. A max line width of 0 disables word wrap.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void splitTextIntoLines(std::size_t startIndex, std::size_t endIndex, float maxLineWidth,
+                                std::vector<String>& lines, std::vector<std::size_t>& linesStartIndex) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the width of the longest line, which is only needed when there is a horizontal scrollbar.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculateMaxLineWidth();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbars and texts after the lines were changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTextLayout();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the physical size of the scrollbars, as well as the viewport size.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateScrollbars();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function will split the text into five pieces so that the text can be easily drawn.
+        // Updates the caret and the text objects after the selection or the text was changed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectionTexts();
 
@@ -549,7 +594,8 @@ TGUI_MODULE_EXPORT namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates the positions of the contents of the text area.
+        // Splits the text into five pieces so that the text can be easily drawn and recalculates their positions.
+        // Only the lines near the visible area are placed in the text objects.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculatePositions();
 
@@ -610,6 +656,7 @@ TGUI_MODULE_EXPORT namespace tgui
 
         SignalString onTextChange = {"TextChanged"};     //!< The text was changed. Optional parameter: new text
         Signal onSelectionChange = {"SelectionChanged"}; //!< Selected text changed
+        SignalTyped<const TextEdit&> onTextEdit = {"TextEdited"}; //!< Part of the text was changed. Optional parameter: characters that were removed and inserted
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -623,6 +670,13 @@ TGUI_MODULE_EXPORT namespace tgui
 
         std::vector<String> m_lines;
 
+        // Index in m_text at which each line from m_lines starts
+        std::vector<std::size_t> m_linesStartIndex;
+
+        // Which lines are currently placed in the text objects (only the lines near the visible area are added to them)
+        std::size_t m_displayedLinesStart = 0;
+        std::size_t m_displayedLinesEnd = 0;
+
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
 
@@ -46,7 +46,9 @@ namespace tgui
 
     BackendFont::BackendFont(const BackendFont& other) :
         m_isSmooth(other.m_isSmooth),
-        m_fontScale(other.m_fontScale)
+        m_fontScale(other.m_fontScale),
+        m_maxTexturePageSize(other.m_maxTexturePageSize),
+        m_cachedKerning(other.m_cachedKerning)
     {
         TGUI_ASSERT(isBackendSet(), "Backend must exist before creating a font");
         getBackend()->registerFont(this);
@@ -56,7 +58,9 @@ namespace tgui
 
     BackendFont::BackendFont(BackendFont&& other) noexcept :
         m_isSmooth(std::move(other.m_isSmooth)),
-        m_fontScale(std::move(other.m_fontScale))
+        m_fontScale(std::move(other.m_fontScale)),
+        m_maxTexturePageSize(std::move(other.m_maxTexturePageSize)),
+        m_cachedKerning(std::move(other.m_cachedKerning))
     {
         TGUI_ASSERT(isBackendSet(), "Backend must exist before creating a font");
         getBackend()->registerFont(this);
@@ -78,6 +82,8 @@ namespace tgui
         {
             m_isSmooth = other.m_isSmooth;
             m_fontScale = other.m_fontScale;
+            m_maxTexturePageSize = other.m_maxTexturePageSize;
+            m_cachedKerning = other.m_cachedKerning;
         }
 
         return *this;
@@ -91,6 +97,8 @@ namespace tgui
         {
             m_isSmooth = std::move(other.m_isSmooth);
             m_fontScale = std::move(other.m_fontScale);
+            m_maxTexturePageSize = std::move(other.m_maxTexturePageSize);
+            m_cachedKerning = std::move(other.m_cachedKerning);
         }
 
         return *this;
@@ -119,6 +127,56 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    unsigned int BackendFont::getTexturePageCount(unsigned int)
+    {
+        return 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> BackendFont::getTexturePage(unsigned int characterSize, unsigned int pageIndex)
+    {
+        if (pageIndex != 0)
+            return nullptr;
+
+        unsigned int textureVersion;
+        return getTexture(characterSize, textureVersion);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendFont::getTexturePageSize(unsigned int characterSize, unsigned int pageIndex)
+    {
+        if (pageIndex != 0)
+            return {};
+
+        return getTextureSize(characterSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<BackendFont::TexturePageStatistics> BackendFont::getTexturePageStatistics() const
+    {
+        return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFont::setMaximumTexturePageSize(unsigned int size)
+    {
+        TGUI_ASSERT(size > 0, "Maximum texture page size can't be 0");
+        m_maxTexturePageSize = size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int BackendFont::getMaximumTexturePageSize() const
+    {
+        return m_maxTexturePageSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::uint64_t BackendFont::constructGlyphKey(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
     {
         // Create a unique key for every character.
@@ -134,6 +192,37 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::uint64_t BackendFont::constructKerningKey(char32_t first, char32_t second, unsigned int characterSize, bool bold)
+    {
+        // Unicode code points only need 21 bits. Character sizes that don't fit in the remaining bits would have to be
+        // unrealistically large, in which case the kerning might be shared with a smaller size.
+        return (static_cast<std::uint64_t>(bold) << 63) // bit 64 = bold flag
+             | ((static_cast<std::uint64_t>(characterSize) & 0x1FFFFF) << 42) // bits 43-63 = character size
+             | ((static_cast<std::uint64_t>(first) & 0x1FFFFF) << 21) // bits 22-42 = first code point
+             | (static_cast<std::uint64_t>(second) & 0x1FFFFF); // bits 1-21 = second code point
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFont::findCachedKerning(std::uint64_t key, float& kerning) const
+    {
+        const auto it = m_cachedKerning.find(key);
+        if (it == m_cachedKerning.end())
+            return false;
+
+        kerning = it->second;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFont::cacheKerning(std::uint64_t key, float kerning)
+    {
+        m_cachedKerning[key] = kerning;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendFont::setSmooth(bool smooth)
     {
         m_isSmooth = smooth;
@@ -154,6 +243,9 @@ namespace tgui
             return;
 
         m_fontScale = scale;
+
+        // The kerning is rounded to pixels at the scaled size, so it has to be recalculated
+        m_cachedKerning.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
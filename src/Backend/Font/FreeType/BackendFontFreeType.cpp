@@ -48,6 +48,8 @@
 #endif
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <cstring>
     #include <cmath>
 #endif
 
@@ -74,37 +76,23 @@ namespace tgui
         m_cachedAscents.clear();
         m_cachedDescents.clear();
         m_glyphs.clear();
-        m_rows.clear();
-        m_pixels = nullptr;
-        m_texture = nullptr;
-        m_textureSize = 0;
-        m_textureVersion = 0;
-        m_nextRow = 3; // First 2 rows contain pixels for underlining
+        m_glyphIndices.clear();
+        m_cachedKerning.clear();
+        m_pages.clear();
+        ++m_textureVersion; // Texts using this font need to update their texture coordinates
 
         constexpr unsigned int initialTextureSize = 128;
-        m_pixels = MakeUniqueForOverwrite<std::uint8_t[]>(initialTextureSize * initialTextureSize * 4);
-
-        std::uint8_t* pixelPtr = m_pixels.get();
-        for (unsigned int y = 0; y < initialTextureSize; ++y)
-        {
-            for (unsigned int x = 0; x < initialTextureSize; ++x)
-            {
-                // Color is always white, alpha channel contains whether the pixel is empty of not
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 0;
-            }
-        }
+        addTexturePage(initialTextureSize);
 
         // Reserve a 2x2 white square in the top left corner of the texture that we can use for drawing an underline
+        TexturePage& firstPage = m_pages.front();
         for (unsigned int y = 0; y < 2; ++y)
         {
             for (unsigned int x = 0; x < 2; ++x)
-                m_pixels[((initialTextureSize * y) + x) * 4 + 3] = 255;
+                firstPage.pixels[(initialTextureSize * y) + x] = 255;
         }
 
-        m_textureSize = initialTextureSize;
+        firstPage.nextRow = 3; // First 2 rows contain pixels for underlining
 
         // Initialize the freetype library each time, since we currently don't reuse the library object between fonts.
         FT_Library library;
@@ -153,6 +141,7 @@ namespace tgui
         glyph.bounds.setPosition(internalGlyph.bounds.getPosition() / m_fontScale);
         glyph.bounds.setSize(internalGlyph.bounds.getSize() / m_fontScale);
         glyph.textureRect = internalGlyph.textureRect;
+        glyph.texturePage = internalGlyph.texturePage;
         return glyph;
     }
 
@@ -164,7 +153,24 @@ namespace tgui
         if ((first == 0) || (second == 0))
             return 0;
 
-        if (!m_face || !setCurrentSize(characterSize))
+        if (!m_face)
+            return 0;
+
+        const std::uint64_t kerningKey = constructKerningKey(first, second, characterSize, bold);
+        float kerning;
+        if (findCachedKerning(kerningKey, kerning))
+            return kerning;
+
+        kerning = calculateKerning(first, second, characterSize, bold);
+        cacheKerning(kerningKey, kerning);
+        return kerning;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontFreetype::calculateKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold)
+    {
+        if (!setCurrentSize(characterSize))
             return 0;
 
         // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
@@ -175,11 +181,7 @@ namespace tgui
         FT_Vector kerning;
         kerning.x = kerning.y = 0;
         if (FT_HAS_KERNING(m_face))
-        {
-            const FT_UInt index1 = FT_Get_Char_Index(m_face, static_cast<FT_ULong>(first));
-            const FT_UInt index2 = FT_Get_Char_Index(m_face, static_cast<FT_ULong>(second));
-            FT_Get_Kerning(m_face, index1, index2, FT_KERNING_UNFITTED, &kerning);
-        }
+            FT_Get_Kerning(m_face, getGlyphIndex(first), getGlyphIndex(second), FT_KERNING_UNFITTED, &kerning);
 
         // X advance is already in pixels for bitmap fonts
         if (!FT_IS_SCALABLE(m_face))
@@ -309,24 +311,71 @@ namespace tgui
 
     std::shared_ptr<BackendTexture> BackendFontFreetype::getTexture(unsigned int, unsigned int& textureVersion)
     {
-        if (m_texture)
-        {
-            textureVersion = m_textureVersion;
-            return m_texture;
-        }
+        updateTexturePages();
 
-        m_texture = getBackend()->getRenderer()->createTexture();
-        m_texture->loadTextureOnly({m_textureSize, m_textureSize}, m_pixels.get(), m_isSmooth);
+        textureVersion = m_textureVersion;
+        if (m_pages.empty())
+            return nullptr;
 
-        textureVersion = ++m_textureVersion;
-        return m_texture;
+        return m_pages.front().texture;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Vector2u BackendFontFreetype::getTextureSize(unsigned int)
     {
-        return {m_textureSize, m_textureSize};
+        if (m_pages.empty())
+            return {};
+
+        return {m_pages.front().size, m_pages.front().size};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int BackendFontFreetype::getTexturePageCount(unsigned int)
+    {
+        return static_cast<unsigned int>(m_pages.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> BackendFontFreetype::getTexturePage(unsigned int, unsigned int pageIndex)
+    {
+        if (pageIndex >= m_pages.size())
+            return nullptr;
+
+        updateTexturePages();
+        return m_pages[pageIndex].texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendFontFreetype::getTexturePageSize(unsigned int, unsigned int pageIndex)
+    {
+        if (pageIndex >= m_pages.size())
+            return {};
+
+        return {m_pages[pageIndex].size, m_pages[pageIndex].size};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<BackendFont::TexturePageStatistics> BackendFontFreetype::getTexturePageStatistics() const
+    {
+        std::vector<TexturePageStatistics> statistics;
+        statistics.reserve(m_pages.size());
+        for (const auto& page : m_pages)
+        {
+            TexturePageStatistics pageStats;
+            pageStats.size = {page.size, page.size};
+            pageStats.glyphCount = page.glyphCount;
+            pageStats.usedPixels = page.usedPixels;
+            pageStats.memoryUsage = static_cast<std::size_t>(page.size) * page.size; // One byte per pixel
+            pageStats.fillRatio = static_cast<float>(page.usedPixels) / (static_cast<float>(page.size) * static_cast<float>(page.size));
+            statistics.push_back(pageStats);
+        }
+
+        return statistics;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -334,8 +383,11 @@ namespace tgui
     void BackendFontFreetype::setSmooth(bool smooth)
     {
         BackendFont::setSmooth(smooth);
-        if (m_texture)
-            m_texture->setSmooth(m_isSmooth);
+        for (auto& page : m_pages)
+        {
+            if (page.texture)
+                page.texture->setSmooth(m_isSmooth);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -347,8 +399,8 @@ namespace tgui
 
         BackendFont::setFontScale(scale);
 
-        // Destroy the texture to force texts to update their glyphs
-        m_texture = nullptr;
+        // Increment the texture version to force texts to update their glyphs
+        ++m_textureVersion;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -442,13 +494,23 @@ namespace tgui
         // Find a good position for the new glyph into the texture.
         // We leave a small padding around characters, so that filtering doesn't pollute them with pixels from neighbors.
         const unsigned int padding = 2;
-        glyph.textureRect = findAvailableGlyphRect(bitmap.width + (2 * padding), bitmap.rows + (2 * padding));
+        glyph.textureRect = findAvailableGlyphRect(bitmap.width + (2 * padding), bitmap.rows + (2 * padding), glyph.texturePage);
+        if ((glyph.textureRect.width == 0) || (glyph.textureRect.height == 0))
+        {
+            // The glyph is too large to be stored in a texture, so it will only be drawn as empty space
+            glyph.bounds = {};
+            FT_Done_Glyph(glyphDesc);
+            return glyph;
+        }
+
+        const UIntRect paddedRect = glyph.textureRect;
         glyph.textureRect.left += padding;
         glyph.textureRect.top += padding;
         glyph.textureRect.width -= 2 * padding;
         glyph.textureRect.height -= 2 * padding;
 
         // Extract the glyph's pixels from the bitmap
+        TexturePage& page = m_pages[glyph.texturePage];
         const std::uint8_t* glyphBitmapPixels = bitmap.buffer;
         if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
         {
@@ -457,9 +519,8 @@ namespace tgui
             {
                 for (unsigned int x = 0; x < bitmap.width; ++x)
                 {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * m_textureSize;
-                    m_pixels[index * 4 + 3] = ((glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x / 8)]) & (1 << (7 - (x % 8)))) ? 255 : 0;
+                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * page.size;
+                    page.pixels[index] = ((glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x / 8)]) & (1 << (7 - (x % 8)))) ? 255 : 0;
                 }
             }
         }
@@ -470,15 +531,14 @@ namespace tgui
             {
                 for (unsigned int x = 0; x < bitmap.width; ++x)
                 {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * m_textureSize;
-                    m_pixels[index * 4 + 3] = glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x)];
+                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * page.size;
+                    page.pixels[index] = glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x)];
                 }
             }
         }
 
-        // We will have to recreate the texture now that the pixels changed
-        m_texture = nullptr;
+        // Only the part of the texture that contains the new glyph will have to be updated
+        addDirtyRect(glyph.texturePage, paddedRect);
 
         FT_Done_Glyph(glyphDesc);
         return glyph;
@@ -486,6 +546,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    unsigned int BackendFontFreetype::getGlyphIndex(char32_t codePoint)
+    {
+        const auto it = m_glyphIndices.find(codePoint);
+        if (it != m_glyphIndices.end())
+            return it->second;
+
+        const unsigned int glyphIndex = FT_Get_Char_Index(m_face, static_cast<FT_ULong>(codePoint));
+        m_glyphIndices[codePoint] = glyphIndex;
+        return glyphIndex;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     BackendFontFreetype::Glyph BackendFontFreetype::getInternalGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
     {
         const std::uint64_t glyphKey = constructGlyphKey(codePoint, static_cast<unsigned int>(characterSize * m_fontScale),
@@ -501,77 +574,92 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    UIntRect BackendFontFreetype::findAvailableGlyphRect(unsigned int width, unsigned int height)
+    UIntRect BackendFontFreetype::findAvailableGlyphRect(unsigned int width, unsigned int height, unsigned int& pageIndex)
     {
         // Find the line that where the glyph fits well.
         // This is based on the sf::Font class in the SFML library. It might not be the most optimal method, but it is good enough for now.
         Row* bestRow = nullptr;
         float bestRatio = 0;
-        for (auto& row : m_rows)
+        for (unsigned int i = 0; i < m_pages.size(); ++i)
         {
-            float ratio = static_cast<float>(height) / row.height;
+            for (auto& row : m_pages[i].rows)
+            {
+                float ratio = static_cast<float>(height) / row.height;
 
-            // Ignore rows that are either too small or too high
-            if ((ratio < 0.7f) || (ratio > 1.f))
-                continue;
+                // Ignore rows that are either too small or too high
+                if ((ratio < 0.7f) || (ratio > 1.f))
+                    continue;
 
-            // Check if there's enough horizontal space left in the row
-            if (width > m_textureSize - row.width)
-                continue;
+                // Check if there's enough horizontal space left in the row
+                if (width > m_pages[i].size - row.width)
+                    continue;
 
-            // Make sure that this new row is the best found so far
-            if (ratio < bestRatio)
-                continue;
+                // Make sure that this new row is the best found so far
+                if (ratio < bestRatio)
+                    continue;
 
-            // The current row passed all the tests: we can select it
-            bestRow = &row;
-            bestRatio = ratio;
+                // The current row passed all the tests: we can select it
+                bestRow = &row;
+                bestRatio = ratio;
+                pageIndex = i;
+            }
         }
 
         // If we didn't find a matching row, create a new one (10% taller than the glyph)
         if (!bestRow)
         {
-            // Check if the glyph can fit in the texture and resize the texture otherwise
+            // Pages can never become larger than what the renderer supports. When there is no renderer to query,
+            // we assume a limit that is supported by most graphics cards.
+            unsigned int maxTextureSize = 8192;
+            if (isBackendSet() && getBackend()->getRenderer())
+                maxTextureSize = getBackend()->getRenderer()->getMaximumTextureSize();
+
+            const unsigned int maxPageSize = std::min(m_maxTexturePageSize, maxTextureSize);
+
+            // Look for a page that still has room for a new row. Pages that are smaller than the maximum size are
+            // allowed to grow, pages that are full are left alone instead of copying all their pixels into a larger texture.
             const unsigned int rowHeight = height + (height / 10);
-            while ((m_nextRow + rowHeight >= m_textureSize) || (width >= m_textureSize))
+            bool pageFound = false;
+            for (unsigned int i = 0; i < m_pages.size(); ++i)
             {
-                /// TODO: Check if maximum texture size is reached and use multiple textures if there isn't enough space left
-
-                // Copy existing pixels to the top left quadrant
-                auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>((m_textureSize * 2) * (m_textureSize * 2) * 4);
-                for (unsigned int y = 0; y < m_textureSize; ++y)
-                    std::memcpy(&pixels[y * (2 * m_textureSize) * 4], &m_pixels[y * m_textureSize * 4], m_textureSize * 4);
+                while (((m_pages[i].nextRow + rowHeight >= m_pages[i].size) || (width >= m_pages[i].size))
+                    && (m_pages[i].size * 2 <= maxPageSize))
+                {
+                    growTexturePage(i);
+                }
 
-                // Top right quadrant and bottom halves are filled with empty values
-                // Color is always white, alpha channel contains whether the pixel is empty of not
-                for (unsigned int y = 0; y < m_textureSize; ++y)
+                if ((m_pages[i].nextRow + rowHeight < m_pages[i].size) && (width < m_pages[i].size))
                 {
-                    std::uint8_t* pixelPtr = &pixels[((y * (2 * m_textureSize)) + m_textureSize) * 4];
-                    for (unsigned int i = 0; i < m_textureSize; ++i)
-                    {
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 0;
-                    }
+                    pageIndex = i;
+                    pageFound = true;
+                    break;
                 }
-                std::uint8_t* pixelPtr = &pixels[m_textureSize * (2 * m_textureSize) * 4];
-                for (unsigned int i = 0; i < (2 * m_textureSize) * m_textureSize; ++i)
+            }
+
+            // If none of the existing pages has enough space left then we add a new page
+            if (!pageFound)
+            {
+                // If the glyph is too large to fit in a page of the maximum size then we create a larger page for it
+                unsigned int pageSize = maxPageSize;
+                while (((rowHeight >= pageSize) || (width >= pageSize)) && (pageSize <= maxTextureSize / 2))
+                    pageSize *= 2;
+
+                if ((rowHeight >= pageSize) || (width >= pageSize))
                 {
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 0;
+                    TGUI_PRINT_WARNING("glyph of " + String(width) + "x" + String(height)
+                        + " pixels doesn't fit in the maximum texture size of " + String(maxTextureSize) + " pixels");
+                    return {};
                 }
 
-                m_pixels = std::move(pixels);
-                m_textureSize *= 2;
+                addTexturePage(pageSize);
+                pageIndex = static_cast<unsigned int>(m_pages.size() - 1);
             }
 
             // We can now create the new row
-            m_rows.emplace_back(m_nextRow, rowHeight);
-            m_nextRow += rowHeight;
-            bestRow = &m_rows.back();
+            TexturePage& page = m_pages[pageIndex];
+            page.rows.emplace_back(page.nextRow, rowHeight);
+            page.nextRow += rowHeight;
+            bestRow = &page.rows.back();
         }
 
         // Find the glyph's rectangle on the selected row
@@ -579,11 +667,120 @@ namespace tgui
 
         // Update the row informations
         bestRow->width += width;
+
+        TexturePage& page = m_pages[pageIndex];
+        ++page.glyphCount;
+        page.usedPixels += static_cast<std::size_t>(width) * height;
         return rect;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendFontFreetype::addTexturePage(unsigned int size)
+    {
+        TexturePage page;
+        page.size = size;
+        page.pixels = MakeUniqueForOverwrite<std::uint8_t[]>(static_cast<std::size_t>(size) * size);
+        std::memset(page.pixels.get(), 0, static_cast<std::size_t>(size) * size);
+        m_pages.push_back(std::move(page));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::growTexturePage(unsigned int pageIndex)
+    {
+        TexturePage& page = m_pages[pageIndex];
+        const unsigned int oldSize = page.size;
+        const unsigned int newSize = oldSize * 2;
+
+        // Copy existing pixels to the top left quadrant, all other pixels are empty
+        auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(static_cast<std::size_t>(newSize) * newSize);
+        for (unsigned int y = 0; y < oldSize; ++y)
+        {
+            std::memcpy(&pixels[static_cast<std::size_t>(y) * newSize], &page.pixels[static_cast<std::size_t>(y) * oldSize], oldSize);
+            std::memset(&pixels[static_cast<std::size_t>(y) * newSize + oldSize], 0, newSize - oldSize);
+        }
+        std::memset(&pixels[static_cast<std::size_t>(oldSize) * newSize], 0, static_cast<std::size_t>(newSize) * (newSize - oldSize));
+
+        page.pixels = std::move(pixels);
+        page.size = newSize;
+        page.needsUpload = true;
+        page.dirtyRects.clear();
+
+        // The texture coordinates of all glyphs in the page change when the page is resized
+        ++m_textureVersion;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::addDirtyRect(unsigned int pageIndex, const UIntRect& rect)
+    {
+        TexturePage& page = m_pages[pageIndex];
+        if (page.needsUpload)
+            return; // The entire texture is already going to be updated
+
+        // Glyphs are placed next to each other in a row, so they can usually be merged with the previous glyph.
+        // All glyphs in a row have the same top position.
+        if (!page.dirtyRects.empty())
+        {
+            UIntRect& lastRect = page.dirtyRects.back();
+            if ((lastRect.top == rect.top) && (lastRect.left + lastRect.width == rect.left))
+            {
+                lastRect.width += rect.width;
+                lastRect.height = std::max(lastRect.height, rect.height);
+                return;
+            }
+        }
+
+        page.dirtyRects.push_back(rect);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::updateTexturePages()
+    {
+        std::vector<std::uint8_t> regionPixels;
+        for (auto& page : m_pages)
+        {
+            if (!page.texture)
+            {
+                page.texture = getBackend()->getRenderer()->createTexture();
+                page.needsUpload = true;
+            }
+
+            if (!page.needsUpload)
+            {
+                for (const auto& rect : page.dirtyRects)
+                {
+                    regionPixels.resize(static_cast<std::size_t>(rect.width) * rect.height);
+                    for (unsigned int y = 0; y < rect.height; ++y)
+                    {
+                        std::memcpy(&regionPixels[static_cast<std::size_t>(y) * rect.width],
+                                    &page.pixels[(static_cast<std::size_t>(rect.top) + y) * page.size + rect.left], rect.width);
+                    }
+
+                    // If the texture can't be partially updated then we have to upload the entire texture instead
+                    if (!page.texture->updateAlphaTextureRegion(rect, regionPixels.data()))
+                    {
+                        page.needsUpload = true;
+                        break;
+                    }
+                }
+
+                page.dirtyRects.clear();
+            }
+
+            if (page.needsUpload)
+            {
+                page.texture->loadAlphaTextureOnly({page.size, page.size}, page.pixels.get(), m_isSmooth);
+                page.needsUpload = false;
+                page.dirtyRects.clear();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool BackendFontFreetype::setCurrentSize(unsigned int characterSize)
     {
         unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
@@ -29,6 +29,7 @@
 
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <array>
     #include <cmath>
 
@@ -175,6 +176,52 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    static void recordVertexArray(BackendRenderTarget::RenderCache& cache, const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
+                                  const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
+    {
+        // Nothing is drawn when an empty index array is passed
+        if (indices && (indexCount == 0))
+            return;
+
+        BackendRenderTarget::RenderCache::Command command;
+        command.type = BackendRenderTarget::RenderCache::CommandType::DrawVertices;
+        command.transform = states.transform;
+        command.firstVertex = cache.vertices.size();
+        command.vertexCount = vertexCount;
+        command.firstIndex = cache.indices.size();
+        command.indexCount = indices ? indexCount : 0;
+        command.texture = texture;
+        cache.commands.push_back(std::move(command));
+
+        cache.vertices.insert(cache.vertices.end(), vertices, vertices + vertexCount);
+        if (indices)
+            cache.indices.insert(cache.indices.end(), indices, indices + indexCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TGUI_NODISCARD static bool isRenderCacheUpToDate(const BackendRenderTarget::RenderCache& cache, const Transform& transform, const FloatRect& clipRect)
+    {
+        // The recorded draw calls are only valid at the same location, both because they contain the transformation
+        // and because child widgets that lay outside the clipping area were skipped while recording.
+        if (!cache.valid || (cache.clipRect != clipRect) || (cache.transform.getMatrix() != transform.getMatrix()))
+            return false;
+
+        if (cache.containsSvgSprites && (cache.svgTextureVersion != getBackend()->getSvgTextureVersion()))
+            return false;
+
+        for (const auto& fontTexture : cache.fontTextures)
+        {
+            unsigned int textureVersion;
+            if (!fontTexture.font->getTexture(fontTexture.characterSize, textureVersion) || (textureVersion != fontTexture.textureVersion))
+                return false;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTarget::setView(FloatRect view, FloatRect viewport, Vector2f targetSize)
     {
         TGUI_ASSERT(m_clipLayers.empty(), "You can't change the view of the render target during drawing");
@@ -189,17 +236,80 @@ namespace tgui
     void BackendRenderTarget::drawWidget(const RenderStates& states, const std::shared_ptr<Widget>& widget)
     {
         // If the widget lies outside of the clip rect then we can skip drawing it
-        const FloatRect& clipRect = m_clipLayers.empty() ? m_viewRect : m_clipLayers.back().first;
+        const FloatRect clipRect = m_clipLayers.empty() ? m_viewRect : m_clipLayers.back().first;
         const FloatRect& widgetRect = states.transform.transformRect({widget->getWidgetOffset(), widget->getFullSize()});
         if ((widgetRect.left > clipRect.left + clipRect.width) || (widgetRect.top > clipRect.top + clipRect.height)
          || (widgetRect.left + widgetRect.width < clipRect.left) || (widgetRect.top + widgetRect.height < clipRect.top))
             return;
 
+        // Remember where the widget is located, so that the area can be redrawn when the widget changes or gets removed
+        widget->setLastDrawnArea(widgetRect);
+
         // Round widget positions to the nearest pixel
         RenderStates statesWithRoundedPos = states;
         statesWithRoundedPos.transform.roundPosition(m_pixelsPerPoint.x, m_pixelsPerPoint.y);
 
+        RenderCache* cache = widget->getRenderCache();
+        if (!cache)
+        {
+            Widget* const parentWidget = m_drawnWidget;
+            m_drawnWidget = widget.get();
+            widget->draw(*this, statesWithRoundedPos);
+            m_drawnWidget = parentWidget;
+            return;
+        }
+
+        if (isRenderCacheUpToDate(*cache, statesWithRoundedPos.transform, clipRect))
+        {
+            ++m_frameStatistics.cachedWidgets;
+
+            // Repeating the draw calls also records them in the caches of the parents that are being recorded
+            for (const auto& command : cache->commands)
+            {
+                RenderStates commandStates;
+                commandStates.transform = command.transform;
+
+                if (command.type == RenderCache::CommandType::DrawVertices)
+                {
+                    drawVertexArray(commandStates, &cache->vertices[command.firstVertex], command.vertexCount,
+                                    (command.indexCount > 0) ? &cache->indices[command.firstIndex] : nullptr, command.indexCount, command.texture);
+                }
+                else if (command.type == RenderCache::CommandType::AddClippingLayer)
+                    addClippingLayer(commandStates, command.clipRect);
+                else
+                    removeClippingLayer();
+            }
+
+            for (auto* recordingCache : m_recordingCaches)
+            {
+                recordingCache->fontTextures.insert(recordingCache->fontTextures.end(), cache->fontTextures.begin(), cache->fontTextures.end());
+                if (cache->containsSvgSprites)
+                {
+                    recordingCache->containsSvgSprites = true;
+                    recordingCache->svgTextureVersion = cache->svgTextureVersion;
+                }
+            }
+
+            return;
+        }
+
+        // Record the draw calls while drawing the widget. The cache is marked as valid before drawing, so that a change to
+        // the widget while it is being drawn would still cause it to be recorded again in the next frame.
+        cache->valid = true;
+        cache->transform = statesWithRoundedPos.transform;
+        cache->clipRect = clipRect;
+        cache->commands.clear();
+        cache->vertices.clear();
+        cache->indices.clear();
+        cache->fontTextures.clear();
+        cache->containsSvgSprites = false;
+
+        Widget* const parentWidget = m_drawnWidget;
+        m_drawnWidget = widget.get();
+        m_recordingCaches.push_back(cache);
         widget->draw(*this, statesWithRoundedPos);
+        m_recordingCaches.pop_back();
+        m_drawnWidget = parentWidget;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -208,6 +318,15 @@ namespace tgui
     {
         TGUI_ASSERT(m_targetSize.x > 0 && m_targetSize.y > 0, "Target size must be valid in BackendRenderTarget::addClippingLayer");
 
+        for (auto* cache : m_recordingCaches)
+        {
+            RenderCache::Command command;
+            command.type = RenderCache::CommandType::AddClippingLayer;
+            command.transform = states.transform;
+            command.clipRect = rect;
+            cache->commands.push_back(std::move(command));
+        }
+
         /// TODO: We currently can't clip rotated objects (except for 90°, 180° or 270° rotations)
         const std::array<float, 16>& transformMatrix = states.transform.getMatrix();
         if (((std::abs(transformMatrix[1]) > 0.00001f) || (std::abs(transformMatrix[4]) > 0.00001f)) // 0° or 180°
@@ -228,6 +347,8 @@ namespace tgui
         const float clipRight = std::min(transformedRect.left + transformedRect.width, oldClipRect.left + oldClipRect.width);
         const float clipBottom = std::min(transformedRect.top + transformedRect.height, oldClipRect.top + oldClipRect.height);
 
+        flushBatch();
+
         if ((clipRight - clipLeft > 0) && (clipBottom - clipTop > 0))
         {
             const FloatRect clipRect = {clipLeft, clipTop, clipRight - clipLeft, clipBottom - clipTop};
@@ -253,6 +374,15 @@ namespace tgui
     {
         TGUI_ASSERT(!m_clipLayers.empty(), "BackendRenderTarget::removeClippingLayer can't remove layer if there are none left");
 
+        for (auto* cache : m_recordingCaches)
+        {
+            RenderCache::Command command;
+            command.type = RenderCache::CommandType::RemoveClippingLayer;
+            cache->commands.push_back(std::move(command));
+        }
+
+        flushBatch();
+
         m_clipLayers.pop_back();
         if (m_clipLayers.empty())
             updateClipping(m_viewRect, m_viewport);
@@ -262,6 +392,189 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendRenderTarget::setBatchingEnabled(bool enabled)
+    {
+        if (!enabled)
+            flushBatch();
+
+        m_batchingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTarget::isBatchingEnabled() const
+    {
+        return m_batchingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTarget::isPartialRedrawSupported() const
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::setRedrawAreas(std::vector<FloatRect> areas)
+    {
+        m_redrawAreas = std::move(areas);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::resetRedrawAreas()
+    {
+        m_redrawAreas.reset();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::invalidateWidgetsWithPendingSvgSprites()
+    {
+        // The list is moved first, as the widgets are added to it again when they get drawn
+        const std::vector<std::weak_ptr<Widget>> widgets = std::move(m_widgetsWithPendingSvgSprites);
+        m_widgetsWithPendingSvgSprites.clear();
+
+        for (const auto& weakWidget : widgets)
+        {
+            if (const auto widget = weakWidget.lock())
+                widget->invalidateRenderCache();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::setRedrawAreasOverlayEnabled(bool enabled)
+    {
+        m_redrawAreasOverlayEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTarget::isRedrawAreasOverlayEnabled() const
+    {
+        return m_redrawAreasOverlayEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendRenderTarget::FrameStatistics BackendRenderTarget::getFrameStatistics() const
+    {
+        return m_lastFrameStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::beginFrame()
+    {
+        m_frameStatistics = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::endFrame()
+    {
+        flushBatch();
+
+        // Don't keep the last texture of the frame alive, but keep the capacity of the vertex buffers for the next frame
+        m_batchTexture = nullptr;
+        m_lastFrameStatistics = m_frameStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::drawRedrawAreasOverlay(const std::vector<FloatRect>& areas)
+    {
+        for (const auto& area : areas)
+        {
+            RenderStates states;
+            states.transform.translate(area.getPosition());
+            drawFilledRect(states, area.getSize(), Color{255, 0, 0, 50});
+            drawBorders(states, {1}, area.getSize(), Color{255, 0, 0, 200});
+        }
+
+        flushBatch();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTarget::batchVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
+                                               const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
+    {
+        if (!m_flushingBatch && (vertexCount > 0))
+        {
+            for (auto* cache : m_recordingCaches)
+                recordVertexArray(*cache, states, vertices, vertexCount, indices, indexCount, texture);
+        }
+
+        if (!m_batchingEnabled || m_flushingBatch)
+        {
+            ++m_frameStatistics.drawCalls;
+            m_frameStatistics.uploadedVertices += vertexCount;
+            return false;
+        }
+
+        if (vertexCount == 0)
+            return true;
+
+        // Vertices with a different texture can't be drawn in the same draw call
+        if (!m_batchVertices.empty() && (m_batchTexture != texture))
+            flushBatch();
+
+        if (m_batchVertices.empty())
+            m_batchTexture = texture;
+        else
+            ++m_frameStatistics.mergedDrawCalls;
+
+        const auto indexOffset = static_cast<unsigned int>(m_batchVertices.size());
+        m_batchVertices.resize(m_batchVertices.size() + vertexCount);
+        states.transform.transformPoints(vertices, &m_batchVertices[indexOffset], vertexCount);
+
+        if (indices)
+        {
+            for (std::size_t i = 0; i < indexCount; ++i)
+                m_batchIndices.push_back(indexOffset + indices[i]);
+        }
+        else // No indices were given, all vertices are drawn in the order they were provided
+        {
+            for (std::size_t i = 0; i < vertexCount; ++i)
+                m_batchIndices.push_back(indexOffset + static_cast<unsigned int>(i));
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::flushBatch()
+    {
+        if (m_batchVertices.empty())
+            return;
+
+        // The vertices were already transformed when they were added to the batch
+        m_flushingBatch = true;
+        drawVertexArray({}, m_batchVertices.data(), m_batchVertices.size(), m_batchIndices.data(), m_batchIndices.size(), m_batchTexture);
+        m_flushingBatch = false;
+
+        m_batchVertices.clear();
+        m_batchIndices.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Vertex* BackendRenderTarget::transformVertices(const Transform& transform, const Vertex* vertices, std::size_t vertexCount)
+    {
+        // The buffer only grows, so after the first few frames no more memory has to be allocated
+        if (m_transformedVertices.size() < vertexCount)
+            m_transformedVertices.resize(vertexCount);
+
+        transform.transformPoints(vertices, m_transformedVertices.data(), vertexCount);
+        return m_transformedVertices.data();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTarget::drawBorders(const RenderStates& states, const Borders& borders, Vector2f size, Color color)
     {
         //////////////////////
@@ -341,7 +654,28 @@ namespace tgui
 
         std::shared_ptr<BackendTexture> backendTexture;
         if (sprite.getTexture().getData()->svgImage)
+        {
             backendTexture = sprite.getSvgTexture();
+
+            // The widget has to be redrawn when the image has been rasterized at the requested size
+            if (sprite.isSvgRasterizationPending() && m_drawnWidget)
+            {
+                const auto widgetIt = std::find_if(m_widgetsWithPendingSvgSprites.begin(), m_widgetsWithPendingSvgSprites.end(),
+                    [this](const std::weak_ptr<Widget>& widget){ return widget.lock().get() == m_drawnWidget; });
+                if (widgetIt == m_widgetsWithPendingSvgSprites.end())
+                    m_widgetsWithPendingSvgSprites.push_back(m_drawnWidget->shared_from_this());
+            }
+
+            if (!m_recordingCaches.empty())
+            {
+                const unsigned int svgTextureVersion = getBackend()->getSvgTextureVersion();
+                for (auto* cache : m_recordingCaches)
+                {
+                    cache->containsSvgSprites = true;
+                    cache->svgTextureVersion = svgTextureVersion;
+                }
+            }
+        }
         else
             backendTexture = sprite.getTexture().getData()->backendTexture;
 
@@ -363,7 +697,21 @@ namespace tgui
         // Round the text to the nearest pixel to try to avoid blurry text
         transformedStates.transform.roundPosition(m_pixelsPerPoint.x, m_pixelsPerPoint.y);
 
-        auto vertexData = text.getBackendText()->getVertexData();
+        const std::shared_ptr<BackendText> backendText = text.getBackendText();
+        auto vertexData = backendText->getVertexData();
+
+        // A cached text has to be drawn again when the texture coordinates of the glyphs change
+        if (!m_recordingCaches.empty() && !vertexData.empty())
+        {
+            RenderCache::FontTexture fontTexture;
+            fontTexture.font = backendText->getFont();
+            fontTexture.characterSize = backendText->getCharacterSize();
+            if (fontTexture.font && fontTexture.font->getTexture(fontTexture.characterSize, fontTexture.textureVersion))
+            {
+                for (auto* cache : m_recordingCaches)
+                    cache->fontTextures.push_back(fontTexture);
+            }
+        }
 
         for (const auto& data : vertexData)
         {
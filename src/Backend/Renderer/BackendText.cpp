@@ -52,6 +52,7 @@ namespace tgui
 
         m_string = string;
         m_verticesNeedUpdate = true;
+        m_characterPositionsNeedUpdate = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -70,6 +71,7 @@ namespace tgui
 
         m_characterSize = characterSize;
         m_verticesNeedUpdate = true;
+        m_characterPositionsNeedUpdate = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -93,10 +95,13 @@ namespace tgui
         if (m_verticesNeedUpdate)
             return;
 
-        TGUI_ASSERT(m_vertices != nullptr, "m_vertices should have already been created if m_verticesNeedUpdate is false");
+        TGUI_ASSERT(!m_vertices.empty(), "m_vertices should have already been created if m_verticesNeedUpdate is false");
         const Vertex::Color vertexColor(color);
-        for (std::size_t i = 0; i < m_vertices->size(); ++i)
-            (*m_vertices)[i].color = vertexColor;
+        for (auto& pageVertices : m_vertices)
+        {
+            for (auto& vertex : *pageVertices)
+                vertex.color = vertexColor;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -120,11 +125,11 @@ namespace tgui
         if (m_verticesNeedUpdate)
             return;
 
-        if (m_outlineVertices)
+        const Vertex::Color vertexColor(color);
+        for (auto& pageVertices : m_outlineVertices)
         {
-            const Vertex::Color vertexColor(color);
-            for (std::size_t i = 0; i < m_outlineVertices->size(); ++i)
-                (*m_outlineVertices)[i].color = vertexColor;
+            for (auto& vertex : *pageVertices)
+                vertex.color = vertexColor;
         }
     }
 
@@ -162,6 +167,7 @@ namespace tgui
 
         m_style = style;
         m_verticesNeedUpdate = true;
+        m_characterPositionsNeedUpdate = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -180,6 +186,7 @@ namespace tgui
 
         m_font = font;
         m_verticesNeedUpdate = true;
+        m_characterPositionsNeedUpdate = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -199,19 +206,40 @@ namespace tgui
         if (index > m_string.length())
             index = m_string.length();
 
+        // The positions of all characters are calculated at once, so that the string doesn't need to be iterated
+        // each time the position of a character is requested.
+        if (m_characterPositionsNeedUpdate || (m_characterPositionsFontScale != m_font->getFontScale()))
+            updateCharacterPositions();
+
+        return m_characterPositions[index];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendText::updateCharacterPositions() const
+    {
+        m_characterPositionsNeedUpdate = false;
+        m_characterPositionsFontScale = m_font->getFontScale();
+
+        m_characterPositions.resize(m_string.length() + 1);
+        m_characterPositions[0] = {0, 0};
+
         const bool isBold           = static_cast<unsigned int>(m_style) & TextStyle::Bold;
         const float whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
         const float lineSpacing     = m_font->getLineSpacing(m_characterSize);
 
         Vector2f position;
         char32_t prevChar = 0;
-        for (std::size_t i = 0; i < index; ++i)
+        for (std::size_t i = 0; i < m_string.length(); ++i)
         {
             const char32_t curChar = m_string[i];
 
             // Skip the carriage return character as we will pretend it isn't there
             if (curChar == U'\r')
+            {
+                m_characterPositions[i + 1] = position;
                 continue;
+            }
 
             // Apply the kerning offset
             position.x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
@@ -220,16 +248,16 @@ namespace tgui
             // Handle special characters
             switch (curChar)
             {
-                case ' ':  position.x += whitespaceWidth;             continue;
-                case '\t': position.x += whitespaceWidth * 4;         continue;
-                case '\n': position.y += lineSpacing; position.x = 0; continue;
+                case ' ':  position.x += whitespaceWidth;             break;
+                case '\t': position.x += whitespaceWidth * 4;         break;
+                case '\n': position.y += lineSpacing; position.x = 0; break;
+                default: // For regular characters, add the advance offset of the glyph
+                    position.x += m_font->getGlyph(curChar, m_characterSize, isBold).advance;
+                    break;
             }
 
-            // For regular characters, add the advance offset of the glyph
-            position.x += m_font->getGlyph(curChar, m_characterSize, isBold).advance;
+            m_characterPositions[i + 1] = position;
         }
-
-        return position;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -248,7 +276,10 @@ namespace tgui
 
         // If the font texture changes then we need to update the texture coordinates
         if (textureVersion != m_lastFontTextureVersion)
+        {
             m_verticesNeedUpdate = true;
+            m_characterPositionsNeedUpdate = true;
+        }
 
         if (m_verticesNeedUpdate)
         {
@@ -258,11 +289,19 @@ namespace tgui
             texture = m_font->getTexture(m_characterSize, m_lastFontTextureVersion);
         }
 
-        if (m_outlineVertices && !m_outlineVertices->empty())
-            data.emplace_back(texture, m_outlineVertices);
+        // Glyphs can be spread over multiple font textures, the first texture also contains the pixels for underlining.
+        // All outlines are drawn first, so that they never overlap with the filled glyphs of a neighbouring character.
+        for (unsigned int i = 0; i < m_outlineVertices.size(); ++i)
+        {
+            if (!m_outlineVertices[i]->empty())
+                data.emplace_back((i == 0) ? texture : m_font->getTexturePage(m_characterSize, i), m_outlineVertices[i]);
+        }
 
-        if (m_vertices && !m_vertices->empty())
-            data.emplace_back(texture, m_vertices);
+        for (unsigned int i = 0; i < m_vertices.size(); ++i)
+        {
+            if (!m_vertices[i]->empty())
+                data.emplace_back((i == 0) ? texture : m_font->getTexturePage(m_characterSize, i), m_vertices[i]);
+        }
 
         return data;
     }
@@ -276,15 +315,15 @@ namespace tgui
 
         m_verticesNeedUpdate = false;
 
-        if (!m_vertices)
-            m_vertices = std::make_shared<std::vector<Vertex>>();
-        if (!m_outlineVertices && (m_outlineThickness != 0))
-            m_outlineVertices = std::make_shared<std::vector<Vertex>>();
-
+        // The vertices of the first texture page always exist, as it is also used for drawing underlines
         m_size = {0, 0};
-        m_vertices->clear();
-        if (m_outlineVertices)
-            m_outlineVertices->clear();
+        for (auto& pageVertices : m_vertices)
+            pageVertices->clear();
+        for (auto& pageVertices : m_outlineVertices)
+            pageVertices->clear();
+
+        std::vector<Vertex>& vertices = getPageVertices(m_vertices, 0);
+        std::vector<Vertex>* outlineVertices = (m_outlineThickness != 0) ? &getPageVertices(m_outlineVertices, 0) : nullptr;
 
         if (m_characterSize == 0)
             return;
@@ -328,19 +367,19 @@ namespace tgui
             // If we're using the underlined style and there's a new line, draw a line
             if (isUnderlined && (curChar == U'\n' && prevChar != U'\n'))
             {
-                addLine(*m_vertices, x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
+                addLine(vertices, x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
 
                 if (m_outlineThickness != 0)
-                    addLine(*m_outlineVertices, x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
+                    addLine(*outlineVertices, x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
             }
 
             // If we're using the strike through style and there's a new line, draw a line across all characters
             if (isStrikeThrough && (curChar == U'\n' && prevChar != U'\n'))
             {
-                addLine(*m_vertices, x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
+                addLine(vertices, x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
 
                 if (m_outlineThickness != 0)
-                    addLine(*m_outlineVertices, x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
+                    addLine(*outlineVertices, x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
             }
 
             prevChar = curChar;
@@ -374,7 +413,7 @@ namespace tgui
                 float right  = glyph.bounds.left + glyph.bounds.width;
 
                 // Add the outline glyph to the vertices
-                addGlyphQuad(*m_outlineVertices, {x, y}, vertexOutlineColor, glyph, fontScale, italicShear);
+                addGlyphQuad(getPageVertices(m_outlineVertices, glyph.texturePage), {x, y}, vertexOutlineColor, glyph, fontScale, italicShear);
                 maxX = std::max(maxX, x + right - italicShear * top - m_outlineThickness);
             }
 
@@ -382,7 +421,7 @@ namespace tgui
             const auto& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
 
             // Add the glyph to the vertices
-            addGlyphQuad(*m_vertices, {x, y}, vertexFillColor, glyph, fontScale, italicShear);
+            addGlyphQuad(getPageVertices(m_vertices, glyph.texturePage), {x, y}, vertexFillColor, glyph, fontScale, italicShear);
 
             // Update the current bounds with the non outlined glyph bounds
             if (m_outlineThickness == 0)
@@ -397,19 +436,19 @@ namespace tgui
         // If we're using the underlined style, add the last line
         if (isUnderlined && (x > 0))
         {
-            addLine(*m_vertices, x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
+            addLine(vertices, x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
 
             if (m_outlineThickness != 0)
-                addLine(*m_outlineVertices, x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
+                addLine(*outlineVertices, x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
         }
 
         // If we're using the strike through style, add the last line across all characters
         if (isStrikeThrough && (x > 0))
         {
-            addLine(*m_vertices, x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
+            addLine(vertices, x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
 
             if (m_outlineThickness != 0)
-                addLine(*m_outlineVertices, x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
+                addLine(*outlineVertices, x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
         }
 
         // The height of a line can sometimes be slightly larger than the line spacing returned by the font.
@@ -420,20 +459,26 @@ namespace tgui
         m_size = {maxX + 2 * m_outlineThickness, height + 2 * m_outlineThickness};
 
         // Normalize the texture coordinates
-        const Vector2u textureSize = m_font->getTextureSize(m_characterSize);
-        if ((textureSize.x > 0) && (textureSize.y > 0))
+        for (unsigned int i = 0; i < std::max(m_vertices.size(), m_outlineVertices.size()); ++i)
         {
+            const Vector2u textureSize = m_font->getTexturePageSize(m_characterSize, i);
+            if ((textureSize.x == 0) || (textureSize.y == 0))
+                continue;
+
             const float textureWidth = static_cast<float>(textureSize.x);
             const float textureHeight = static_cast<float>(textureSize.y);
 
-            for (auto& vertex : *m_vertices)
+            if (i < m_vertices.size())
             {
-                vertex.texCoords.x /= textureWidth;
-                vertex.texCoords.y /= textureHeight;
+                for (auto& vertex : *m_vertices[i])
+                {
+                    vertex.texCoords.x /= textureWidth;
+                    vertex.texCoords.y /= textureHeight;
+                }
             }
-            if (m_outlineVertices)
+            if (i < m_outlineVertices.size())
             {
-                for (auto& vertex : *m_outlineVertices)
+                for (auto& vertex : *m_outlineVertices[i])
                 {
                     vertex.texCoords.x /= textureWidth;
                     vertex.texCoords.y /= textureHeight;
@@ -444,6 +489,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Vertex>& BackendText::getPageVertices(std::vector<std::shared_ptr<std::vector<Vertex>>>& verticesPerPage, unsigned int pageIndex)
+    {
+        while (verticesPerPage.size() <= pageIndex)
+            verticesPerPage.push_back(std::make_shared<std::vector<Vertex>>());
+
+        return *verticesPerPage[pageIndex];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendText::addGlyphQuad(std::vector<Vertex>& vertices, Vector2f position, const Vertex::Color& color, const FontGlyph& glyph, float fontScale, float italicShear)
     {
         const float padding = 1;
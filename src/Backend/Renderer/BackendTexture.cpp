@@ -25,10 +25,16 @@
 
 #include <TGUI/Backend/Renderer/BackendTexture.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cstring>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    BackendTexture::PixelStorage BackendTexture::m_defaultPixelStorage = BackendTexture::PixelStorage::Full;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool BackendTexture::load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels, bool smooth)
@@ -38,7 +44,12 @@ namespace tgui
         if (!loadTextureOnly(size, pixels.get(), smooth))
             return false;
 
-        m_pixels = std::move(pixels);
+        m_loadedWithPixels = true;
+        if (m_pixelStorage == PixelStorage::Full)
+            m_pixels = std::move(pixels);
+        else if (m_pixelStorage == PixelStorage::AlphaMask)
+            buildAlphaMask(pixels.get());
+
         return true;
     }
 
@@ -49,6 +60,8 @@ namespace tgui
         TGUI_ASSERT((size.x > 0) && (size.y > 0), "load and loadTextureOnly functions in BackendTexture needs a valid size");
 
         m_pixels = nullptr;
+        m_alphaMask.clear();
+        m_loadedWithPixels = false;
         m_imageSize = size;
         m_isSmooth = smooth;
         return true;
@@ -56,6 +69,81 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTexture::loadAlphaTextureOnly(Vector2u size, const std::uint8_t* alphaPixels, bool smooth)
+    {
+        if (!alphaPixels)
+            return loadTextureOnly(size, nullptr, smooth);
+
+        // Color is always white, the alpha channel is copied from the provided pixels
+        const std::size_t pixelCount = static_cast<std::size_t>(size.x) * size.y;
+        auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(pixelCount * 4);
+        std::uint8_t* pixelPtr = pixels.get();
+        for (std::size_t i = 0; i < pixelCount; ++i)
+        {
+            *pixelPtr++ = 255;
+            *pixelPtr++ = 255;
+            *pixelPtr++ = 255;
+            *pixelPtr++ = alphaPixels[i];
+        }
+
+        return loadTextureOnly(size, pixels.get(), smooth);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::updateTextureRegion(UIntRect region, const std::uint8_t* pixels)
+    {
+        TGUI_ASSERT((region.left + region.width <= m_imageSize.x) && (region.top + region.height <= m_imageSize.y),
+                    "Region passed to updateTextureRegion has to lie inside the texture");
+
+        if (m_pixels)
+        {
+            for (unsigned int y = 0; y < region.height; ++y)
+            {
+                std::memcpy(&m_pixels[((region.top + y) * m_imageSize.x + region.left) * 4],
+                            &pixels[y * region.width * 4], region.width * 4);
+            }
+        }
+        else if (!m_alphaMask.empty())
+        {
+            for (unsigned int y = 0; y < region.height; ++y)
+            {
+                for (unsigned int x = 0; x < region.width; ++x)
+                {
+                    const std::size_t index = static_cast<std::size_t>(region.top + y) * m_imageSize.x + region.left + x;
+                    const auto bit = static_cast<std::uint8_t>(1 << (index % 8));
+                    if (pixels[(y * region.width + x) * 4 + 3] == 0)
+                        m_alphaMask[index / 8] |= bit;
+                    else
+                        m_alphaMask[index / 8] &= static_cast<std::uint8_t>(~bit);
+                }
+            }
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::updateAlphaTextureRegion(UIntRect region, const std::uint8_t* alphaPixels)
+    {
+        // Color is always white, the alpha channel is copied from the provided pixels
+        const std::size_t pixelCount = static_cast<std::size_t>(region.width) * region.height;
+        auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(pixelCount * 4);
+        std::uint8_t* pixelPtr = pixels.get();
+        for (std::size_t i = 0; i < pixelCount; ++i)
+        {
+            *pixelPtr++ = 255;
+            *pixelPtr++ = 255;
+            *pixelPtr++ = 255;
+            *pixelPtr++ = alphaPixels[i];
+        }
+
+        return updateTextureRegion(region, pixels.get());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2u BackendTexture::getSize() const
     {
         return m_imageSize;
@@ -79,13 +167,21 @@ namespace tgui
 
     bool BackendTexture::isTransparentPixel(Vector2u pixel) const
     {
-        if (!m_pixels)
+        if (!m_pixels && m_alphaMask.empty())
             return false;
 
         TGUI_ASSERT((pixel.x < m_imageSize.x) && (pixel.y < m_imageSize.y), "Pixel out of range in BackendTexture::isTransparentPixel");
 
-        const auto pixelOffset = (pixel.y * m_imageSize.x + pixel.x) * 4;
-        return (m_pixels[pixelOffset + 3] == 0);
+        if (m_pixels)
+        {
+            const auto pixelOffset = (pixel.y * m_imageSize.x + pixel.x) * 4;
+            return (m_pixels[pixelOffset + 3] == 0);
+        }
+        else
+        {
+            const std::size_t index = static_cast<std::size_t>(pixel.y) * m_imageSize.x + pixel.x;
+            return ((m_alphaMask[index / 8] >> (index % 8)) & 1) != 0;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -96,6 +192,77 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::setPixelStorage(PixelStorage storage)
+    {
+        m_pixelStorage = storage;
+        if ((storage == PixelStorage::AlphaMask) && m_pixels)
+        {
+            buildAlphaMask(m_pixels.get());
+            m_pixels = nullptr;
+        }
+        else if (storage == PixelStorage::None)
+        {
+            m_pixels = nullptr;
+            m_alphaMask.clear();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendTexture::PixelStorage BackendTexture::getPixelStorage() const
+    {
+        return m_pixelStorage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendTexture::getPixelMemoryUsage() const
+    {
+        if (m_pixels)
+            return static_cast<std::size_t>(m_imageSize.x) * m_imageSize.y * 4;
+        else
+            return m_alphaMask.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendTexture::getPixelMemorySaved() const
+    {
+        if (!m_loadedWithPixels)
+            return 0;
+
+        return static_cast<std::size_t>(m_imageSize.x) * m_imageSize.y * 4 - getPixelMemoryUsage();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::setDefaultPixelStorage(PixelStorage storage)
+    {
+        m_defaultPixelStorage = storage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendTexture::PixelStorage BackendTexture::getDefaultPixelStorage()
+    {
+        return m_defaultPixelStorage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::buildAlphaMask(const std::uint8_t* pixels)
+    {
+        const std::size_t pixelCount = static_cast<std::size_t>(m_imageSize.x) * m_imageSize.y;
+        m_alphaMask.assign((pixelCount + 7) / 8, 0);
+        for (std::size_t i = 0; i < pixelCount; ++i)
+        {
+            if (pixels[i * 4 + 3] == 0)
+                m_alphaMask[i / 8] |= static_cast<std::uint8_t>(1 << (i % 8));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -313,7 +313,9 @@ namespace tgui
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
 
         // Draw the widgets
+        beginFrame();
         root->draw(*this, {});
+        endFrame();
 
         m_currentTexture = nullptr;
 
@@ -349,6 +351,9 @@ namespace tgui
     void BackendRenderTargetGLES2::drawVertexArray(const RenderStates& states, const Vertex* vertices,
         std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
     {
+        if (batchVertexArray(states, vertices, vertexCount, indices, indexCount, texture))
+            return;
+
         // Change the bound texture if it changed
         if (m_currentTexture != texture)
         {
@@ -368,7 +373,7 @@ namespace tgui
 
         // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
         // was (suprisingly) faster than creating a larger buffer and only writing to non-overlapping ranges within a frame.
-        // Batch rendering (and re-arranging draw calls to be better batchable) would be much faster though.
+        // When batching is enabled, this is only reached once for each group of consecutive draw calls that share the same state.
         TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * sizeof(Vertex)), vertices, GL_DYNAMIC_DRAW));
 
         const Transform finalTransform = m_projectionTransform * states.transform;
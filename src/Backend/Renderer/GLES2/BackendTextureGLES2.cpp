@@ -47,13 +47,33 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool BackendTextureGLES2::loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth)
+    {
+        return loadTextureWithFormat(size, pixels, smooth, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureGLES2::loadAlphaTextureOnly(Vector2u size, const std::uint8_t* alphaPixels, bool smooth)
+    {
+        // Texture swizzling requires GLES 3.0, older versions have to store the pixels as RGBA
+        if (!TGUI_GLAD_GL_ES_VERSION_3_0)
+            return BackendTexture::loadAlphaTextureOnly(size, alphaPixels, smooth);
+
+        return loadTextureWithFormat(size, alphaPixels, smooth, true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureGLES2::loadTextureWithFormat(Vector2u size, const std::uint8_t* pixels, bool smooth, bool alphaOnly)
     {
         TGUI_ASSERT(isBackendSet(), "BackendTextureGLES2 can't be created when there is no system backend initialized (was a gui created yet?)");
         TGUI_ASSERT(getBackend()->getRenderer(), "BackendTextureGLES2 can't be created when there is no backend renderer (was a gui attached to a window yet?)");
 
-        const bool reuseTexture = ((m_textureId != 0) && (size.x == m_imageSize.x) && (size.y == m_imageSize.y) && (smooth == m_isSmooth));
+        const bool reuseTexture = ((m_textureId != 0) && (size.x == m_imageSize.x) && (size.y == m_imageSize.y)
+                                   && (smooth == m_isSmooth) && (alphaOnly == m_alphaOnly));
 
         BackendTexture::loadTextureOnly(size, pixels, smooth);
+        m_alphaOnly = alphaOnly;
 
         if (!reuseTexture)
         {
@@ -68,10 +88,19 @@ namespace tgui
 
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
 
+        // Rows of a single-channel texture aren't necessarily a multiple of 4 bytes
+        GLint oldUnpackAlignment = 4;
+        if (alphaOnly)
+        {
+            TGUI_GL_CHECK(glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment));
+            TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+        }
+
+        const GLenum format = alphaOnly ? GL_RED : GL_RGBA;
         if (reuseTexture)
         {
             if (pixels)
-                TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+                TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), format, GL_UNSIGNED_BYTE, pixels));
         }
         else
         {
@@ -81,11 +110,20 @@ namespace tgui
             TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
             TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
 
+            if (alphaOnly)
+            {
+                // The shader samples the texture as RGBA, so the red channel is mapped onto the alpha of a white pixel
+                TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_R, GL_ONE));
+                TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, GL_ONE));
+                TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, GL_ONE));
+                TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_RED));
+            }
+
             if (TGUI_GLAD_GL_ES_VERSION_3_0)
             {
-                TGUI_GL_CHECK(glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y)));
+                TGUI_GL_CHECK(glTexStorage2D(GL_TEXTURE_2D, 1, alphaOnly ? GL_R8 : GL_RGBA8, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y)));
                 if (pixels)
-                    TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+                    TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), format, GL_UNSIGNED_BYTE, pixels));
             }
             else
             {
@@ -94,6 +132,9 @@ namespace tgui
             }
         }
 
+        if (alphaOnly)
+            TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment));
+
         // Restore the texture that was bound when this function was called
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(oldBoundTexture)));
         return true;
@@ -101,6 +142,69 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureGLES2::updateTextureRegion(UIntRect region, const std::uint8_t* pixels)
+    {
+        BackendTexture::updateTextureRegion(region, pixels);
+
+        // The pixels of a single-channel texture can't be changed with RGBA pixels
+        if (!m_textureId || m_alphaOnly)
+            return false;
+
+        updateRegionWithFormat(region, pixels, false);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureGLES2::updateAlphaTextureRegion(UIntRect region, const std::uint8_t* alphaPixels)
+    {
+        // If the texture wasn't stored with a single channel then the pixels need to be converted to RGBA first
+        if (!m_alphaOnly)
+            return BackendTexture::updateAlphaTextureRegion(region, alphaPixels);
+
+        if (!m_textureId)
+            return false;
+
+        updateRegionWithFormat(region, alphaPixels, true);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextureGLES2::updateRegionWithFormat(UIntRect region, const std::uint8_t* pixels, bool alphaOnly)
+    {
+        TGUI_ASSERT((region.left + region.width <= m_imageSize.x) && (region.top + region.height <= m_imageSize.y),
+                    "Region passed to updateTextureRegion has to lie inside the texture");
+
+        if ((region.width == 0) || (region.height == 0))
+            return;
+
+        GLint oldBoundTexture;
+        TGUI_GL_CHECK(glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldBoundTexture));
+
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
+
+        // Rows of a single-channel texture aren't necessarily a multiple of 4 bytes
+        GLint oldUnpackAlignment = 4;
+        if (alphaOnly)
+        {
+            TGUI_GL_CHECK(glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment));
+            TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+        }
+
+        TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(region.left), static_cast<GLint>(region.top),
+                                      static_cast<GLsizei>(region.width), static_cast<GLsizei>(region.height),
+                                      alphaOnly ? GL_RED : GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+
+        if (alphaOnly)
+            TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment));
+
+        // Restore the texture that was bound when this function was called
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(oldBoundTexture)));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureGLES2::setSmooth(bool smooth)
     {
         if (m_isSmooth == smooth)
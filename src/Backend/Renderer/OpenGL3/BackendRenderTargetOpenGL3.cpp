@@ -162,6 +162,12 @@ namespace tgui
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_vertexBuffer));
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_indexBuffer));
         TGUI_GL_CHECK(glDeleteVertexArrays(1, &m_vertexArray));
+
+        if (m_retainedFramebuffer)
+        {
+            TGUI_GL_CHECK(glDeleteFramebuffers(1, &m_retainedFramebuffer));
+            TGUI_GL_CHECK(glDeleteTextures(1, &m_retainedFramebufferTexture));
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -243,12 +249,72 @@ namespace tgui
         TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
         TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
 
+        // When only some areas have to be redrawn, the gui is drawn to an offscreen framebuffer that still contains the previous frame
+        GLint oldDrawFramebuffer = 0;
+        GLint oldReadFramebuffer = 0;
+        const bool partialRedraw = m_redrawAreas && updateRetainedFramebuffer();
+        if (partialRedraw)
+        {
+            TGUI_GL_CHECK(glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &oldDrawFramebuffer));
+            TGUI_GL_CHECK(glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &oldReadFramebuffer));
+            TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_retainedFramebuffer));
+        }
+        else
+            m_retainedFramebufferValid = false;
+
         // Don't make any assumptions about the currently set texture
         m_currentTexture = nullptr;
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
 
         // Draw the widgets
-        root->draw(*this, {});
+        beginFrame();
+        if (partialRedraw && m_retainedFramebufferValid && (m_retainedFramebufferView == m_viewRect) && (m_retainedFramebufferViewport == m_viewport))
+        {
+            for (const auto& area : *m_redrawAreas)
+            {
+                // Only the widgets that intersect with the area are drawn, on top of the cleared area
+                addClippingLayer({}, area);
+                const FloatRect& clipViewport = m_clipLayers.back().second;
+                if ((clipViewport.width > 0) && (clipViewport.height > 0))
+                {
+                    m_frameStatistics.redrawnPixels += static_cast<std::size_t>(clipViewport.width * clipViewport.height);
+                    TGUI_GL_CHECK(glClear(GL_COLOR_BUFFER_BIT));
+                    root->draw(*this, {});
+                    flushBatch();
+                }
+                removeClippingLayer();
+            }
+        }
+        else
+        {
+            if (partialRedraw)
+            {
+                TGUI_GL_CHECK(glClear(GL_COLOR_BUFFER_BIT));
+                m_retainedFramebufferValid = true;
+                m_retainedFramebufferView = m_viewRect;
+                m_retainedFramebufferViewport = m_viewport;
+            }
+
+            m_frameStatistics.redrawnPixels = static_cast<std::size_t>(m_viewport.width * m_viewport.height);
+            root->draw(*this, {});
+        }
+        endFrame();
+
+        if (partialRedraw)
+        {
+            // Copy the gui from the offscreen framebuffer to the window
+            TGUI_GL_CHECK(glBindFramebuffer(GL_READ_FRAMEBUFFER, m_retainedFramebuffer));
+            TGUI_GL_CHECK(glBindFramebuffer(GL_DRAW_FRAMEBUFFER, static_cast<GLuint>(oldDrawFramebuffer)));
+            TGUI_GL_CHECK(glScissor(viewportGL[0], viewportGL[1], viewportGL[2], viewportGL[3]));
+            TGUI_GL_CHECK(glBlitFramebuffer(viewportGL[0], viewportGL[1], viewportGL[0] + viewportGL[2], viewportGL[1] + viewportGL[3],
+                                            viewportGL[0], viewportGL[1], viewportGL[0] + viewportGL[2], viewportGL[1] + viewportGL[3],
+                                            GL_COLOR_BUFFER_BIT, GL_NEAREST));
+            TGUI_GL_CHECK(glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(oldReadFramebuffer)));
+
+            // The overlay is drawn directly on the window, so that it doesn't remain visible in the next frames
+            if (m_redrawAreasOverlayEnabled)
+                drawRedrawAreasOverlay(*m_redrawAreas);
+        }
 
         m_currentTexture = nullptr;
 
@@ -283,6 +349,9 @@ namespace tgui
     void BackendRenderTargetOpenGL3::drawVertexArray(const RenderStates& states, const Vertex* vertices,
         std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
     {
+        if (batchVertexArray(states, vertices, vertexCount, indices, indexCount, texture))
+            return;
+
         // Change the bound texture if it changed
         if (m_currentTexture != texture)
         {
@@ -302,7 +371,7 @@ namespace tgui
 
         // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
         // was (suprisingly) faster than creating a larger buffer and only writing to non-overlapping ranges within a frame.
-        // Batch rendering (and re-arranging draw calls to be better batchable) would be much faster though.
+        // When batching is enabled, this is only reached once for each group of consecutive draw calls that share the same state.
         TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * sizeof(Vertex)), vertices, GL_DYNAMIC_DRAW));
 
         const Transform finalTransform = m_projectionTransform * states.transform;
@@ -321,6 +390,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendRenderTargetOpenGL3::isPartialRedrawSupported() const
+    {
+        return m_retainedFramebufferSupported;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetOpenGL3::updateClipping(FloatRect clipRect, FloatRect clipViewport)
     {
         if ((clipViewport.width > 0) && (clipViewport.height > 0) && (clipRect.width > 0) && (clipRect.height > 0))
@@ -340,6 +416,53 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendRenderTargetOpenGL3::updateRetainedFramebuffer()
+    {
+        // The framebuffer has the same size as the window, so that the same viewport and scissor coordinates can be used
+        const Vector2u size{static_cast<unsigned int>(m_targetSize.x), static_cast<unsigned int>(m_targetSize.y)};
+        if (!m_retainedFramebufferSupported)
+            return false;
+
+        if (m_retainedFramebuffer && (size == m_retainedFramebufferSize))
+            return true;
+
+        if (!m_retainedFramebuffer)
+        {
+            TGUI_GL_CHECK(glGenFramebuffers(1, &m_retainedFramebuffer));
+            TGUI_GL_CHECK(glGenTextures(1, &m_retainedFramebufferTexture));
+        }
+
+        m_retainedFramebufferSize = size;
+        m_retainedFramebufferValid = false;
+
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_retainedFramebufferTexture));
+        TGUI_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+
+        GLint oldFramebuffer = 0;
+        TGUI_GL_CHECK(glGetIntegerv(GL_FRAMEBUFFER_BINDING, &oldFramebuffer));
+        TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_retainedFramebuffer));
+        TGUI_GL_CHECK(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_retainedFramebufferTexture, 0));
+        const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(oldFramebuffer)));
+
+        if (status != GL_FRAMEBUFFER_COMPLETE)
+        {
+            TGUI_PRINT_WARNING("Failed to create offscreen framebuffer, partial redraw will be disabled");
+            TGUI_GL_CHECK(glDeleteFramebuffers(1, &m_retainedFramebuffer));
+            TGUI_GL_CHECK(glDeleteTextures(1, &m_retainedFramebufferTexture));
+            m_retainedFramebuffer = 0;
+            m_retainedFramebufferTexture = 0;
+            m_retainedFramebufferSupported = false;
+            return false;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetOpenGL3::createBuffers()
     {
         TGUI_GL_CHECK(glGenVertexArrays(1, &m_vertexArray));
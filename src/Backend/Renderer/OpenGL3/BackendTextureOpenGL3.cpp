@@ -48,13 +48,29 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool BackendTextureOpenGL3::loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth)
+    {
+        return loadTextureWithFormat(size, pixels, smooth, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureOpenGL3::loadAlphaTextureOnly(Vector2u size, const std::uint8_t* alphaPixels, bool smooth)
+    {
+        return loadTextureWithFormat(size, alphaPixels, smooth, true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureOpenGL3::loadTextureWithFormat(Vector2u size, const std::uint8_t* pixels, bool smooth, bool alphaOnly)
     {
         TGUI_ASSERT(isBackendSet(), "BackendTextureOpenGL3 can't be created when there is no system backend initialized (was a gui created yet?)");
         TGUI_ASSERT(getBackend()->getRenderer(), "BackendTextureOpenGL3 can't be created when there is no backend renderer (was a gui attached to a window yet?)");
 
-        const bool reuseTexture = ((m_textureId != 0) && (size.x == m_imageSize.x) && (size.y == m_imageSize.y) && (smooth == m_isSmooth));
+        const bool reuseTexture = ((m_textureId != 0) && (size.x == m_imageSize.x) && (size.y == m_imageSize.y)
+                                   && (smooth == m_isSmooth) && (alphaOnly == m_alphaOnly));
 
         BackendTexture::loadTextureOnly(size, pixels, smooth);
+        m_alphaOnly = alphaOnly;
 
         if (!reuseTexture)
         {
@@ -69,10 +85,20 @@ namespace tgui
 
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
 
+        // Rows of a single-channel texture aren't necessarily a multiple of 4 bytes
+        GLint oldUnpackAlignment = 4;
+        if (alphaOnly)
+        {
+            TGUI_GL_CHECK(glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment));
+            TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+        }
+
+        const GLenum internalFormat = alphaOnly ? GL_R8 : GL_RGBA8;
+        const GLenum format = alphaOnly ? GL_RED : GL_RGBA;
         if (reuseTexture)
         {
             if (pixels)
-                TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+                TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), format, GL_UNSIGNED_BYTE, pixels));
         }
         else
         {
@@ -82,20 +108,30 @@ namespace tgui
             TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
             TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
 
+            if (alphaOnly)
+            {
+                // The shader samples the texture as RGBA, so the red channel is mapped onto the alpha of a white pixel
+                const GLint swizzleMask[] = {GL_ONE, GL_ONE, GL_ONE, GL_RED};
+                TGUI_GL_CHECK(glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask));
+            }
+
             if (TGUI_GLAD_GL_VERSION_4_2)
             {
-                TGUI_GL_CHECK(glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y)));
+                TGUI_GL_CHECK(glTexStorage2D(GL_TEXTURE_2D, 1, internalFormat, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y)));
                 if (pixels)
-                    TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+                    TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), format, GL_UNSIGNED_BYTE, pixels));
             }
             else
             {
                 TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0));
                 TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0));
-                TGUI_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+                TGUI_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(internalFormat), static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), 0, format, GL_UNSIGNED_BYTE, pixels));
             }
         }
 
+        if (alphaOnly)
+            TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment));
+
         // Restore the texture that was bound when this function was called
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(oldBoundTexture)));
         return true;
@@ -103,6 +139,69 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureOpenGL3::updateTextureRegion(UIntRect region, const std::uint8_t* pixels)
+    {
+        BackendTexture::updateTextureRegion(region, pixels);
+
+        // The pixels of a single-channel texture can't be changed with RGBA pixels
+        if (!m_textureId || m_alphaOnly)
+            return false;
+
+        updateRegionWithFormat(region, pixels, false);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureOpenGL3::updateAlphaTextureRegion(UIntRect region, const std::uint8_t* alphaPixels)
+    {
+        // If the texture wasn't stored with a single channel then the pixels need to be converted to RGBA first
+        if (!m_alphaOnly)
+            return BackendTexture::updateAlphaTextureRegion(region, alphaPixels);
+
+        if (!m_textureId)
+            return false;
+
+        updateRegionWithFormat(region, alphaPixels, true);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextureOpenGL3::updateRegionWithFormat(UIntRect region, const std::uint8_t* pixels, bool alphaOnly)
+    {
+        TGUI_ASSERT((region.left + region.width <= m_imageSize.x) && (region.top + region.height <= m_imageSize.y),
+                    "Region passed to updateTextureRegion has to lie inside the texture");
+
+        if ((region.width == 0) || (region.height == 0))
+            return;
+
+        GLint oldBoundTexture;
+        TGUI_GL_CHECK(glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldBoundTexture));
+
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
+
+        // Rows of a single-channel texture aren't necessarily a multiple of 4 bytes
+        GLint oldUnpackAlignment = 4;
+        if (alphaOnly)
+        {
+            TGUI_GL_CHECK(glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment));
+            TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+        }
+
+        TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(region.left), static_cast<GLint>(region.top),
+                                      static_cast<GLsizei>(region.width), static_cast<GLsizei>(region.height),
+                                      alphaOnly ? GL_RED : GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+
+        if (alphaOnly)
+            TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment));
+
+        // Restore the texture that was bound when this function was called
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(oldBoundTexture)));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureOpenGL3::setSmooth(bool smooth)
     {
         if (m_isSmooth == smooth)
@@ -111,7 +111,9 @@ namespace tgui
             SDL_SetRenderDrawBlendMode(m_renderer, SDL_BLENDMODE_BLEND);
 
         // Draw the widgets
+        beginFrame();
         root->draw(*this, {});
+        endFrame();
 
         // Restore the old blend mode
         if (oldBlendMode != SDL_BLENDMODE_BLEND)
@@ -133,6 +135,9 @@ namespace tgui
     void BackendRenderTargetSDL::drawVertexArray(const RenderStates& states, const Vertex* vertices,
         std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
     {
+        if (batchVertexArray(states, vertices, vertexCount, indices, indexCount, texture))
+            return;
+
         SDL_Texture* textureSDL = nullptr;
         if (texture)
         {
@@ -140,21 +145,14 @@ namespace tgui
             textureSDL = std::static_pointer_cast<BackendTextureSDL>(texture)->getInternalTexture();
         }
 
-        const Transform finalTransform = m_projectionTransform * states.transform;
-        std::vector<Vertex> verticesSDL(vertices, vertices + vertexCount);
-        for (std::size_t i = 0; i < vertexCount; ++i)
-        {
-            const Vector2f transformedPosition = finalTransform.transformPoint(vertices[i].position);
-            verticesSDL[i].position.x = transformedPosition.x;
-            verticesSDL[i].position.y = transformedPosition.y;
-        }
+        const Vertex* verticesSDL = transformVertices(m_projectionTransform * states.transform, vertices, vertexCount);
 
         // We use SDL_RenderGeometry instead of SDL_RenderGeometryRaw because it's easier and because the signature of
         // the SDL_RenderGeometryRaw function is different in SDL 2.0.18 and SDL >= 2.0.20
         static_assert(sizeof(int) == sizeof(unsigned int), "Size of 'int' and 'unsigned int' must be identical for cast to work");
         static_assert(sizeof(Vertex) == sizeof(SDL_Vertex), "SDL_Vertex requires same memory layout as tgui::Vertex for cast to work");
         SDL_RenderGeometry(m_renderer, textureSDL,
-                           reinterpret_cast<const SDL_Vertex*>(verticesSDL.data()), static_cast<int>(vertexCount),
+                           reinterpret_cast<const SDL_Vertex*>(verticesSDL), static_cast<int>(vertexCount),
                            reinterpret_cast<const int*>(indices), static_cast<int>(indexCount));
     }
 
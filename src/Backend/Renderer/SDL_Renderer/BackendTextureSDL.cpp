@@ -150,6 +150,7 @@ namespace tgui
 
         m_texture = texture;
         m_pixels = nullptr;
+        m_alphaMask.clear();
 
         int width;
         int height;
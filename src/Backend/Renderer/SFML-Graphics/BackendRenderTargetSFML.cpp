@@ -84,7 +84,9 @@ namespace tgui
         updateClipping(m_viewRect, m_viewport);
 
         // Draw the widgets
+        beginFrame();
         root->draw(*this, {});
+        endFrame();
 
         // Restore the old view
         m_target->setView(oldView);
@@ -139,6 +141,9 @@ namespace tgui
             triangleVertices[i].texCoords.y = vertices[indices[i]].texCoords.y * textureSize.y;
         }
 
+        // The shader can't be part of a batch, so anything that was batched before has to be drawn first
+        flushBatch();
+
         static_assert(sizeof(Vertex) == sizeof(sf::Vertex), "Size of sf::Vertex has to match with tgui::Vertex for optimization to work");
         const sf::Vertex* sfmlVertices = reinterpret_cast<const sf::Vertex*>(triangleVertices.data());
         m_target->draw(sfmlVertices, indices.size(), sf::PrimitiveType::Triangles, sfStates);
@@ -152,6 +157,9 @@ namespace tgui
     void BackendRenderTargetSFML::drawVertexArray(const RenderStates& states, const Vertex* vertices,
         std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
     {
+        if (batchVertexArray(states, vertices, vertexCount, indices, indexCount, texture))
+            return;
+
         // Creating an sf::Vertex costs time because its constructor can't be inlined. Since our own Vertex struct has an identical memory layout,
         // we will create an array of our own Vertex objects and then use a reinterpret_cast to turn them into sf::Vertex.
         static_assert(sizeof(Vertex) == sizeof(sf::Vertex), "Size of sf::Vertex has to match with tgui::Vertex for optimization to work");
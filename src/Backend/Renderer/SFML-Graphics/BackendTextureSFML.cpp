@@ -89,6 +89,7 @@ namespace tgui
         m_texture = texture;
 
         m_pixels = nullptr;
+        m_alphaMask.clear();
         m_imageSize = {texture.getSize().x, texture.getSize().y};
         m_isSmooth = texture.isSmooth();
     }
@@ -26,6 +26,8 @@
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Timer.hpp>
+#include <TGUI/SvgImage.hpp>
+#include <TGUI/TextureManager.hpp>
 #include <TGUI/Font.hpp>
 #include <TGUI/DefaultFont.hpp>
 #include <TGUI/Backend/Font/BackendFontFactory.hpp>
@@ -65,6 +67,15 @@ namespace tgui
 
             // Destroy the global theme
             Theme::setDefault(nullptr);
+
+            // Destroy the images that were kept in memory after they were no longer used
+            TextureManager::removeReleasedImages();
+
+            // Destroy the shared SVG textures and stop rasterizing in the background
+            SvgImage::clearRasterCache();
+
+            // Stop loading textures in the background
+            TextureManager::cancelAsyncLoads();
         }
 
         globalBackend = std::move(backend);
@@ -131,11 +142,16 @@ namespace tgui
         for (auto* sprite : m_registeredSvgSprites)
             sprite->updateVertices();
 
-        // Update the size of all texts in all widgets
+        if (!m_registeredSvgSprites.empty())
+            ++m_svgTextureVersion;
+
+        // Update the size of all texts in all widgets, which affects every widget that is shown
         for (auto& gui : m_guis)
         {
             for (auto& widget : gui->getWidgets())
                 widget->updateTextSize();
+
+            gui->requestFullRedraw();
         }
     }
 
@@ -273,6 +289,36 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Backend::updatePendingSvgSprites()
+    {
+        if (!SvgImage::finishBackgroundRasterizations())
+            return false;
+
+        bool spritesUpdated = false;
+        for (auto* sprite : m_registeredSvgSprites)
+        {
+            if (!sprite->isSvgRasterizationPending())
+                continue;
+
+            sprite->updateVertices();
+            spritesUpdated = true;
+        }
+
+        if (spritesUpdated)
+            ++m_svgTextureVersion;
+
+        return spritesUpdated;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Backend::getSvgTextureVersion() const
+    {
+        return m_svgTextureVersion;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,11 @@
 #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Timer.hpp>
+#include <TGUI/TextureManager.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+#endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -103,6 +108,110 @@ namespace tgui
 
     bool BackendGui::handleEvent(Event event)
     {
+        m_eventStatistics.eventsReceived++;
+
+        if (m_eventCoalescingEnabled)
+        {
+            if (event.type == Event::Type::MouseMoved)
+            {
+                // Consecutive mouse moves are replaced by the last one, but the intermediate positions are remembered
+                if (m_pendingEvent && (m_pendingEvent->type != Event::Type::MouseMoved))
+                    handlePendingEvents();
+
+                m_pendingMousePositions.push_back({event.mouseMove.x, event.mouseMove.y});
+                m_pendingEvent = event;
+                return false;
+            }
+            else if (event.type == Event::Type::MouseWheelScrolled)
+            {
+                // Consecutive wheel events are added together, as long as the mouse didn't move in between
+                if (m_pendingEvent && (m_pendingEvent->type == Event::Type::MouseWheelScrolled)
+                 && (m_pendingEvent->mouseWheel.x == event.mouseWheel.x) && (m_pendingEvent->mouseWheel.y == event.mouseWheel.y))
+                {
+                    event.mouseWheel.delta += m_pendingEvent->mouseWheel.delta;
+                }
+                else
+                    handlePendingEvents();
+
+                m_pendingEvent = event;
+                return false;
+            }
+
+            // Other events aren't merged, but the event that was held back has to be handled first to preserve the order
+            handlePendingEvents();
+        }
+
+        const bool eventHandled = dispatchEvent(event);
+        if (eventHandled)
+            markEventUnpresented();
+
+        return eventHandled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::setEventCoalescingEnabled(bool enabled)
+    {
+        if (!enabled)
+            handlePendingEvents();
+
+        m_eventCoalescingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::isEventCoalescingEnabled() const
+    {
+        return m_eventCoalescingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::handlePendingEvents()
+    {
+        if (!m_pendingEvent)
+            return false;
+
+        const Event event = *m_pendingEvent;
+        m_pendingEvent.reset();
+
+        const bool eventHandled = dispatchEvent(event);
+        if (eventHandled)
+            markEventUnpresented();
+
+        return eventHandled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<Vector2f>& BackendGui::getCoalescedMousePositions() const
+    {
+        return m_coalescedMousePositions;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendGui::EventStatistics BackendGui::getEventStatistics() const
+    {
+        return m_eventStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::resetEventStatistics()
+    {
+        m_eventStatistics = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::dispatchEvent(Event event)
+    {
+        m_eventStatistics.eventsDispatched++;
+
+        // Widgets have to be at their final position before the event can be sent to them
+        Layout::flushLayouts();
+
         switch (event.type)
         {
             case Event::Type::MouseMoved:
@@ -115,6 +224,17 @@ namespace tgui
                 {
                     m_lastMousePos = {event.mouseMove.x, event.mouseMove.y};
                     mouseCoords = mapPixelToCoords({event.mouseMove.x, event.mouseMove.y});
+
+                    m_coalescedMousePositions.clear();
+                    if (!m_pendingMousePositions.empty())
+                    {
+                        for (const auto& pos : m_pendingMousePositions)
+                            m_coalescedMousePositions.push_back(mapPixelToCoords(pos));
+
+                        m_pendingMousePositions.clear();
+                    }
+                    else
+                        m_coalescedMousePositions.push_back(mouseCoords);
                 }
                 else if (event.type == Event::Type::MouseWheelScrolled)
                 {
@@ -222,12 +342,109 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendGui::setPartialRedrawEnabled(bool enabled)
+    {
+        m_partialRedrawEnabled = enabled;
+        m_fullRedrawRequired = true;
+        m_damagedAreas.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::isPartialRedrawEnabled() const
+    {
+        return m_partialRedrawEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::addDamagedArea(const FloatRect& area)
+    {
+        if (!m_partialRedrawEnabled || m_fullRedrawRequired)
+            return;
+
+        if ((area.width <= 0) || (area.height <= 0))
+            return;
+
+        // Some widgets draw slightly outside their bounds (e.g. anti-aliased edges), so the area is made a bit larger
+        const float padding = 2;
+        FloatRect paddedArea{area.left - padding, area.top - padding, area.width + 2*padding, area.height + 2*padding};
+
+        // Merge the area with existing areas that overlap it. Merging may cause the area to overlap with other existing areas,
+        // so we keep merging until none of the existing areas intersect with the new area anymore.
+        bool merged = true;
+        while (merged)
+        {
+            merged = false;
+            for (auto it = m_damagedAreas.begin(); it != m_damagedAreas.end(); ++it)
+            {
+                if (!paddedArea.intersects(*it))
+                    continue;
+
+                const float left = std::min(paddedArea.left, it->left);
+                const float top = std::min(paddedArea.top, it->top);
+                const float right = std::max(paddedArea.left + paddedArea.width, it->left + it->width);
+                const float bottom = std::max(paddedArea.top + paddedArea.height, it->top + it->height);
+                paddedArea = {left, top, right - left, bottom - top};
+
+                m_damagedAreas.erase(it);
+                merged = true;
+                break;
+            }
+        }
+
+        // Drawing the widgets once for every area becomes more expensive than drawing them once when there are too many areas
+        const std::size_t maxDamagedAreas = 8;
+        if (m_damagedAreas.size() >= maxDamagedAreas)
+        {
+            for (const auto& damagedArea : m_damagedAreas)
+            {
+                const float left = std::min(paddedArea.left, damagedArea.left);
+                const float top = std::min(paddedArea.top, damagedArea.top);
+                const float right = std::max(paddedArea.left + paddedArea.width, damagedArea.left + damagedArea.width);
+                const float bottom = std::max(paddedArea.top + paddedArea.height, damagedArea.top + damagedArea.height);
+                paddedArea = {left, top, right - left, bottom - top};
+            }
+
+            m_damagedAreas.clear();
+        }
+
+        m_damagedAreas.push_back(paddedArea);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::requestFullRedraw()
+    {
+        m_fullRedrawRequired = true;
+        m_damagedAreas.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendGui::draw()
     {
+        // The widgets have to react to the last mouse move before they are drawn
+        handlePendingEvents();
+
         if (m_drawUpdatesTime)
             updateTime();
 
         TGUI_ASSERT(m_backendRenderTarget != nullptr, "Gui must be given a window (or render target) before calling draw()");
+
+        if (m_partialRedrawEnabled)
+        {
+            if (!m_fullRedrawRequired && m_backendRenderTarget->isPartialRedrawSupported())
+                m_backendRenderTarget->setRedrawAreas(m_damagedAreas);
+            else
+                m_backendRenderTarget->resetRedrawAreas();
+
+            m_damagedAreas.clear();
+            m_fullRedrawRequired = false;
+        }
+        else
+            m_backendRenderTarget->resetRedrawAreas();
+
         m_backendRenderTarget->drawGui(m_container);
     }
 
@@ -509,7 +726,30 @@ namespace tgui
 
     bool BackendGui::updateTime(Duration elapsedTime)
     {
-        bool screenRefreshRequired = Timer::updateTime(elapsedTime);
+        // Widgets that are changed by the events, posted functions, timer callbacks, loaded textures or layouts report their
+        // own damaged areas, so these only require a screen refresh
+        bool screenRefreshRequired = handlePendingEvents();
+        screenRefreshRequired |= executePostedTasks();
+        screenRefreshRequired |= Timer::updateTime(elapsedTime);
+
+        // Pass the textures that finished loading in the background to the functions that requested them
+        screenRefreshRequired |= TextureManager::finishAsyncLoads();
+
+        // Recalculate the layouts that depend on widgets that were moved or resized since the last frame
+        screenRefreshRequired |= Layout::flushLayouts();
+
+        // Show the SVG images that finished rasterizing in the background (possibly in sprites of another gui).
+        // The sprites don't know their widget, so the render target remembers which widgets were waiting for them.
+        getBackend()->updatePendingSvgSprites();
+        const unsigned int svgTextureVersion = getBackend()->getSvgTextureVersion();
+        if (svgTextureVersion != m_lastSvgTextureVersion)
+        {
+            m_lastSvgTextureVersion = svgTextureVersion;
+            if (m_backendRenderTarget)
+                m_backendRenderTarget->invalidateWidgetsWithPendingSvgSprites();
+
+            screenRefreshRequired = true;
+        }
 
         if (!m_windowFocused)
             return screenRefreshRequired;
@@ -569,6 +809,46 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendGui::post(std::function<void()> func)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_postedTasksMutex);
+            m_postedTasks.push_back(std::move(func));
+        }
+
+        wakeUpMainLoop();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::setMaxIdleWaitTime(Duration maxWaitTime)
+    {
+        m_maxIdleWaitTime = maxWaitTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Duration BackendGui::getMaxIdleWaitTime() const
+    {
+        return m_maxIdleWaitTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendGui::MainLoopStatistics BackendGui::getMainLoopStatistics() const
+    {
+        return m_mainLoopStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::resetMainLoopStatistics()
+    {
+        m_mainLoopStatistics = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool BackendGui::handleTwoFingerScroll(bool wasAlreadyScrolling)
     {
         TGUI_ASSERT(m_twoFingerScroll.isScrolling(), "m_twoFingerScroll.isScrolling() must return true when BackendGui::handleTwoFingerScroll is called");
@@ -612,6 +892,7 @@ namespace tgui
             m_backendRenderTarget->setView(m_view.getRect(), m_viewport.getRect(), {static_cast<float>(m_framebufferSize.x), static_cast<float>(m_framebufferSize.y)});
 
         m_container->setSize(Vector2f{m_view.getWidth(), m_view.getHeight()});
+        requestFullRedraw();
 
         // Derived classes should update m_view in their updateContainerSize() function before calling this function
         const FloatRect& viewRect = m_view.getRect();
@@ -623,6 +904,96 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::wakeUpMainLoop()
+    {
+        // Locking the mutex prevents the notification from getting lost when it is sent just before the main loop starts waiting
+        std::lock_guard<std::mutex> lock(m_postedTasksMutex);
+        m_postedTasksCondition.notify_all();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Duration BackendGui::getIdleWaitTime() const
+    {
+        Duration waitTime = m_maxIdleWaitTime;
+
+        const Optional<Duration> timerTime = Timer::getNextScheduledTime();
+        if (timerTime && (*timerTime < waitTime))
+            waitTime = *timerTime;
+
+        if (m_tooltipPossible)
+        {
+            const Duration tooltipDelay = ToolTip::getInitialDelay();
+            const Duration tooltipTime = (m_tooltipTime < tooltipDelay) ? (tooltipDelay - m_tooltipTime) : Duration{};
+            if (tooltipTime < waitTime)
+                waitTime = tooltipTime;
+        }
+
+        // Textures that are decoded in the background don't interrupt the wait, so check regularly whether they are ready
+        if ((TextureManager::getAsyncLoadsCount() > 0) && (waitTime > std::chrono::milliseconds(10)))
+            waitTime = std::chrono::milliseconds(10);
+
+        return waitTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::waitForPostedTasks(Duration timeout)
+    {
+        std::unique_lock<std::mutex> lock(m_postedTasksMutex);
+        return m_postedTasksCondition.wait_for(lock, std::chrono::nanoseconds(timeout), [this]{ return !m_postedTasks.empty(); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::executePostedTasks()
+    {
+        std::vector<std::function<void()>> tasks;
+        {
+            std::lock_guard<std::mutex> lock(m_postedTasksMutex);
+            if (m_postedTasks.empty())
+                return false;
+
+            tasks.swap(m_postedTasks);
+        }
+
+        // The tasks are executed without holding the lock, so that they can post new tasks themselves
+        for (auto& task : tasks)
+        {
+            task();
+            m_mainLoopStatistics.postedTasksExecuted++;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::markEventUnpresented()
+    {
+        // Only the oldest event that isn't visible on the screen yet determines the input latency
+        if (m_firstUnpresentedEventTime == std::chrono::steady_clock::time_point())
+            m_firstUnpresentedEventTime = std::chrono::steady_clock::now();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::recordPresentedFrame()
+    {
+        m_mainLoopStatistics.framesPresented++;
+
+        if (m_firstUnpresentedEventTime != std::chrono::steady_clock::time_point())
+        {
+            m_mainLoopStatistics.lastInputLatency = std::chrono::steady_clock::now() - m_firstUnpresentedEventTime;
+            if (m_mainLoopStatistics.lastInputLatency > m_mainLoopStatistics.maxInputLatency)
+                m_mainLoopStatistics.maxInputLatency = m_mainLoopStatistics.lastInputLatency;
+
+            m_firstUnpresentedEventTime = {};
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -371,30 +371,54 @@ namespace tgui
         glfwSetMouseButtonCallback(m_window, [](GLFWwindow* window, int button, int action, int mods){
             static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window))->mouseButtonCallback(button, action, mods);
         });
+        glfwSetWindowRefreshCallback(m_window, [](GLFWwindow* window){
+            // The window was uncovered or restored, so its contents have to be drawn again even if the gui didn't change
+            auto gui = static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window));
+            gui->requestFullRedraw();
+            gui->m_windowRefreshRequired = true;
+        });
 
         setDrawingUpdatesTime(false);
 
+        bool refreshRequired = true;
+        m_windowRefreshRequired = false;
         std::chrono::steady_clock::time_point lastRenderTime;
         while (!glfwWindowShouldClose(m_window))
         {
             // Don't try to render too often, even when the screen is changing (e.g. during animation)
             const auto timePointNow = std::chrono::steady_clock::now();
             const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(15);
-            if (timePointNextAllowed <= timePointNow)
+            if (refreshRequired && (timePointNextAllowed <= timePointNow))
             {
                 m_backendRenderTarget->clearScreen();
                 draw();
                 glfwSwapBuffers(m_window);
+                recordPresentedFrame();
+
+                refreshRequired = false;
                 lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
             }
 
-            double eventTimeoutSeconds = 0.01;
-            Optional<Duration> duration = Timer::getNextScheduledTime();
-            if (duration && (*duration < std::chrono::milliseconds(10)))
-                eventTimeoutSeconds = static_cast<double>(duration->asSeconds());
+            // Sleep until an event arrives, a task is posted (which posts an empty event) or the gui has to be updated.
+            // If the screen still has to be redrawn then we only sleep until we are allowed to render again.
+            Duration waitTime = getIdleWaitTime();
+            if (refreshRequired && (Duration{timePointNextAllowed - timePointNow} < waitTime))
+                waitTime = timePointNextAllowed - timePointNow;
+
+            const std::size_t eventsReceived = m_eventStatistics.eventsReceived;
+            if (waitTime > Duration{})
+                glfwWaitEventsTimeout(static_cast<double>(waitTime.asSeconds()));
+            else
+                glfwPollEvents();
 
-            glfwWaitEventsTimeout(eventTimeoutSeconds);
-            updateTime();
+            m_mainLoopStatistics.wakeUps++;
+
+            // The callbacks don't tell us whether the events changed the gui, so we redraw whenever an event was received
+            if (updateTime() || (m_eventStatistics.eventsReceived != eventsReceived) || m_windowRefreshRequired)
+            {
+                refreshRequired = true;
+                m_windowRefreshRequired = false;
+            }
         }
     }
 
@@ -433,6 +457,16 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGuiGLFW::wakeUpMainLoop()
+    {
+        BackendGui::wakeUpMainLoop();
+
+        // This function can be called from any thread
+        glfwPostEmptyEvent();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
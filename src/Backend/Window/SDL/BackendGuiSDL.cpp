@@ -419,18 +419,29 @@ namespace tgui
 
         m_backendRenderTarget->setClearColor(clearColor);
 
-        // Helper function that calculates the amount of time to sleep, which is 10ms unless a timer will expire before this time
-        const auto getTimerWakeUpTime = []{
-            Optional<Duration> duration = Timer::getNextScheduledTime();
-            if (duration && (*duration < std::chrono::milliseconds(10)))
-                return *duration;
-            else
-                return Duration{std::chrono::milliseconds(10)};
-        };
-
         setDrawingUpdatesTime(false);
 
+        // Helper function that handles an event and returns whether the screen needs to be redrawn
         bool quit = false;
+        const auto processEvent = [this,&quit](const SDL_Event& event){
+            bool eventProcessed = handleEvent(event);
+            if (event.type == SDL_EVENT_QUIT)
+            {
+                quit = true;
+                eventProcessed = true;
+            }
+#if SDL_MAJOR_VERSION >= 3
+            else if (event.type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED)
+#else
+            else if ((event.type == SDL_WINDOWEVENT) && (event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED))
+#endif
+            {
+                eventProcessed = true;
+            }
+
+            return eventProcessed;
+        };
+
         bool refreshRequired = true;
         std::chrono::steady_clock::time_point lastRenderTime;
         while (!quit)
@@ -438,38 +449,34 @@ namespace tgui
             bool eventProcessed = false;
             while (true)
             {
-                // We could use SDL_WaitEventTimeout instead of SDL_PollEvent and custom timing in the future, but we would
-                // have to be careful not to keep calling the function with the same timeout while events keep coming.
                 SDL_Event event;
                 while (SDL_PollEvent(&event) != 0)
                 {
-                    if (handleEvent(event))
-                        eventProcessed = true;
-
-                    if (event.type == SDL_EVENT_QUIT)
-                    {
-                        quit = true;
-                        eventProcessed = true;
-                    }
-#if SDL_MAJOR_VERSION >= 3
-                    else if (event.type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED)
-#else
-                    else if ((event.type == SDL_WINDOWEVENT) && (event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED))
-#endif
-                    {
+                    if (processEvent(event))
                         eventProcessed = true;
-                    }
                 }
 
                 if (updateTime())
                     break;
 
-                if (eventProcessed || refreshRequired)
+                if (eventProcessed || refreshRequired || quit)
                     break;
 
-                std::this_thread::sleep_for(std::chrono::nanoseconds(getTimerWakeUpTime()));
+                // Sleep until an event arrives, a task is posted (which pushes an event) or the gui has to be updated.
+                // The timeout is recalculated each time, so events that keep coming can't postpone timers indefinitely.
+                const auto timeoutMs = static_cast<int>(std::ceil(getIdleWaitTime().asSeconds() * 1000));
+                if (SDL_WaitEventTimeout(&event, timeoutMs))
+                {
+                    if (processEvent(event))
+                        eventProcessed = true;
+                }
+
+                m_mainLoopStatistics.wakeUps++;
             }
 
+            if (quit)
+                break;
+
             refreshRequired = true;
 
             // Don't try to render too often, even when the screen is changing (e.g. during animation)
@@ -477,11 +484,11 @@ namespace tgui
             const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(15);
             if (timePointNextAllowed > timePointNow)
             {
-                const auto timerWakeUpTime = getTimerWakeUpTime();
-                if (timePointNextAllowed - timePointNow < timerWakeUpTime)
+                const auto idleWaitTime = getIdleWaitTime();
+                if (timePointNextAllowed - timePointNow < idleWaitTime)
                     std::this_thread::sleep_for(timePointNextAllowed - timePointNow);
                 else
-                    std::this_thread::sleep_for(std::chrono::nanoseconds(timerWakeUpTime));
+                    std::this_thread::sleep_for(std::chrono::nanoseconds(idleWaitTime));
 
                 continue;
             }
@@ -489,6 +496,7 @@ namespace tgui
             m_backendRenderTarget->clearScreen();
             draw();
             presentScreen(); // Call SDL_GL_SwapWindow or SDL_RenderPresent depending on the backend renderer
+            recordPresentedFrame();
 
             refreshRequired = false;
             lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
@@ -541,6 +549,28 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGuiSDL::wakeUpMainLoop()
+    {
+        BackendGui::wakeUpMainLoop();
+
+        // SDL_RegisterEvents and SDL_PushEvent can both be called from any thread
+        static const Uint32 wakeUpEventType = SDL_RegisterEvents(1);
+#if SDL_MAJOR_VERSION >= 3
+        if (wakeUpEventType == 0)
+#else
+        if (wakeUpEventType == static_cast<Uint32>(-1))
+#endif
+            return;
+
+        // The event is ignored by handleEvent, it only exists to make SDL_WaitEventTimeout return
+        SDL_Event event;
+        SDL_zero(event);
+        event.type = wakeUpEventType;
+        SDL_PushEvent(&event);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
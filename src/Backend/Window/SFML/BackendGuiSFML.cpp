@@ -206,11 +206,12 @@ namespace tgui
 
         m_backendRenderTarget->setClearColor(clearColor);
 
-        // Helper function that calculates the amount of time to sleep, which is 10ms unless a timer will expire before this time
-        const auto getTimerWakeUpTime = []{
-            Optional<Duration> duration = Timer::getNextScheduledTime();
-            if (duration && (*duration < std::chrono::milliseconds(10)))
-                return *duration;
+        // Helper function that calculates the amount of time to sleep. SFML can't wait for window events with a timeout,
+        // so events are polled at least every 10ms. Tasks that are posted to the gui do interrupt the sleep.
+        const auto getWakeUpTime = [this]{
+            const Duration idleWaitTime = getIdleWaitTime();
+            if (idleWaitTime < std::chrono::milliseconds(10))
+                return idleWaitTime;
             else
                 return Duration{std::chrono::milliseconds(10)};
         };
@@ -251,7 +252,8 @@ namespace tgui
                 if (eventProcessed || refreshRequired)
                     break;
 
-                std::this_thread::sleep_for(std::chrono::nanoseconds(getTimerWakeUpTime()));
+                waitForPostedTasks(getWakeUpTime());
+                m_mainLoopStatistics.wakeUps++;
             }
 
             if (!windowOpen)
@@ -264,11 +266,11 @@ namespace tgui
             const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(15);
             if (timePointNextAllowed > timePointNow)
             {
-                const auto timerWakeUpTime = getTimerWakeUpTime();
-                if (timePointNextAllowed - timePointNow < timerWakeUpTime)
+                const auto wakeUpTime = getWakeUpTime();
+                if (timePointNextAllowed - timePointNow < wakeUpTime)
                     std::this_thread::sleep_for(timePointNextAllowed - timePointNow);
                 else
-                    std::this_thread::sleep_for(std::chrono::nanoseconds(timerWakeUpTime));
+                    std::this_thread::sleep_for(std::chrono::nanoseconds(wakeUpTime));
 
                 continue;
             }
@@ -276,6 +278,7 @@ namespace tgui
             m_backendRenderTarget->clearScreen();
             draw();
             m_window->display();
+            recordPresentedFrame();
 
             refreshRequired = false;
             lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
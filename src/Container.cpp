@@ -32,7 +32,11 @@
 #include <TGUI/Filesystem.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <unordered_map>
+    #include <algorithm>
     #include <fstream>
+    #include <cstdint>
+    #include <cmath>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -88,12 +92,12 @@ namespace tgui
         {
             auto node = std::make_unique<DataIO::Node>();
             node->name = name;
-            for (const auto& pair : renderer->propertyValuePairs)
+            for (const auto& pair : renderer->propertyValuePairs.getMap())
             {
                 if (pair.second.getType() == ObjectConverter::Type::RendererData)
                 {
-                    std::stringstream ss{ObjectConverter{pair.second}.getString().toStdString()};
-                    auto rendererRootNode = DataIO::parse(ss);
+                    const std::string str = ObjectConverter{pair.second}.getString().toStdString();
+                    auto rendererRootNode = DataIO::parse(CharStringView{str.data(), str.size()});
 
                     // If there are braces around the renderer string, then the child node is the one we need
                     if (rendererRootNode->propertyValuePairs.empty() && (rendererRootNode->children.size() == 1))
@@ -161,6 +165,208 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Uniform grid that stores which child widgets of a container overlap with each cell
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class ContainerSpatialIndex
+        {
+        public:
+
+            explicit ContainerSpatialIndex(float cellSize) :
+                m_cellSize{cellSize}
+            {
+            }
+
+            TGUI_NODISCARD float getCellSize() const
+            {
+                return m_cellSize;
+            }
+
+            // Adds the widget to the grid, or moves it to the correct cells if it was already added
+            void updateWidget(const Widget* widget)
+            {
+                removeWidget(widget);
+
+                const FloatRect bounds = getWidgetBounds(*widget);
+                CellRange range;
+                range.left = getCellCoordinate(bounds.left);
+                range.top = getCellCoordinate(bounds.top);
+                range.right = getCellCoordinate(bounds.left + bounds.width);
+                range.bottom = getCellCoordinate(bounds.top + bounds.height);
+
+                // Widgets that cover many cells (e.g. a background picture) are kept in a separate list that is always checked
+                const std::int64_t cellCount = (static_cast<std::int64_t>(range.right) - range.left + 1) * (static_cast<std::int64_t>(range.bottom) - range.top + 1);
+                if (cellCount > maxCellsPerWidget)
+                {
+                    range.oversized = true;
+                    m_oversizedWidgets.push_back(widget);
+                }
+                else
+                {
+                    for (std::int32_t y = range.top; y <= range.bottom; ++y)
+                    {
+                        for (std::int32_t x = range.left; x <= range.right; ++x)
+                            m_cells[getCellKey(x, y)].push_back(widget);
+                    }
+                }
+
+                m_widgetCells[widget] = range;
+                m_orderValid = false;
+            }
+
+            // Removes the widget from the grid
+            void removeWidget(const Widget* widget)
+            {
+                const auto it = m_widgetCells.find(widget);
+                if (it == m_widgetCells.end())
+                    return;
+
+                const CellRange& range = it->second;
+                if (range.oversized)
+                    removeFromList(m_oversizedWidgets, widget);
+                else
+                {
+                    for (std::int32_t y = range.top; y <= range.bottom; ++y)
+                    {
+                        for (std::int32_t x = range.left; x <= range.right; ++x)
+                        {
+                            const auto cellIt = m_cells.find(getCellKey(x, y));
+                            if (cellIt == m_cells.end())
+                                continue;
+
+                            removeFromList(cellIt->second, widget);
+                            if (cellIt->second.empty())
+                                m_cells.erase(cellIt);
+                        }
+                    }
+                }
+
+                m_widgetCells.erase(it);
+                m_orderValid = false;
+            }
+
+            // Should be called when the order of the widgets in the container changes
+            void invalidateOrder()
+            {
+                m_orderValid = false;
+            }
+
+            // Returns the indices of the widgets of which the bounding box contains the position, from front to back
+            TGUI_NODISCARD const std::vector<std::size_t>& getWidgetsAtPosition(Vector2f pos, const std::vector<Widget::Ptr>& widgets)
+            {
+                if (!m_orderValid)
+                {
+                    m_widgetIndices.clear();
+                    for (std::size_t i = 0; i < widgets.size(); ++i)
+                        m_widgetIndices[widgets[i].get()] = i;
+
+                    m_orderValid = true;
+                }
+
+                m_candidates.clear();
+                const auto addCandidates = [this](const std::vector<const Widget*>& list){
+                    for (const Widget* widget : list)
+                    {
+                        const auto it = m_widgetIndices.find(widget);
+                        if (it != m_widgetIndices.end())
+                            m_candidates.push_back(it->second);
+                    }
+                };
+
+                const auto cellIt = m_cells.find(getCellKey(getCellCoordinate(pos.x), getCellCoordinate(pos.y)));
+                if (cellIt != m_cells.end())
+                    addCandidates(cellIt->second);
+
+                addCandidates(m_oversizedWidgets);
+
+                std::sort(m_candidates.begin(), m_candidates.end(), [](std::size_t left, std::size_t right){ return left > right; });
+                return m_candidates;
+            }
+
+        private:
+
+            struct CellRange
+            {
+                std::int32_t left = 0;
+                std::int32_t top = 0;
+                std::int32_t right = 0;
+                std::int32_t bottom = 0;
+                bool oversized = false;
+            };
+
+            // Returns the area that the widget occupies in the container, taking its origin, rotation and scale into account
+            TGUI_NODISCARD static FloatRect getWidgetBounds(const Widget& widget)
+            {
+                const Vector2f size = widget.getSize();
+                const Vector2f fullSize = widget.getFullSize();
+                const Vector2f offset = widget.getWidgetOffset();
+                const FloatRect localBounds{std::min(0.f, offset.x), std::min(0.f, offset.y),
+                                            std::max(size.x, offset.x + fullSize.x) - std::min(0.f, offset.x),
+                                            std::max(size.y, offset.y + fullSize.y) - std::min(0.f, offset.y)};
+
+                const Vector2f origin{widget.getOrigin().x * size.x, widget.getOrigin().y * size.y};
+                const bool scaledOrRotated = (widget.getScale().x != 1) || (widget.getScale().y != 1) || (widget.getRotation() != 0);
+                if (!scaledOrRotated)
+                    return {localBounds.getPosition() + widget.getPosition() - origin, localBounds.getSize()};
+
+                const Vector2f rotOrigin{widget.getRotationOrigin().x * size.x, widget.getRotationOrigin().y * size.y};
+                const Vector2f scaleOrigin{widget.getScaleOrigin().x * size.x, widget.getScaleOrigin().y * size.y};
+
+                Transform transform;
+                transform.translate(widget.getPosition() - origin);
+                transform.rotate(widget.getRotation(), rotOrigin);
+                transform.scale(widget.getScale(), scaleOrigin);
+                return transform.transformRect(localBounds);
+            }
+
+            TGUI_NODISCARD std::int32_t getCellCoordinate(float pos) const
+            {
+                // Clamp the value so that widgets with extreme (or NaN) positions can't cause an overflow
+                const float cell = std::floor(pos / m_cellSize);
+                if (!(cell > -1000000))
+                    return -1000000;
+                if (cell > 1000000)
+                    return 1000000;
+                return static_cast<std::int32_t>(cell);
+            }
+
+            TGUI_NODISCARD static std::uint64_t getCellKey(std::int32_t x, std::int32_t y)
+            {
+                return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+            }
+
+            static void removeFromList(std::vector<const Widget*>& list, const Widget* widget)
+            {
+                // The order inside the list doesn't matter, so the widget can be replaced by the last one
+                const auto it = std::find(list.begin(), list.end(), widget);
+                if (it == list.end())
+                    return;
+
+                *it = list.back();
+                list.pop_back();
+            }
+
+        private:
+
+            static constexpr std::int64_t maxCellsPerWidget = 64;
+
+            float m_cellSize;
+            std::unordered_map<std::uint64_t, std::vector<const Widget*>> m_cells;
+            std::vector<const Widget*> m_oversizedWidgets;
+            std::unordered_map<const Widget*, CellRange> m_widgetCells;
+
+            // Index of each widget inside the container, which is recalculated when widgets are added, removed or reordered
+            std::unordered_map<const Widget*, std::size_t> m_widgetIndices;
+            bool m_orderValid = false;
+
+            std::vector<std::size_t> m_candidates; // Reused between calls to avoid allocations
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Container::Container(const char* typeName, bool initRenderer) :
         Widget{typeName, initRenderer}
     {
@@ -172,6 +378,9 @@ namespace tgui
     Container::Container(const Container& other) :
         Widget{other}
     {
+        if (other.m_spatialIndex)
+            m_spatialIndex = std::make_unique<priv::ContainerSpatialIndex>(other.m_spatialIndex->getCellSize());
+
         // Widgets with layouts that refer to each other need to be added simultaneously.
         // They all need to be in m_widgets before setParent is called on the first widget,
         // which is why we can't just use call add(widget) for each widget.
@@ -192,7 +401,8 @@ namespace tgui
         m_widgetWithLeftMouseDown {std::move(other.m_widgetWithLeftMouseDown)},
         m_widgetWithRightMouseDown{std::move(other.m_widgetWithRightMouseDown)},
         m_focusedWidget           {std::move(other.m_focusedWidget)},
-        m_draggingWidget          {std::move(other.m_draggingWidget)}
+        m_draggingWidget          {std::move(other.m_draggingWidget)},
+        m_spatialIndex            {std::move(other.m_spatialIndex)}
     {
         // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
         // Otherwise calling setParent on one widget could cause another widget's position to be recalculated which could
@@ -233,6 +443,11 @@ namespace tgui
             // Remove all the old widgets
             Container::removeAllWidgets();
 
+            if (right.m_spatialIndex)
+                m_spatialIndex = std::make_unique<priv::ContainerSpatialIndex>(right.m_spatialIndex->getCellSize());
+            else
+                m_spatialIndex = nullptr;
+
             // Widgets with layouts that refer to each other need to be added simultaneously.
             // They all need to be in m_widgets before setParent is called on the first widget,
             // which is why we can't just use call add(widget) for each widget.
@@ -260,6 +475,7 @@ namespace tgui
             m_widgetWithRightMouseDown = std::move(right.m_widgetWithRightMouseDown);
             m_focusedWidget            = std::move(right.m_focusedWidget);
             m_draggingWidget           = std::move(right.m_draggingWidget);
+            m_spatialIndex             = std::move(right.m_spatialIndex);
             Widget::operator=(std::move(right));
 
             // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
@@ -290,8 +506,7 @@ namespace tgui
             if (getInnerSize() != m_prevInnerSize)
             {
                 m_prevInnerSize = getInnerSize();
-                for (auto& layout : m_boundSizeLayouts)
-                    layout->recalculateValue();
+                Layout::recalculateLayouts(m_boundSizeLayouts);
             }
         }
     }
@@ -384,6 +599,12 @@ namespace tgui
                 widget->setFocused(false);
             }
 
+            if (m_spatialIndex)
+                m_spatialIndex->removeWidget(widget.get());
+
+            // The render caches of the parents are invalidated and the area where the widget was located will be redrawn
+            widget->invalidateRenderCache();
+
             // Remove the widget
             widget->setParent(nullptr);
             m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i));
@@ -405,6 +626,11 @@ namespace tgui
 
         m_widgets.clear();
 
+        if (m_spatialIndex)
+            m_spatialIndex = std::make_unique<priv::ContainerSpatialIndex>(m_spatialIndex->getCellSize());
+
+        invalidateRenderCache();
+
         m_widgetBelowMouse = nullptr;
         m_widgetWithLeftMouseDown = nullptr;
         m_widgetWithRightMouseDown = nullptr;
@@ -447,9 +673,7 @@ namespace tgui
         if (!fileContents)
             throw Exception{U"Failed to open '" + filenameInResources + U"' to load the widgets from it."};
 
-        /// TODO: Optimize this (parse function should be able to use a string view directly on file contents)
-        std::stringstream stream{std::string{reinterpret_cast<const char*>(fileContents.get()), fileSize}};
-        const auto rootNode = DataIO::parse(stream);
+        const auto rootNode = DataIO::parse(CharStringView{reinterpret_cast<const char*>(fileContents.get()), fileSize});
 
         // All files need to be loaded relative to the form file
         const auto& parentPath = Filesystem::Path(filename).getParentPath();
@@ -619,6 +843,11 @@ namespace tgui
 
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i));
+
+            if (m_spatialIndex)
+                m_spatialIndex->invalidateOrder();
+
+            widget->invalidateRenderCache();
             break;
         }
     }
@@ -639,6 +868,11 @@ namespace tgui
 
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i + 1));
+
+            if (m_spatialIndex)
+                m_spatialIndex->invalidateOrder();
+
+            widget->invalidateRenderCache();
             break;
         }
     }
@@ -657,6 +891,11 @@ namespace tgui
                 return m_widgets.size() - 1;
 
             std::swap(m_widgets[i], m_widgets[i+1]);
+            if (m_spatialIndex)
+                m_spatialIndex->invalidateOrder();
+
+            widget->invalidateRenderCache();
+
             return i + 1;
         }
 
@@ -678,6 +917,11 @@ namespace tgui
                 return 0;
 
             std::swap(m_widgets[i-2], m_widgets[i-1]);
+            if (m_spatialIndex)
+                m_spatialIndex->invalidateOrder();
+
+            widget->invalidateRenderCache();
+
             return i-2;
         }
 
@@ -711,6 +955,11 @@ namespace tgui
         // Move the widget to the new index
         m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(currentWidgetIndex));
         m_widgets.insert(m_widgets.begin() + static_cast<std::ptrdiff_t>(index), widget);
+
+        if (m_spatialIndex)
+            m_spatialIndex->invalidateOrder();
+
+        widget->invalidateRenderCache();
         return true;
     }
 
@@ -756,31 +1005,50 @@ namespace tgui
     {
         pos -= getPosition() + getChildWidgetsOffset();
 
-        for (auto it = m_widgets.crbegin(); it != m_widgets.crend(); ++it)
+        // Look for a visible widget below the mouse
+        const Widget::Ptr widget = getWidgetBelowMouse(pos);
+        if (!widget)
+            return nullptr;
+
+        // If the widget is a container then look inside it
+        if (widget->isContainer())
         {
-            const auto& widget = *it;
+            Container::Ptr container = std::static_pointer_cast<Container>(widget);
+            auto childWidget = container->getWidgetAtPosition(transformMousePos(widget, pos));
+            if (childWidget)
+                return childWidget;
+        }
 
-            // Look for a visible widget below the mouse
-            if (!widget->isVisible())
-                continue;
-            if (!widget->isMouseOnWidget(transformMousePos(widget, pos)))
-                continue;
+        // If the widget isn't a container, or there were no child widgets inside it, then return this widget
+        return widget;
+    }
 
-            // If the widget is a container then look inside it
-            if (widget->isContainer())
-            {
-                Container::Ptr container = std::static_pointer_cast<Container>(widget);
-                auto childWidget = container->getWidgetAtPosition(transformMousePos(widget, pos));
-                if (childWidget)
-                    return childWidget;
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // If the widget isn't a container, or there were no child widgets inside it, then return this widget
-            return widget;
+    void Container::setSpatialIndexCellSize(float cellSize)
+    {
+        if (cellSize <= 0)
+        {
+            m_spatialIndex = nullptr;
+            return;
         }
 
-        // No visible widgets were found at the queried position
-        return nullptr;
+        if (m_spatialIndex && (m_spatialIndex->getCellSize() == cellSize))
+            return;
+
+        m_spatialIndex = std::make_unique<priv::ContainerSpatialIndex>(cellSize);
+        for (const auto& widget : m_widgets)
+            m_spatialIndex->updateWidget(widget.get());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float Container::getSpatialIndexCellSize() const
+    {
+        if (m_spatialIndex)
+            return m_spatialIndex->getCellSize();
+        else
+            return 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -895,6 +1163,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::childWidgetBoundsChanged(const Widget* child)
+    {
+        if (m_spatialIndex)
+            m_spatialIndex->updateWidget(child);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::leftMousePressed(Vector2f pos)
     {
         Widget::leftMousePressed(pos);
@@ -979,6 +1255,7 @@ namespace tgui
 
         if (m_widgetWithLeftMouseDown)
         {
+            m_widgetWithLeftMouseDown->invalidateRenderCache();
             m_widgetWithLeftMouseDown->leftMouseButtonNoLongerDown();
             m_widgetWithLeftMouseDown = nullptr;
             m_draggingWidget = false;
@@ -993,6 +1270,7 @@ namespace tgui
 
         if (m_widgetWithRightMouseDown)
         {
+            m_widgetWithRightMouseDown->invalidateRenderCache();
             m_widgetWithRightMouseDown->rightMouseButtonNoLongerDown();
             m_widgetWithRightMouseDown = nullptr;
         }
@@ -1106,6 +1384,7 @@ namespace tgui
         // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them
         if (m_widgetWithLeftMouseDown && m_draggingWidget)
         {
+            m_widgetWithLeftMouseDown->invalidateRenderCache();
             m_widgetWithLeftMouseDown->mouseMoved(transformMousePos(m_widgetWithLeftMouseDown, mousePos));
             return true;
         }
@@ -1117,6 +1396,7 @@ namespace tgui
         if (widget != nullptr)
         {
             // Send the event to the widget
+            widget->invalidateRenderCache();
             widget->mouseMoved(transformMousePos(widget, mousePos));
             return true;
         }
@@ -1152,6 +1432,7 @@ namespace tgui
             if (!widget->isContainer())
                 widget->setFocused(true);
 
+            widget->invalidateRenderCache();
             if (button == Event::MouseButton::Left)
                 m_draggingWidget = widget->leftMousePressed(transformMousePos(widget, mousePos));
             else if (button == Event::MouseButton::Right)
@@ -1185,10 +1466,14 @@ namespace tgui
     {
         Widget::Ptr widgetBelowMouse = updateWidgetBelowMouse(mousePos);
         if (widgetBelowMouse != nullptr)
+        {
+            widgetBelowMouse->invalidateRenderCache();
             widgetBelowMouse->mouseReleased(button, transformMousePos(widgetBelowMouse, mousePos));
+        }
 
         if ((button == Event::MouseButton::Left) && m_widgetWithLeftMouseDown)
         {
+            m_widgetWithLeftMouseDown->invalidateRenderCache();
             m_widgetWithLeftMouseDown->leftMouseButtonNoLongerDown();
             m_widgetWithLeftMouseDown = nullptr;
             m_draggingWidget = false;
@@ -1196,6 +1481,7 @@ namespace tgui
         }
         else if ((button == Event::MouseButton::Right) && m_widgetWithRightMouseDown)
         {
+            m_widgetWithRightMouseDown->invalidateRenderCache();
             m_widgetWithRightMouseDown->rightMouseButtonNoLongerDown();
             m_widgetWithRightMouseDown = nullptr;
             return true;
@@ -1211,7 +1497,10 @@ namespace tgui
         // Send the event to the widget below the mouse
         Widget::Ptr widget = updateWidgetBelowMouse(pos);
         if (widget != nullptr)
+        {
+            widget->invalidateRenderCache();
             return widget->scrolled(delta, transformMousePos(widget, pos), touch);
+        }
 
         return false;
     }
@@ -1228,6 +1517,7 @@ namespace tgui
         if (m_focusedWidget && m_focusedWidget->isFocused())
         {
             // Tell the widget that the key was pressed
+            m_focusedWidget->invalidateRenderCache();
             m_focusedWidget->keyPressed(event);
             return true;
         }
@@ -1246,6 +1536,7 @@ namespace tgui
         // Tell the widget that the key was pressed
         if (m_focusedWidget && m_focusedWidget->isFocused())
         {
+            m_focusedWidget->invalidateRenderCache();
             m_focusedWidget->textEntered(key);
             return true;
         }
@@ -1262,9 +1553,12 @@ namespace tgui
         // Loop through all widgets
         for (auto& widget : m_widgets)
         {
-            // Update the elapsed time in widgets that need it
-            if (widget->isVisible())
-                screenRefreshRequired |= widget->updateTime(elapsedTime);
+            // Update the elapsed time in widgets that need it. Widgets that need to be redrawn can no longer be drawn from cache.
+            if (widget->isVisible() && widget->updateTime(elapsedTime))
+            {
+                widget->invalidateRenderCache();
+                screenRefreshRequired = true;
+            }
         }
 
         return screenRefreshRequired;
@@ -1301,6 +1595,24 @@ namespace tgui
 
     Widget::Ptr Container::getWidgetBelowMouse(Vector2f mousePos) const
     {
+        // When there is a grid, only the widgets in the cell below the mouse have to be checked
+        if (m_spatialIndex)
+        {
+            for (const std::size_t index : m_spatialIndex->getWidgetsAtPosition(mousePos, m_widgets))
+            {
+                const auto& widget = m_widgets[index];
+                if (!widget->isVisible())
+                    continue;
+
+                if (!widget->isMouseOnWidget(transformMousePos(widget, mousePos)))
+                    continue;
+
+                return widget;
+            }
+
+            return nullptr;
+        }
+
         for (auto it = m_widgets.crbegin(); it != m_widgets.crend(); ++it)
         {
             const auto& widget = *it;
@@ -1448,6 +1760,11 @@ namespace tgui
 
         widgetPtr->setParent(this);
 
+        if (m_spatialIndex)
+            m_spatialIndex->updateWidget(widgetPtr.get());
+
+        widgetPtr->invalidateRenderCache();
+
         if (m_fontCached != Font::getGlobalFont())
             widgetPtr->setInheritedFont(m_fontCached);
 
@@ -1554,8 +1871,7 @@ namespace tgui
 
         m_size = size;
         onSizeChange.emit(this, size.getValue());
-        for (auto& layout : m_boundSizeLayouts)
-            layout->recalculateValue();
+        Layout::recalculateLayouts(m_boundSizeLayouts);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,10 +27,28 @@
 #include <TGUI/Widget.hpp>
 #include <TGUI/Backend/Window/BackendGui.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Recalculating layouts may change bindings, which then requires another pass. A cycle in the bindings would however
+        // keep changing values forever, so the number of passes is limited.
+        constexpr std::size_t maxSolverPasses = 64;
+
+        bool deferredLayoutUpdates = false;
+        bool flushingLayouts = false;
+        std::unordered_set<Layout*> dirtyLayouts; // Root layouts that need to be recalculated when updates are deferred
+        Layout::SolverStatistics solverStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_NODISCARD static std::pair<String, String> parseMinMaxExpresssion(const String& expression)
     {
         unsigned int bracketCount = 0;
@@ -375,8 +393,13 @@ namespace tgui
         m_rightOperand   {std::move(other.m_rightOperand)},
         m_boundWidget    {other.m_boundWidget},
         m_boundString    {std::move(other.m_boundString)},
-        m_connectedWidgetCallback{std::move(other.m_connectedWidgetCallback)}
+        m_connectedWidgetCallback{std::move(other.m_connectedWidgetCallback)},
+        m_connectedWidget{other.m_connectedWidget}
     {
+        // If the old layout was waiting to be recalculated then the new one takes its place
+        if (!dirtyLayouts.empty() && (dirtyLayouts.erase(&other) > 0))
+            dirtyLayouts.insert(this);
+
         resetPointers();
     }
 
@@ -396,6 +419,7 @@ namespace tgui
             m_boundWidget     = other.m_boundWidget;
             m_boundString     = other.m_boundString;
             m_connectedWidgetCallback = nullptr;
+            m_connectedWidget = nullptr;
 
             // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
             if (!m_boundString.empty())
@@ -423,6 +447,10 @@ namespace tgui
             m_boundWidget     = other.m_boundWidget;
             m_boundString     = std::move(other.m_boundString);
             m_connectedWidgetCallback = std::move(other.m_connectedWidgetCallback);
+            m_connectedWidget = other.m_connectedWidget;
+
+            if (!dirtyLayouts.empty() && (dirtyLayouts.erase(&other) > 0))
+                dirtyLayouts.insert(this);
 
             resetPointers();
         }
@@ -435,6 +463,9 @@ namespace tgui
     Layout::~Layout()
     {
         unbindLayout();
+
+        if (!dirtyLayouts.empty())
+            dirtyLayouts.erase(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -618,6 +649,7 @@ namespace tgui
 
         // Restore the callback function
         m_connectedWidgetCallback = std::move(valueChangedCallbackHandler);
+        m_connectedWidget = m_connectedWidgetCallback ? widget : nullptr;
 
         if (m_value != oldValue)
         {
@@ -649,6 +681,25 @@ namespace tgui
     {
         const float oldValue = m_value;
 
+        updateValue();
+
+        if (m_value != oldValue)
+        {
+            if (m_parent)
+                m_parent->recalculateValue();
+            else
+            {
+                // The topmost layout must tell the connected widget about the new value
+                if (m_connectedWidgetCallback)
+                    m_connectedWidgetCallback();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::updateValue()
+    {
         switch (m_operation)
         {
             case Operation::Value:
@@ -711,18 +762,249 @@ namespace tgui
                 // Passing here either means something is wrong with the string or the layout was not connected to a widget with a parent yet.
                 break;
         };
+    }
 
-        if (m_value != oldValue)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Layout::recalculateTree()
+    {
+        const float oldValue = m_value;
+
+        if (m_leftOperand)
         {
-            if (m_parent)
-                m_parent->recalculateValue();
-            else
+            m_leftOperand->recalculateTree();
+            m_rightOperand->recalculateTree();
+        }
+
+        updateValue();
+        return (m_value != oldValue);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout* Layout::getRootLayout()
+    {
+        Layout* layout = this;
+        while (layout->m_parent)
+            layout = layout->m_parent;
+
+        return layout;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout* Layout::getSolverNode()
+    {
+        if (m_connectedWidget)
+        {
+            if (this == &m_connectedWidget->m_position.y)
+                return &m_connectedWidget->m_position.x;
+            if (this == &m_connectedWidget->m_size.y)
+                return &m_connectedWidget->m_size.x;
+        }
+
+        return this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout* Layout::getSolverNodeSibling() const
+    {
+        if (m_connectedWidget)
+        {
+            if (this == &m_connectedWidget->m_position.x)
+                return &m_connectedWidget->m_position.y;
+            if (this == &m_connectedWidget->m_size.x)
+                return &m_connectedWidget->m_size.y;
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::getDependentLayouts(std::vector<Layout*>& dependentLayouts) const
+    {
+        if (!m_connectedWidget)
+            return;
+
+        const Widget& widget = *m_connectedWidget;
+        const bool storesPosition = (this == &widget.m_position.x);
+        const bool storesSize = (this == &widget.m_size.x);
+
+        // When the origin isn't in the top left corner, changing the size also changes the left and top of the widget
+        if (!storesSize || (widget.m_origin.x != 0) || (widget.m_origin.y != 0))
+        {
+            for (auto* layout : widget.m_boundPositionLayouts)
+                dependentLayouts.push_back(layout->getRootLayout()->getSolverNode());
+        }
+
+        if (!storesPosition)
+        {
+            for (auto* layout : widget.m_boundSizeLayouts)
+                dependentLayouts.push_back(layout->getRootLayout()->getSolverNode());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::pair<Layout*, Layout*>> Layout::sortDirtyLayouts()
+    {
+        struct StackEntry
+        {
+            Layout* node;
+            std::vector<Layout*> dependentNodes;
+            std::size_t nextDependentIndex;
+        };
+
+        // Depth-first search from each dirty node, where a node is added to the list after all nodes that depend on it.
+        // Reversing that list results in a topological order. The search is iterative as dependency chains can be very long.
+        std::vector<std::pair<Layout*, Layout*>> sortedNodes;
+        std::unordered_set<const Layout*> visitedNodes;
+        std::vector<StackEntry> stack;
+        const auto visitNode = [&](Layout* node){
+            if (!visitedNodes.insert(node).second)
+                return;
+
+            stack.push_back({node, {}, 0});
+            node->getDependentLayouts(stack.back().dependentNodes);
+        };
+
+        for (auto* dirtyLayout : dirtyLayouts)
+        {
+            visitNode(dirtyLayout->getSolverNode());
+            while (!stack.empty())
             {
-                // The topmost layout must tell the connected widget about the new value
-                if (m_connectedWidgetCallback)
-                    m_connectedWidgetCallback();
+                auto& entry = stack.back();
+                if (entry.nextDependentIndex < entry.dependentNodes.size())
+                {
+                    // Cycles are simply broken here, the nodes in the cycle are recalculated again in the next pass
+                    visitNode(entry.dependentNodes[entry.nextDependentIndex++]);
+                }
+                else
+                {
+                    sortedNodes.emplace_back(entry.node, entry.node->getSolverNodeSibling());
+                    stack.pop_back();
+                }
+            }
+        }
+
+        std::reverse(sortedNodes.begin(), sortedNodes.end());
+        return sortedNodes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::setDeferredUpdatesEnabled(bool deferred)
+    {
+        if (!deferred)
+            flushLayouts();
+
+        deferredLayoutUpdates = deferred;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Layout::isDeferredUpdatesEnabled()
+    {
+        return deferredLayoutUpdates;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Layout::flushLayouts()
+    {
+        // Widgets that are resized while flushing only mark their layouts as dirty, they don't start a nested flush
+        if (dirtyLayouts.empty() || flushingLayouts)
+            return false;
+
+        flushingLayouts = true;
+
+        std::size_t evaluations = 0;
+        std::size_t passes = 0;
+        while (!dirtyLayouts.empty() && (passes < maxSolverPasses))
+        {
+            ++passes;
+
+            // Layouts that are marked as dirty after their turn in this pass (or that weren't part of the dependency graph
+            // when it was sorted, because a widget changed its bindings) remain in the dirty set for the next pass.
+            for (const auto& node : sortDirtyLayouts())
+            {
+                // Layouts that depend on the dirty ones are only recalculated when something they use actually changed.
+                // Destroyed layouts have been removed from the dirty set, so they also never get dereferenced here.
+                Layout* changedLayout = nullptr;
+                for (Layout* layout : {node.first, node.second})
+                {
+                    if (!layout || (dirtyLayouts.erase(layout) == 0))
+                        continue;
+
+                    ++evaluations;
+                    if (layout->recalculateTree() && !changedLayout)
+                        changedLayout = layout;
+                }
+
+                // Both components of the position or size are up-to-date now, so the widget only has to be updated once.
+                // The callback may replace the function object while it is being executed, so a copy of it is called.
+                if (changedLayout && changedLayout->m_connectedWidgetCallback)
+                {
+                    const auto callback = changedLayout->m_connectedWidgetCallback;
+                    callback();
+                }
             }
         }
+
+        if (!dirtyLayouts.empty())
+        {
+            TGUI_PRINT_WARNING("layouts kept changing after " << maxSolverPasses << " passes, are there bindings that depend on each other?");
+            dirtyLayouts.clear();
+        }
+
+        flushingLayouts = false;
+
+        solverStatistics.flushes++;
+        solverStatistics.lastFlushEvaluations = evaluations;
+        solverStatistics.lastFlushPasses = passes;
+        solverStatistics.totalEvaluations += evaluations;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout::SolverStatistics Layout::getSolverStatistics()
+    {
+        return solverStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::resetSolverStatistics()
+    {
+        solverStatistics = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::recalculateLayouts(const std::unordered_set<Layout*>& layouts)
+    {
+        if (layouts.empty())
+            return;
+
+        if (deferredLayoutUpdates)
+        {
+            for (auto* layout : layouts)
+                dirtyLayouts.insert(layout->getRootLayout());
+            return;
+        }
+
+        // Iterate over a copy of the layouts, as the set might be changed while the layouts are being recalculated
+        // when some layout gets copied in a setSize or setPosition function that gets called. Layouts that were
+        // destroyed in the meantime have been removed from the set and must no longer be accessed.
+        const std::vector<Layout*> layoutsCopy(layouts.begin(), layouts.end());
+        for (auto* layout : layoutsCopy)
+        {
+            if (layouts.count(layout) > 0)
+                layout->recalculateValue();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
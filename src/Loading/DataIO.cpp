@@ -39,34 +39,32 @@
 #define REMOVE_WHITESPACE_AND_COMMENTS(ReturnErrorOnEOF) \
     for (;;) \
     { \
-        stream >> std::ws; \
-        if (stream.peek() == EOF) \
+        input.skipWhitespace(); \
+        if (input.atEnd()) \
             break; \
         \
-        if (stream.peek() == '/') \
+        if (input.peek() == '/') \
         { \
-            char c; \
-            stream.read(&c, 1); \
-            if (stream.peek() == '/') \
+            input.skip(); \
+            if (input.peek() == '/') \
             { \
-                while (stream.peek() != EOF) \
+                while (!input.atEnd()) \
                 { \
-                    stream.read(&c, 1); \
-                    if (c == '\n') \
+                    if (input.read() == '\n') \
                         break; \
                 } \
             } \
-            else if (stream.peek() == '*') \
+            else if (input.peek() == '*') \
             { \
-                while (stream.peek() != EOF) \
+                while (!input.atEnd()) \
                 { \
-                    stream.read(&c, 1); \
-                    if (stream.peek() == '*') \
+                    input.skip(); \
+                    if (input.peek() == '*') \
                     { \
-                        stream.read(&c, 1); \
-                        if (stream.peek() == '/') \
+                        input.skip(); \
+                        if (input.peek() == '/') \
                         { \
-                            stream.read(&c, 1); \
+                            input.skip(); \
                             break; \
                         } \
                     } \
@@ -81,7 +79,7 @@
         break; \
     } \
     \
-    if (stream.peek() == EOF) \
+    if (input.atEnd()) \
     { \
         if (ReturnErrorOnEOF) \
             return "Unexpected EOF while parsing."; \
@@ -95,49 +93,169 @@ namespace tgui
 {
     namespace
     {
+        // Position in the UTF-8 encoded buffer that is being parsed
+        struct ParseInput
+        {
+            TGUI_NODISCARD bool atEnd() const
+            {
+                return pos == end;
+            }
+
+            TGUI_NODISCARD int peek() const
+            {
+                return (pos != end) ? static_cast<unsigned char>(*pos) : EOF;
+            }
+
+            char read()
+            {
+                return (pos != end) ? *pos++ : '\0';
+            }
+
+            void skip()
+            {
+                if (pos != end)
+                    ++pos;
+            }
+
+            void skipWhitespace()
+            {
+                while ((pos != end) && std::isspace(static_cast<unsigned char>(*pos)))
+                    ++pos;
+            }
+
+            const char* begin;
+            const char* pos;
+            const char* end;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Collects the characters of a word or value. As long as the characters are consecutive in the input, the token is
+        // only a view on the input. A copy is only made when e.g. a comment or multiple whitespace characters are skipped.
+        class TokenBuilder
+        {
+        public:
+            void appendFromInput(const char* charPtr)
+            {
+                if (!m_copied)
+                {
+                    if (!m_begin)
+                    {
+                        m_begin = charPtr;
+                        m_end = charPtr + 1;
+                        return;
+                    }
+                    else if (charPtr == m_end)
+                    {
+                        ++m_end;
+                        return;
+                    }
+
+                    m_buffer.assign(m_begin, m_end);
+                    m_copied = true;
+                }
+
+                m_buffer.push_back(*charPtr);
+            }
+
+            void appendChar(char c)
+            {
+                if (!m_copied)
+                {
+                    if (m_begin)
+                        m_buffer.assign(m_begin, m_end);
+                    m_copied = true;
+                }
+
+                m_buffer.push_back(c);
+            }
+
+            TGUI_NODISCARD CharStringView view() const
+            {
+                if (m_copied)
+                    return {m_buffer.data(), m_buffer.size()};
+                else if (m_begin)
+                    return {m_begin, static_cast<std::size_t>(m_end - m_begin)};
+                else
+                    return {};
+            }
+
+        private:
+            const char* m_begin = nullptr;
+            const char* m_end = nullptr;
+            bool m_copied = false;
+            std::string m_buffer;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TGUI_NODISCARD String toString(CharStringView view)
+        {
+            if (view.empty())
+                return {};
+
+            return String(view.data(), view.size());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TGUI_NODISCARD CharStringView trimView(CharStringView view)
+        {
+            std::size_t first = 0;
+            while ((first < view.size()) && std::isspace(static_cast<unsigned char>(view[first])))
+                ++first;
+
+            std::size_t last = view.size();
+            while ((last > first) && std::isspace(static_cast<unsigned char>(view[last - 1])))
+                --last;
+
+            return view.substr(first, last - first);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         // Forward declare one of the functions to solve circular dependency
-        String parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName);
+        String parseSection(ParseInput& input, const std::unique_ptr<DataIO::Node>& node, const String& sectionName);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String readWord(std::stringstream& stream)
+        String readWord(ParseInput& input)
         {
-            String word = "";
-            while (stream.peek() != EOF)
+            TokenBuilder word;
+            while (!input.atEnd())
             {
-                char c = static_cast<char>(stream.peek());
+                const char* charPtr = input.pos;
+                const char c = *charPtr;
                 if (c == '\r')
                 {
-                    stream.read(&c, 1);
-                    return word;
+                    input.skip();
+                    return toString(word.view());
                 }
                 else if (!std::isspace(static_cast<unsigned char>(c)) && (c != '=') && (c != ';') && (c != ':') && (c != '{') && (c != '}'))
                 {
-                    stream.read(&c, 1);
+                    input.skip();
 
-                    if ((c == '/') && (stream.peek() == '/'))
+                    if ((c == '/') && (input.peek() == '/'))
                     {
-                        while (stream.peek() != EOF)
+                        while (!input.atEnd())
                         {
-                            stream.read(&c, 1);
-                            if (c == '\n')
+                            if (input.read() == '\n')
                             {
-                                TGUI_ASSERT(!word.empty(), "There is no known case in which you can pass here with an empty word "
-                                                           "(comment would have been skipped earlier)");
-                                return word;
+                                TGUI_ASSERT(!word.view().empty(), "There is no known case in which you can pass here with an empty word "
+                                                                  "(comment would have been skipped earlier)");
+                                return toString(word.view());
                             }
                         }
                     }
-                    else if ((c == '/') && (stream.peek() == '*'))
+                    else if ((c == '/') && (input.peek() == '*'))
                     {
-                        while (stream.peek() != EOF)
+                        while (!input.atEnd())
                         {
-                            stream.read(&c, 1);
-                            if (c == '*')
+                            if (input.read() == '*')
                             {
-                                if (stream.peek() == '/')
+                                if (input.peek() == '/')
                                 {
-                                    stream.read(&c, 1);
+                                    input.skip();
                                     break;
                                 }
                             }
@@ -145,27 +263,28 @@ namespace tgui
                     }
                     else if (c == '"')
                     {
-                        word.push_back(c);
+                        word.appendFromInput(charPtr);
                         bool backslash = false;
-                        while (stream.peek() != EOF)
+                        while (!input.atEnd())
                         {
-                            stream.read(&c, 1);
-                            word.push_back(c);
+                            const char* quotedCharPtr = input.pos;
+                            const char quotedChar = input.read();
+                            word.appendFromInput(quotedCharPtr);
 
-                            if (c == '"' && !backslash)
+                            if (quotedChar == '"' && !backslash)
                                 break;
 
-                            if (c == '\\' && !backslash)
+                            if (quotedChar == '\\' && !backslash)
                                 backslash = true;
                             else
                                 backslash = false;
                         }
                     }
                     else
-                        word.push_back(c);
+                        word.appendFromInput(charPtr);
                 }
                 else
-                    return word;
+                    return toString(word.view());
             }
 
             return "";
@@ -173,37 +292,36 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String readLine(std::stringstream& stream)
+        CharStringView readLine(ParseInput& input, TokenBuilder& line)
         {
-            std::string line;
             bool whitespaceFound = false;
-            while (stream.peek() != EOF)
+            while (!input.atEnd())
             {
-                char c = static_cast<char>(stream.peek());
+                const char* charPtr = input.pos;
+                char c = *charPtr;
 
                 if (c == '/')
                 {
-                    stream.read(&c, 1);
-                    if (stream.peek() == '/')
+                    input.skip();
+                    if (input.peek() == '/')
                     {
-                        while (stream.peek() != EOF)
+                        while (!input.atEnd())
                         {
-                            stream.read(&c, 1);
-                            if (c == '\n')
+                            if (input.read() == '\n')
                                 break;
                         }
                     }
-                    else if (stream.peek() == '*')
+                    else if (input.peek() == '*')
                     {
-                        while (stream.peek() != EOF)
+                        while (!input.atEnd())
                         {
-                            stream.read(&c, 1);
-                            if (stream.peek() == '*')
+                            input.skip();
+                            if (input.peek() == '*')
                             {
-                                stream.read(&c, 1);
-                                if (stream.peek() == '/')
+                                input.skip();
+                                if (input.peek() == '/')
                                 {
-                                    stream.read(&c, 1);
+                                    input.skip();
                                     break;
                                 }
                             }
@@ -213,7 +331,7 @@ namespace tgui
                     else // The slash is part of the value
                     {
                         whitespaceFound = false;
-                        line.push_back(c);
+                        line.appendFromInput(charPtr);
                     }
 
                     continue;
@@ -221,14 +339,15 @@ namespace tgui
 
                 if (c == '"')
                 {
-                    stream.read(&c, 1);
-                    line.push_back(c);
+                    input.skip();
+                    line.appendFromInput(charPtr);
 
                     bool backslash = false;
-                    while (stream.peek() != EOF)
+                    while (!input.atEnd())
                     {
-                        stream.read(&c, 1);
-                        line.push_back(c);
+                        const char* quotedCharPtr = input.pos;
+                        c = input.read();
+                        line.appendFromInput(quotedCharPtr);
 
                         if (c == '"' && !backslash)
                             break;
@@ -239,65 +358,73 @@ namespace tgui
                             backslash = false;
                     }
 
-                    if (stream.peek() == EOF)
-                        return "";
+                    if (input.atEnd())
+                        return {};
 
-                    c = static_cast<char>(stream.peek());
+                    charPtr = input.pos;
+                    c = *charPtr;
                 }
 
                 if ((c == '=') || (c == '{'))
-                    return "";
+                    return {};
                 else if ((c == ';') || (c == '}'))
                 {
                     // Remove trailing whitespace before returning the line
-                    line.erase(line.find_last_not_of(" \n\r\t")+1);
-                    return line;
+                    CharStringView lineView = line.view();
+                    while (!lineView.empty() && ((lineView.back() == ' ') || (lineView.back() == '\n') || (lineView.back() == '\r') || (lineView.back() == '\t')))
+                        lineView = lineView.substr(0, lineView.size() - 1);
+
+                    return lineView;
                 }
-                else if (::isspace(c))
+                else if (std::isspace(static_cast<unsigned char>(c)))
                 {
-                    stream.read(&c, 1);
+                    input.skip();
                     if (!whitespaceFound)
                     {
+                        // Any amount of whitespace is replaced by a single space
                         whitespaceFound = true;
-                        line.push_back(' ');
+                        if (c == ' ')
+                            line.appendFromInput(charPtr);
+                        else
+                            line.appendChar(' ');
                     }
                 }
                 else
                 {
                     whitespaceFound = false;
-                    line.push_back(c);
-                    stream.read(&c, 1);
+                    line.appendFromInput(charPtr);
+                    input.skip();
                 }
             }
 
-            return "";
+            return {};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseKeyValue(std::stringstream& stream, std::unique_ptr<DataIO::Node>& node, const String& key)
+        String parseKeyValue(ParseInput& input, const std::unique_ptr<DataIO::Node>& node, const String& key)
         {
-            // Read the assignment symbol from the stream and remove the whitespace behind it
-            char chr;
-            stream.read(&chr, 1);
+            // Read the assignment symbol from the input and remove the whitespace behind it
+            input.skip();
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
 
             // Check for subsection as value
-            if (stream.peek() == '{')
-                return parseSection(stream, node, key);
+            if (input.peek() == '{')
+                return parseSection(input, node, key);
 
             // Read the value
-            String line = readLine(stream).trim();
+            TokenBuilder lineBuilder;
+            const CharStringView line = trimView(readLine(input, lineBuilder));
             if (!line.empty())
             {
                 // Remove the ';' if it is there
-                if (stream.peek() == ';')
-                    stream.read(&chr, 1);
+                if (input.peek() == ';')
+                    input.skip();
 
                 // Create a value node to store the value
                 auto valueNode = std::make_unique<DataIO::ValueNode>();
-                valueNode->value = line;
+                valueNode->value = toString(line);
 
                 // It might be a list node
                 if ((line.size() >= 2) && (line[0] == '[') && (line.back() == ']'))
@@ -305,27 +432,24 @@ namespace tgui
                     valueNode->listNode = true;
                     if (line.size() >= 3)
                     {
-                        valueNode->valueList.emplace_back("");
-
+                        // The items are separated by commas, unless the comma is part of a quoted string
+                        std::size_t itemStart = 1;
                         std::size_t i = 1;
                         while (i < line.size()-1)
                         {
                             if (line[i] == ',')
                             {
+                                valueNode->valueList.push_back(toString(trimView(line.substr(itemStart, i - itemStart))));
                                 i++;
-                                valueNode->valueList.back() = valueNode->valueList.back().trim();
-                                valueNode->valueList.emplace_back("");
+                                itemStart = i;
                             }
                             else if (line[i] == '"')
                             {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().size(), 1, line[i]);
                                 i++;
 
                                 bool backslash = false;
                                 while (i < line.size()-1)
                                 {
-                                    valueNode->valueList.back().insert(valueNode->valueList.back().size(), 1, line[i]);
-
                                     if (line[i] == '"' && !backslash)
                                     {
                                         i++;
@@ -341,13 +465,10 @@ namespace tgui
                                 }
                             }
                             else
-                            {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().size(), 1, line[i]);
                                 i++;
-                            }
                         }
 
-                        valueNode->valueList.back() = valueNode->valueList.back().trim();
+                        valueNode->valueList.push_back(toString(trimView(line.substr(itemStart, line.size() - 1 - itemStart))));
                     }
                 }
 
@@ -356,11 +477,11 @@ namespace tgui
             }
             else
             {
-                if (stream.peek() == EOF)
+                if (input.atEnd())
                     return "Found EOF while trying to read a value.";
                 else
                 {
-                    chr = static_cast<char>(stream.peek());
+                    const int chr = input.peek();
                     if (chr == '=')
                         return "Found '=' while trying to read a value.";
                     else if (chr == '{')
@@ -373,14 +494,13 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseInheritance(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName)
+        String parseInheritance(ParseInput& input, const std::unique_ptr<DataIO::Node>& node, const String& sectionName)
         {
-            // Read the colon from the stream
-            char chr;
-            stream.read(&chr, 1);
+            // Read the colon from the input
+            input.skip();
             REMOVE_WHITESPACE_AND_COMMENTS(true)
 
-            String baseSectionName = readWord(stream);
+            String baseSectionName = readWord(input);
             if (baseSectionName.empty())
                 return "Expected name of base section to inherit from after ':'.";
 
@@ -404,10 +524,10 @@ namespace tgui
                 return "Failed to find base section '" + baseSectionName + "' to inherit from.";
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
-            if (stream.peek() != '{')
+            if (input.peek() != '{')
                 return "Expected '{' after specifying base section to inherit from.";
 
-            const auto& error = parseSection(stream, node, sectionName);
+            const auto& error = parseSection(input, node, sectionName);
             if (!error.empty())
                 return error;
 
@@ -435,65 +555,64 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName)
+        String parseSection(ParseInput& input, const std::unique_ptr<DataIO::Node>& node, const String& sectionName)
         {
             // Create a new node for this section
             auto sectionNode = std::make_unique<DataIO::Node>();
             sectionNode->parent = node.get();
             sectionNode->name = sectionName;
 
-            // Read the brace from the stream
-            char chr;
-            stream.read(&chr, 1);
+            // Read the brace from the input
+            input.skip();
 
-            while (stream.peek() != EOF)
+            while (!input.atEnd())
             {
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
 
-                String word = readWord(stream);
+                String word = readWord(input);
                 if (word == U"")
                 {
-                    if (stream.peek() == EOF)
+                    if (input.atEnd())
                         return "Found EOF while trying to read property or nested section name.";
-                    else if (stream.peek() == '}')
+                    else if (input.peek() == '}')
                     {
                         node->children.push_back(std::move(sectionNode));
 
-                        stream.read(&chr, 1);
+                        input.skip();
 
                         // Ignore semicolon behind closing brace
                         REMOVE_WHITESPACE_AND_COMMENTS(false)
-                        if (stream.peek() == ';')
-                            stream.read(&chr, 1);
+                        if (input.peek() == ';')
+                            input.skip();
 
                         REMOVE_WHITESPACE_AND_COMMENTS(false)
                         return "";
                     }
-                    else if (stream.peek() != '{')
-                        return "Expected property or nested section name, found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+                    else if (input.peek() != '{')
+                        return "Expected property or nested section name, found '" + String(1, *input.pos) + "' instead.";
                 }
 
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() == '{')
+                if (input.peek() == '{')
                 {
-                    String error = parseSection(stream, sectionNode, word);
+                    String error = parseSection(input, sectionNode, word);
                     if (!error.empty())
                         return error;
                 }
-                else if (stream.peek() == '=')
+                else if (input.peek() == '=')
                 {
-                    String error = parseKeyValue(stream, sectionNode, word);
+                    String error = parseKeyValue(input, sectionNode, word);
                     if (!error.empty())
                         return error;
                 }
-                else if (stream.peek() == ':')
+                else if (input.peek() == ':')
                 {
-                    String error = parseInheritance(stream, sectionNode, word);
+                    String error = parseInheritance(input, sectionNode, word);
                     if (!error.empty())
                         return error;
                 }
                 else
-                    return "Expected '{', '=' or ':', found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+                    return "Expected '{', '=' or ':', found '" + String(1, *input.pos) + "' instead.";
             }
 
             return "Found EOF while reading section.";
@@ -501,27 +620,27 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseRootSection(std::stringstream& stream, std::unique_ptr<DataIO::Node>& root)
+        String parseRootSection(ParseInput& input, const std::unique_ptr<DataIO::Node>& root)
         {
             REMOVE_WHITESPACE_AND_COMMENTS(false)
 
-            String word = readWord(stream);
+            String word = readWord(input);
             if (word == U"")
             {
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() != '{')
-                    return "Expected section name, found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+                if (input.peek() != '{')
+                    return "Expected section name, found '" + String(1, *input.pos) + "' instead.";
             }
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
-            if (stream.peek() == '{')
-                return parseSection(stream, root, word);
-            else if (stream.peek() == '=')
-                return parseKeyValue(stream, root, word);
-            else if (stream.peek() == ':')
-                return parseInheritance(stream, root, word);
+            if (input.peek() == '{')
+                return parseSection(input, root, word);
+            else if (input.peek() == '=')
+                return parseKeyValue(input, root, word);
+            else if (input.peek() == ':')
+                return parseInheritance(input, root, word);
             else
-                return "Expected '{', '=' or ':', found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+                return "Expected '{', '=' or ':', found '" + String(1, *input.pos) + "' instead.";
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -570,20 +689,29 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::unique_ptr<DataIO::Node> DataIO::parse(std::stringstream& stream)
+    {
+        // Parse the part of the stream that hasn't been read yet
+        const std::string contents = stream.str();
+        const auto readPos = stream.tellg();
+        const std::size_t offset = (readPos > 0) ? std::min(static_cast<std::size_t>(readPos), contents.size()) : 0;
+        return parse(CharStringView{contents.data() + offset, contents.size() - offset});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DataIO::parse(CharStringView data)
     {
         auto root = std::make_unique<Node>();
 
-        String error;
-        while (stream.peek() != EOF)
+        ParseInput input{data.data(), data.data(), data.data() + data.size()};
+        while (!input.atEnd())
         {
-            error = parseRootSection(stream, root);
+            const String error = parseRootSection(input, root);
             if (!error.empty())
             {
-                const auto position = stream.tellg();
-                if (position != std::stringstream::pos_type(-1))
+                if (!input.atEnd())
                 {
-                    String str = stream.str();
-                    auto lineNumber = std::count(str.begin(), str.begin() + static_cast<std::ptrdiff_t>(position), U'\n') + 1;
+                    const auto lineNumber = std::count(input.begin, input.pos, '\n') + 1;
                     throw Exception{U"Error while parsing input at line " + String::fromNumber(lineNumber) + U". " + error};
                 }
                 else
@@ -434,8 +434,8 @@ namespace tgui
 
         ObjectConverter deserializeRendererData(const String& renderer)
         {
-            std::stringstream ss{renderer.toStdString()};
-            auto node = DataIO::parse(ss);
+            const std::string str = renderer.toStdString();
+            auto node = DataIO::parse(CharStringView{str.data(), str.size()});
 
             // The root node should contain exactly one child which is the node we need
             if (node->propertyValuePairs.empty() && (node->children.size() == 1))
@@ -452,6 +452,7 @@ namespace tgui
                 rendererData->propertyValuePairs[child->name] = {String("{\n" + ss2.str() + "}")};
             }
 
+            rendererData->propertyValuePairs.deserializeValues();
             return rendererData;
         }
 
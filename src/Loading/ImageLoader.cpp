@@ -83,14 +83,145 @@
 
 #include <cstring> // memcpy
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <atomic>
+    #include <condition_variable>
+    #include <deque>
+    #include <thread>
+    #include <mutex>
+    #include <map>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        struct PreloadedImage
+        {
+            std::unique_ptr<std::uint8_t[]> pixels;
+            Vector2u size;
+        };
+
+        // Images that were decoded by preloadFiles, they are removed from the map when they are loaded with loadFromFile
+        std::map<String, PreloadedImage> preloadedImages;
+        std::mutex preloadedImagesMutex;
+
+        PreloadedImage decodeImageFile(const String& filename)
+        {
+            PreloadedImage image;
+            std::size_t fileSize;
+            const auto fileContents = readFileToMemory(filename, fileSize);
+            if (fileContents)
+                image.pixels = ImageLoader::loadFromMemory(fileContents.get(), fileSize, image.size);
+
+            return image;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Threads that decode the images passed to decodeFileAsync
+        class AsyncImageDecoder
+        {
+        public:
+
+            AsyncImageDecoder()
+            {
+                const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+                const unsigned int threadCount = (hardwareThreads > 2) ? std::min(hardwareThreads - 1, 4u) : 1u;
+                for (unsigned int i = 0; i < threadCount; ++i)
+                    m_threads.emplace_back([this]{ decodeFiles(); });
+            }
+
+            ~AsyncImageDecoder()
+            {
+                {
+                    const std::lock_guard<std::mutex> lock(m_mutex);
+                    m_stopping = true;
+                }
+                m_condition.notify_all();
+
+                // Files that haven't been started yet are simply dropped
+                for (auto& thread : m_threads)
+                    thread.join();
+            }
+
+            AsyncImageDecoder(const AsyncImageDecoder&) = delete;
+            AsyncImageDecoder& operator=(const AsyncImageDecoder&) = delete;
+
+            void addFile(const String& filename)
+            {
+                {
+                    const std::lock_guard<std::mutex> lock(m_mutex);
+                    m_pendingFiles.push_back(filename);
+                }
+                m_condition.notify_one();
+            }
+
+            TGUI_NODISCARD std::vector<ImageLoader::DecodedFile> takeDecodedFiles()
+            {
+                std::vector<ImageLoader::DecodedFile> decodedFiles;
+                const std::lock_guard<std::mutex> lock(m_mutex);
+                decodedFiles.swap(m_decodedFiles);
+                return decodedFiles;
+            }
+
+        private:
+
+            void decodeFiles()
+            {
+                while (true)
+                {
+                    ImageLoader::DecodedFile file;
+                    {
+                        std::unique_lock<std::mutex> lock(m_mutex);
+                        m_condition.wait(lock, [this]{ return m_stopping || !m_pendingFiles.empty(); });
+                        if (m_stopping)
+                            break;
+
+                        file.filename = std::move(m_pendingFiles.front());
+                        m_pendingFiles.pop_front();
+                    }
+
+                    file.pixels = ImageLoader::loadFromFile(file.filename, file.size);
+
+                    const std::lock_guard<std::mutex> lock(m_mutex);
+                    m_decodedFiles.push_back(std::move(file));
+                }
+            }
+
+        private:
+
+            std::vector<std::thread> m_threads;
+            std::mutex m_mutex;
+            std::condition_variable m_condition;
+            std::deque<String> m_pendingFiles;
+            std::vector<ImageLoader::DecodedFile> m_decodedFiles;
+            bool m_stopping = false;
+        };
+
+        // Only accessed from the gui thread, the threads are started when the first file is decoded asynchronously
+        std::unique_ptr<AsyncImageDecoder> asyncImageDecoder;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::unique_ptr<std::uint8_t[]> ImageLoader::loadFromFile(const String& filename, Vector2u& imageSize)
     {
+        {
+            const std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+            const auto it = preloadedImages.find(filename);
+            if (it != preloadedImages.end())
+            {
+                auto pixels = std::move(it->second.pixels);
+                imageSize = it->second.size;
+                preloadedImages.erase(it);
+                return pixels;
+            }
+        }
+
         std::size_t fileSize;
         auto fileContents = readFileToMemory(filename, fileSize);
         if (!fileContents)
@@ -127,6 +258,92 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ImageLoader::preloadFiles(const std::vector<String>& filenames)
+    {
+        std::vector<String> filesToDecode;
+        {
+            const std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+            for (const auto& filename : filenames)
+            {
+                if ((preloadedImages.find(filename) == preloadedImages.end())
+                 && (std::find(filesToDecode.begin(), filesToDecode.end(), filename) == filesToDecode.end()))
+                    filesToDecode.push_back(filename);
+            }
+        }
+
+        if (filesToDecode.empty())
+            return;
+
+        // Each thread keeps taking the next file from the list until all files are decoded
+        std::vector<PreloadedImage> images(filesToDecode.size());
+        std::atomic<std::size_t> nextIndex{0};
+        const auto decodeFiles = [&filesToDecode,&images,&nextIndex]{
+            for (std::size_t i = nextIndex++; i < filesToDecode.size(); i = nextIndex++)
+                images[i] = decodeImageFile(filesToDecode[i]);
+        };
+
+        const std::size_t threadCount = std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()), filesToDecode.size());
+        std::vector<std::thread> threads;
+        for (std::size_t i = 1; i < threadCount; ++i)
+            threads.emplace_back(decodeFiles);
+
+        decodeFiles();
+        for (auto& thread : threads)
+            thread.join();
+
+        const std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+        for (std::size_t i = 0; i < filesToDecode.size(); ++i)
+        {
+            if (images[i].pixels)
+                preloadedImages[filesToDecode[i]] = std::move(images[i]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ImageLoader::decodeFileAsync(const String& filename)
+    {
+        if (!asyncImageDecoder)
+            asyncImageDecoder = std::make_unique<AsyncImageDecoder>();
+
+        asyncImageDecoder->addFile(filename);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<ImageLoader::DecodedFile> ImageLoader::takeDecodedFiles()
+    {
+        if (!asyncImageDecoder)
+            return {};
+
+        return asyncImageDecoder->takeDecodedFiles();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ImageLoader::cancelAsyncDecoding()
+    {
+        asyncImageDecoder = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ImageLoader::clearPreloadedFiles()
+    {
+        const std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+        preloadedImages.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ImageLoader::getPreloadedFilesCount()
+    {
+        const std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+        return preloadedImages.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
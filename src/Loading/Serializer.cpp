@@ -301,13 +301,13 @@ namespace tgui
         String serializeRendererData(ObjectConverter&& value)
         {
             auto node = std::make_unique<DataIO::Node>();
-            for (const auto& pair : value.getRenderer()->propertyValuePairs)
+            for (const auto& pair : value.getRenderer()->propertyValuePairs.getMap())
             {
                 String strValue;
                 if (pair.second.getType() == ObjectConverter::Type::RendererData)
                 {
-                    std::stringstream ss{ObjectConverter{pair.second}.getString().toStdString()};
-                    node->children.push_back(DataIO::parse(ss));
+                    const std::string str = ObjectConverter{pair.second}.getString().toStdString();
+                    node->children.push_back(DataIO::parse(CharStringView{str.data(), str.size()}));
                     node->children.back()->name = pair.first;
                 }
                 else
@@ -314,6 +314,31 @@ namespace tgui
                     pair.second->connectedTheme = this;
             }
         };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Fills the renderer with the properties of a theme section. Values of which the type is known are deserialized
+        // immediately, so that widgets (and copies of the renderer, which share the values) don't have to parse them.
+        void loadRendererProperties(RendererData& renderer, const std::map<String, String>& properties)
+        {
+            for (const auto& property : properties)
+                renderer.propertyValuePairs[property.first] = ObjectConverter(property.second);
+
+            renderer.propertyValuePairs.deserializeValues();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void loadGlobalProperties(std::map<String, ObjectConverter>& globalProperties, const std::map<String, String>& properties)
+        {
+            globalProperties.clear();
+            for (const auto& property : properties)
+            {
+                ObjectConverter& value = globalProperties[property.first];
+                value = ObjectConverter(property.second);
+                RendererPropertyId::find(property.first).deserializeValue(value);
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -535,9 +560,7 @@ namespace tgui
         m_themeLoader->preload(primary);
 
         // Load the global properties
-        const auto& globalProperties = m_themeLoader->getGlobalProperties(m_primary);
-        for (const auto& property : globalProperties)
-            m_globalProperties[property.first] = ObjectConverter(property.second);
+        loadGlobalProperties(m_globalProperties, m_themeLoader->getGlobalProperties(m_primary));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -630,10 +653,7 @@ namespace tgui
         m_themeLoader->preload(primary);
 
         // Load the new global properties
-        m_globalProperties.clear();
-        const auto& globalProperties = m_themeLoader->getGlobalProperties(m_primary);
-        for (const auto& property : globalProperties)
-            m_globalProperties[property.first] = ObjectConverter(property.second);
+        loadGlobalProperties(m_globalProperties, m_themeLoader->getGlobalProperties(m_primary));
 
         // Update the existing widgets that were using renderers from this theme
         for (auto& pair : m_renderers)
@@ -648,8 +668,7 @@ namespace tgui
             renderer = RendererData::create();
             renderer->observers = std::move(observers);
             renderer->connectedTheme = this;
-            for (const auto& property : properties)
-                renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
+            loadRendererProperties(*renderer, properties);
 
             for (auto& observer : renderer->observers)
                 observer->setRenderer(renderer);
@@ -665,13 +684,11 @@ namespace tgui
         if (it != m_renderers.end())
             return it->second;
 
-        m_renderers[id] = RendererData::create();
-        m_renderers[id]->connectedTheme = this;
-        auto& properties = m_themeLoader->load(m_primary, id);
-        for (const auto& property : properties)
-            m_renderers[id]->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
-        return m_renderers[id];
+        auto renderer = RendererData::create();
+        renderer->connectedTheme = this;
+        m_renderers[id] = renderer;
+        loadRendererProperties(*renderer, m_themeLoader->load(m_primary, id));
+        return renderer;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -686,14 +703,11 @@ namespace tgui
         if (!m_themeLoader->canLoad(m_primary, id))
             return nullptr;
 
-        m_renderers[id] = RendererData::create();
-        m_renderers[id]->connectedTheme = this;
-
-        const auto& properties = m_themeLoader->load(m_primary, id);
-        for (const auto& property : properties)
-            m_renderers[id]->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
-        return m_renderers[id];
+        auto renderer = RendererData::create();
+        renderer->connectedTheme = this;
+        m_renderers[id] = renderer;
+        loadRendererProperties(*renderer, m_themeLoader->load(m_primary, id));
+        return renderer;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,10 +26,13 @@
 #include <TGUI/Loading/ThemeLoader.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
+#include <TGUI/Loading/ImageLoader.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <sstream>
     #include <fstream>
+    #include <cstdint>
+    #include <cstring>
 #endif
 
 // Ignore warning "C4503: decorated name length exceeded, name was truncated" in Visual Studio
@@ -41,10 +44,142 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Binary cache layout (all integers are stored in little endian):
+        //   8 bytes magic, uint32 version, uint64 hash of theme file
+        //   uint32 string count N, (N+1) uint32 offsets into string data, UTF-8 string data
+        //   uint32 global property count, (uint32 key index, uint32 value index) per property
+        //   uint32 section count, per section: uint32 name index, uint32 property count, (uint32 key, uint32 value) per property
+        const char binaryCacheMagic[8] = {'T', 'G', 'U', 'I', 'T', 'H', 'M', 'B'};
+        const std::uint32_t binaryCacheVersion = 1;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        String getFullFilename(const String& filename)
+        {
+#ifdef TGUI_SYSTEM_WINDOWS
+            if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.size() <= 1) || (filename[1] != ':')))
+#else
+            if (filename[0] != '/')
+#endif
+                return (getResourcePath() / filename).asString();
+            else
+                return filename;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the FNV-1a hash of the theme file, or 0 if the file couldn't be read
+        std::uint64_t getThemeFileHash(const String& filename)
+        {
+            std::size_t fileSize;
+            const auto fileContents = readFileToMemory(getFullFilename(filename), fileSize);
+            if (!fileContents)
+                return 0;
+
+            std::uint64_t hash = 14695981039346656037u;
+            for (std::size_t i = 0; i < fileSize; ++i)
+            {
+                hash ^= fileContents[i];
+                hash *= 1099511628211u;
+            }
+
+            return hash;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeUInt32(std::string& buffer, std::uint32_t value)
+        {
+            for (unsigned int i = 0; i < 4; ++i)
+                buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+        }
+
+        void writeUInt64(std::string& buffer, std::uint64_t value)
+        {
+            for (unsigned int i = 0; i < 8; ++i)
+                buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Reads integers from the binary cache while checking that the data doesn't end prematurely
+        struct BinaryReader
+        {
+            bool readUInt32(std::uint32_t& value)
+            {
+                if (size - pos < 4)
+                    return false;
+
+                value = 0;
+                for (unsigned int i = 0; i < 4; ++i)
+                    value |= static_cast<std::uint32_t>(data[pos++]) << (8 * i);
+                return true;
+            }
+
+            bool readUInt64(std::uint64_t& value)
+            {
+                if (size - pos < 8)
+                    return false;
+
+                value = 0;
+                for (unsigned int i = 0; i < 8; ++i)
+                    value |= static_cast<std::uint64_t>(data[pos++]) << (8 * i);
+                return true;
+            }
+
+            const std::uint8_t* data;
+            std::size_t size;
+            std::size_t pos;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Extracts the image filename from a serialized texture and adds it to the list
+        void addTextureFilename(const String& property, const String& value, std::vector<String>& filenames)
+        {
+            if (((property.size() < 7) || (property.substr(0, 7) != U"Texture")) && (property != U"Image") && (property != U"Icon"))
+                return;
+
+            if (value.empty() || viewEqualIgnoreCase(value, U"none") || viewEqualIgnoreCase(value, U"null") || viewEqualIgnoreCase(value, U"nullptr"))
+                return;
+
+            String filename;
+            if (value[0] == '"')
+            {
+                const auto closingQuotePos = value.find('"', 1);
+                if (closingQuotePos == String::npos)
+                    return;
+
+                filename = value.substr(1, closingQuotePos - 1);
+            }
+            else
+                filename = value;
+
+            // Embedded images and svg images aren't decoded by the ImageLoader
+            if (filename.empty() || filename.starts_with(U"data:")
+             || ((filename.length() > 4) && viewEqualIgnoreCase(StringView(filename.c_str() + (filename.length() - 4), 4), U".svg")))
+                return;
+
+            filenames.push_back(getFullFilename(filename));
+        }
+
+        void addTextureFilenames(const std::unique_ptr<DataIO::Node>& node, std::vector<String>& filenames)
+        {
+            for (const auto& pair : node->propertyValuePairs)
+                addTextureFilename(pair.first, pair.second->value, filenames);
+
+            for (const auto& child : node->children)
+                addTextureFilenames(child, filenames);
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::map<String, std::map<String, std::map<String, String>>> DefaultThemeLoader::m_propertiesCache;
     std::map<String, std::map<String, String>> DefaultThemeLoader::m_globalPropertiesCache;
+    bool DefaultThemeLoader::m_imagePreloadingEnabled = false;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -210,6 +345,9 @@ namespace tgui
                     m_propertiesCache[filename][name][nestedProperty->name] = "{\n" + ss.str() + "}";
                 }
             }
+
+            if (m_imagePreloadingEnabled)
+                preloadImages(filename);
         }
     }
 
@@ -249,30 +387,218 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void DefaultThemeLoader::saveBinaryCache(const String& filename, const String& cacheFilename)
+    {
+        preload(filename);
+
+        // Every string is only stored once, properties refer to strings by their index
+        std::vector<std::string> strings;
+        std::map<String, std::uint32_t> stringIndices;
+        const auto getStringIndex = [&strings,&stringIndices](const String& str){
+            const auto it = stringIndices.find(str);
+            if (it != stringIndices.end())
+                return it->second;
+
+            const auto index = static_cast<std::uint32_t>(strings.size());
+            strings.push_back(str.toStdString());
+            stringIndices[str] = index;
+            return index;
+        };
+
+        std::string propertiesBuffer;
+        const auto& globalProperties = m_globalPropertiesCache[filename];
+        writeUInt32(propertiesBuffer, static_cast<std::uint32_t>(globalProperties.size()));
+        for (const auto& pair : globalProperties)
+        {
+            writeUInt32(propertiesBuffer, getStringIndex(pair.first));
+            writeUInt32(propertiesBuffer, getStringIndex(pair.second));
+        }
+
+        const auto& sections = m_propertiesCache[filename];
+        writeUInt32(propertiesBuffer, static_cast<std::uint32_t>(sections.size()));
+        for (const auto& section : sections)
+        {
+            writeUInt32(propertiesBuffer, getStringIndex(section.first));
+            writeUInt32(propertiesBuffer, static_cast<std::uint32_t>(section.second.size()));
+            for (const auto& pair : section.second)
+            {
+                writeUInt32(propertiesBuffer, getStringIndex(pair.first));
+                writeUInt32(propertiesBuffer, getStringIndex(pair.second));
+            }
+        }
+
+        std::string buffer(binaryCacheMagic, sizeof(binaryCacheMagic));
+        writeUInt32(buffer, binaryCacheVersion);
+        writeUInt64(buffer, getThemeFileHash(filename));
+
+        writeUInt32(buffer, static_cast<std::uint32_t>(strings.size()));
+        std::uint32_t stringOffset = 0;
+        writeUInt32(buffer, stringOffset);
+        for (const auto& str : strings)
+        {
+            stringOffset += static_cast<std::uint32_t>(str.size());
+            writeUInt32(buffer, stringOffset);
+        }
+
+        for (const auto& str : strings)
+            buffer += str;
+
+        buffer += propertiesBuffer;
+
+        std::ofstream file{Filesystem::Path(getFullFilename(cacheFilename)).asNativeString().c_str(), std::ios::binary};
+        if (!file || !file.write(buffer.data(), static_cast<std::streamsize>(buffer.size())))
+            throw Exception{U"Failed to write binary theme cache to '" + cacheFilename + U"'."};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DefaultThemeLoader::loadBinaryCache(const String& filename, const String& cacheFilename)
+    {
+        if (filename.empty() || cacheFilename.empty())
+            return false;
+
+        std::size_t fileSize;
+        const auto fileContents = readFileToMemory(getFullFilename(cacheFilename), fileSize);
+        if (!fileContents || (fileSize < sizeof(binaryCacheMagic)) || (std::memcmp(fileContents.get(), binaryCacheMagic, sizeof(binaryCacheMagic)) != 0))
+            return false;
+
+        BinaryReader reader{fileContents.get(), fileSize, sizeof(binaryCacheMagic)};
+
+        std::uint32_t version;
+        std::uint64_t hash;
+        if (!reader.readUInt32(version) || (version != binaryCacheVersion) || !reader.readUInt64(hash))
+            return false;
+
+        // Don't use the cache when the theme file was changed after the cache was created
+        if (hash != 0)
+        {
+            const std::uint64_t themeFileHash = getThemeFileHash(filename);
+            if ((themeFileHash != 0) && (themeFileHash != hash))
+                return false;
+        }
+
+        std::uint32_t stringCount;
+        if (!reader.readUInt32(stringCount) || (stringCount > (fileSize - reader.pos) / 4))
+            return false;
+
+        std::vector<std::uint32_t> stringOffsets(static_cast<std::size_t>(stringCount) + 1);
+        for (auto& offset : stringOffsets)
+        {
+            if (!reader.readUInt32(offset))
+                return false;
+        }
+
+        const std::size_t stringDataStart = reader.pos;
+        if (stringOffsets.back() > fileSize - stringDataStart)
+            return false;
+
+        std::vector<String> strings;
+        strings.reserve(stringCount);
+        for (std::size_t i = 0; i < stringCount; ++i)
+        {
+            if (stringOffsets[i] > stringOffsets[i+1])
+                return false;
+
+            const char* str = reinterpret_cast<const char*>(fileContents.get() + stringDataStart + stringOffsets[i]);
+            strings.emplace_back(str, stringOffsets[i+1] - stringOffsets[i]);
+        }
+        reader.pos += stringOffsets.back();
+
+        const auto readProperties = [&reader,&strings](std::map<String, String>& properties){
+            std::uint32_t propertyCount;
+            if (!reader.readUInt32(propertyCount))
+                return false;
+
+            for (std::uint32_t i = 0; i < propertyCount; ++i)
+            {
+                std::uint32_t keyIndex;
+                std::uint32_t valueIndex;
+                if (!reader.readUInt32(keyIndex) || !reader.readUInt32(valueIndex) || (keyIndex >= strings.size()) || (valueIndex >= strings.size()))
+                    return false;
+
+                properties[strings[keyIndex]] = strings[valueIndex];
+            }
+
+            return true;
+        };
+
+        std::map<String, String> globalProperties;
+        if (!readProperties(globalProperties))
+            return false;
+
+        std::uint32_t sectionCount;
+        if (!reader.readUInt32(sectionCount))
+            return false;
+
+        std::map<String, std::map<String, String>> sections;
+        for (std::uint32_t i = 0; i < sectionCount; ++i)
+        {
+            std::uint32_t nameIndex;
+            if (!reader.readUInt32(nameIndex) || (nameIndex >= strings.size()) || !readProperties(sections[strings[nameIndex]]))
+                return false;
+        }
+
+        m_globalPropertiesCache[filename] = std::move(globalProperties);
+        m_propertiesCache[filename] = std::move(sections);
+
+        if (m_imagePreloadingEnabled)
+            preloadImages(filename);
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DefaultThemeLoader::setImagePreloadingEnabled(bool enabled)
+    {
+        m_imagePreloadingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DefaultThemeLoader::isImagePreloadingEnabled()
+    {
+        return m_imagePreloadingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DefaultThemeLoader::preloadImages(const String& filename) const
+    {
+        std::vector<String> imageFilenames;
+        for (const auto& section : m_propertiesCache[filename])
+        {
+            for (const auto& pair : section.second)
+            {
+                // Nested sections (e.g. the scrollbar inside a list box) can also contain textures
+                if (!pair.second.empty() && (pair.second[0] == '{'))
+                {
+                    const std::string str = pair.second.toStdString();
+                    addTextureFilenames(DataIO::parse(CharStringView{str.data(), str.size()}), imageFilenames);
+                }
+                else
+                    addTextureFilename(pair.first, pair.second, imageFilenames);
+            }
+        }
+
+        ImageLoader::preloadFiles(imageFilenames);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::unique_ptr<DataIO::Node> DefaultThemeLoader::readFile(const String& filename) const
     {
         if (filename.empty())
             return nullptr;
 
-        String fullFilename;
-#ifdef TGUI_SYSTEM_WINDOWS
-        if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.size() <= 1) || (filename[1] != ':')))
-#else
-        if (filename[0] != '/')
-#endif
-            fullFilename = (getResourcePath() / filename).asString();
-        else
-            fullFilename = filename;
+        const String fullFilename = getFullFilename(filename);
 
         std::size_t fileSize;
         auto fileContents = readFileToMemory(fullFilename, fileSize);
         if (!fileContents)
             throw Exception{U"Failed to open theme file '" + fullFilename + U"'."};
 
-        std::stringstream stream;
-        stream.write(reinterpret_cast<char*>(fileContents.get()), static_cast<std::streamsize>(fileSize));
-
-        std::unique_ptr<DataIO::Node> root = DataIO::parse(stream);
+        std::unique_ptr<DataIO::Node> root = DataIO::parse(CharStringView{reinterpret_cast<const char*>(fileContents.get()), fileSize});
 
         String resourcePath;
         auto slashPos = filename.find_last_of("/\\");
@@ -39,17 +39,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TGUI_RENDERER_PROPERTY_REGISTER_TYPE(BoxLayoutRenderer, SpaceBetweenWidgets, Number)
+
     float BoxLayoutRenderer::getSpaceBetweenWidgets() const
     {
-        auto it = m_data->propertyValuePairs.find("SpaceBetweenWidgets");
-        if (it != m_data->propertyValuePairs.end())
-            return it->second.getNumber();
+        static const RendererPropertyId spaceBetweenWidgetsId{U"SpaceBetweenWidgets"};
+        static const RendererPropertyId paddingId{U"Padding"};
+
+        ObjectConverter* value = m_data->propertyValuePairs.lookup(spaceBetweenWidgetsId);
+        if (value)
+            return value->getNumber();
         else
         {
-            it = m_data->propertyValuePairs.find("Padding");
-            if (it != m_data->propertyValuePairs.end())
+            value = m_data->propertyValuePairs.lookup(paddingId);
+            if (value)
             {
-                const Padding padding = it->second.getOutline();
+                const Padding padding = value->getOutline();
                 return std::max(std::min(padding.getLeft(), padding.getRight()), std::min(padding.getTop(), padding.getBottom()));
             }
             else
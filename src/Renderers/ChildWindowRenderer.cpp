@@ -54,16 +54,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TGUI_RENDERER_PROPERTY_REGISTER_TYPE(ChildWindowRenderer, TitleBarHeight, Number)
+
     float ChildWindowRenderer::getTitleBarHeight() const
     {
-        auto it = m_data->propertyValuePairs.find("TitleBarHeight");
-        if (it != m_data->propertyValuePairs.end())
-            return it->second.getNumber();
+        static const RendererPropertyId titleBarHeightId{U"TitleBarHeight"};
+        static const RendererPropertyId textureTitleBarId{U"TextureTitleBar"};
+
+        ObjectConverter* value = m_data->propertyValuePairs.lookup(titleBarHeightId);
+        if (value)
+            return value->getNumber();
         else
         {
-            it = m_data->propertyValuePairs.find("TextureTitleBar");
-            if (it != m_data->propertyValuePairs.end() && it->second.getTexture().getData())
-                return static_cast<float>(it->second.getTexture().getImageSize().y);
+            value = m_data->propertyValuePairs.lookup(textureTitleBarId);
+            if (value && value->getTexture().getData())
+                return static_cast<float>(value->getTexture().getImageSize().y);
             else
                 return 20;
         }
@@ -24,13 +24,426 @@
 
 
 #include <TGUI/Renderers/WidgetRenderer.hpp>
+#include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/RendererDefines.hpp>
 #include <TGUI/Widget.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <unordered_map>
+    #include <deque>
+    #include <mutex>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        struct StringHasher
+        {
+            std::size_t operator()(const String& str) const
+            {
+                return std::hash<std::u32string>{}(str.toUtf32());
+            }
+        };
+
+        struct PropertyNameRegistry
+        {
+            std::mutex mutex;
+            std::unordered_map<String, std::uint32_t, StringHasher> ids;
+            std::deque<String> names; // Deque doesn't invalidate references to its elements when adding to it
+            std::vector<ObjectConverter::Type> types; // Type::None when unknown
+            std::vector<bool> typeConflicts; // True when the name was registered with multiple different types
+        };
+
+        std::uint32_t internPropertyName(PropertyNameRegistry& registry, const String& name)
+        {
+            const auto it = registry.ids.find(name);
+            if (it != registry.ids.end())
+                return it->second;
+
+            const auto index = static_cast<std::uint32_t>(registry.names.size());
+            registry.names.push_back(name);
+            registry.types.push_back(ObjectConverter::Type::None);
+            registry.typeConflicts.push_back(false);
+            registry.ids[name] = index;
+            return index;
+        }
+
+        PropertyNameRegistry& getPropertyNameRegistry()
+        {
+            static PropertyNameRegistry registry;
+            return registry;
+        }
+
+        TGUI_NODISCARD std::size_t getHashTableSlot(std::uint32_t index, std::size_t tableSize)
+        {
+            // Fibonacci hashing spreads the consecutive indices over the table
+            return (index * std::size_t(2654435769u)) & (tableSize - 1);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyId::RendererPropertyId(const String& name)
+    {
+        auto& registry = getPropertyNameRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        m_index = internPropertyName(registry, name);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyId::RendererPropertyId(const String& name, ObjectConverter::Type type)
+    {
+        auto& registry = getPropertyNameRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        m_index = internPropertyName(registry, name);
+
+        if (registry.typeConflicts[m_index])
+            return;
+
+        if (registry.types[m_index] == ObjectConverter::Type::None)
+            registry.types[m_index] = type;
+        else if (registry.types[m_index] != type)
+        {
+            registry.types[m_index] = ObjectConverter::Type::None;
+            registry.typeConflicts[m_index] = true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyId RendererPropertyId::find(const String& name)
+    {
+        auto& registry = getPropertyNameRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        RendererPropertyId id;
+        const auto it = registry.ids.find(name);
+        if (it != registry.ids.end())
+            id.m_index = it->second;
+
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const String& RendererPropertyId::getName() const
+    {
+        static const String emptyName;
+        if (!isValid())
+            return emptyName;
+
+        auto& registry = getPropertyNameRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        return registry.names[m_index];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter::Type RendererPropertyId::getType() const
+    {
+        if (!isValid())
+            return ObjectConverter::Type::None;
+
+        auto& registry = getPropertyNameRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        return registry.types[m_index];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool RendererPropertyId::deserializeValue(ObjectConverter& value) const
+    {
+        if (value.getType() != ObjectConverter::Type::String)
+            return false;
+
+        try
+        {
+            switch (getType())
+            {
+            case ObjectConverter::Type::Color:
+                (void)value.getColor();
+                return true;
+            case ObjectConverter::Type::Outline:
+                (void)value.getOutline();
+                return true;
+            case ObjectConverter::Type::Bool:
+                (void)value.getBool();
+                return true;
+            case ObjectConverter::Type::Number:
+                (void)value.getNumber();
+                return true;
+            case ObjectConverter::Type::TextStyle:
+                (void)value.getTextStyle();
+                return true;
+            case ObjectConverter::Type::Texture:
+                if (!isBackendSet())
+                    return false;
+
+                (void)value.getTexture();
+                return true;
+            case ObjectConverter::Type::RendererData:
+                (void)value.getRenderer();
+                return true;
+            case ObjectConverter::Type::None:
+            case ObjectConverter::Type::String:
+            case ObjectConverter::Type::Font:
+                break;
+            }
+        }
+        catch (const Exception&)
+        {
+            // Keep the serialized value, using the property will throw the exception again
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::RendererPropertyMap(const Map& map)
+    {
+        *this = map;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::RendererPropertyMap(const RendererPropertyMap& other) :
+        m_storage{other.m_storage}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::RendererPropertyMap(RendererPropertyMap&& other) noexcept :
+        m_storage{std::move(other.m_storage)}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap& RendererPropertyMap::operator=(const RendererPropertyMap& other)
+    {
+        m_storage = other.m_storage;
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap& RendererPropertyMap::operator=(RendererPropertyMap&& other) noexcept
+    {
+        if (this != &other)
+            m_storage = std::move(other.m_storage);
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap& RendererPropertyMap::operator=(const Map& map)
+    {
+        m_storage = std::make_shared<Storage>();
+        m_storage->map = map;
+        rebuildIndex();
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const RendererPropertyMap::Map& RendererPropertyMap::getMap() const
+    {
+        static const Map emptyMap;
+        return m_storage ? m_storage->map : emptyMap;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter* RendererPropertyMap::lookup(RendererPropertyId id) const
+    {
+        if (!m_storage || m_storage->index.empty() || !id.isValid())
+            return nullptr;
+
+        const auto& index = m_storage->index;
+        std::size_t slot = getHashTableSlot(id.getIndex(), index.size());
+        while (index[slot].second)
+        {
+            if (index[slot].first == id.getIndex())
+                return index[slot].second;
+
+            slot = (slot + 1) & (index.size() - 1);
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& RendererPropertyMap::operator[](RendererPropertyId id)
+    {
+        detach();
+
+        ObjectConverter* value = lookup(id);
+        if (value)
+            return *value;
+
+        value = &m_storage->map[id.getName()];
+        addToIndex(id, value);
+        return *value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& RendererPropertyMap::operator[](const String& property)
+    {
+        detach();
+
+        const auto it = m_storage->map.find(property);
+        if (it != m_storage->map.end())
+            return it->second;
+
+        ObjectConverter* value = &m_storage->map[property];
+        addToIndex(RendererPropertyId{property}, value);
+        return *value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::find(const String& property)
+    {
+        detach();
+        return m_storage->map.find(property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::erase(const_iterator it)
+    {
+        // The iterator has to belong to storage that isn't shared, as it was obtained from a non-const function
+        TGUI_ASSERT(m_storage && !isStorageShared(), "RendererPropertyMap::erase called with iterator into shared storage");
+
+        auto nextIt = m_storage->map.erase(it);
+        rebuildIndex();
+        return nextIt;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t RendererPropertyMap::erase(const String& property)
+    {
+        if (getMap().find(property) == getMap().end())
+            return 0;
+
+        detach();
+        m_storage->map.erase(property);
+        rebuildIndex();
+        return 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererPropertyMap::clear()
+    {
+        m_storage = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::begin()
+    {
+        detach();
+        return m_storage->map.begin();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::end()
+    {
+        detach();
+        return m_storage->map.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererPropertyMap::deserializeValues()
+    {
+        if (!m_storage)
+            return;
+
+        for (const auto& slot : m_storage->index)
+        {
+            if (!slot.second)
+                continue;
+
+            RendererPropertyId id;
+            id.m_index = slot.first;
+            id.deserializeValue(*slot.second);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererPropertyMap::addToIndex(RendererPropertyId id, ObjectConverter* value)
+    {
+        // Keep the load factor below 50%. The value was already added to the map, so rebuilding also adds it to the index.
+        auto& index = m_storage->index;
+        if (2 * (m_storage->indexCount + 1) > index.size())
+        {
+            rebuildIndex();
+            return;
+        }
+
+        std::size_t slot = getHashTableSlot(id.getIndex(), index.size());
+        while (index[slot].second)
+            slot = (slot + 1) & (index.size() - 1);
+
+        index[slot] = {id.getIndex(), value};
+        ++m_storage->indexCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererPropertyMap::rebuildIndex()
+    {
+        m_storage->indexCount = 0;
+        if (m_storage->map.empty())
+        {
+            m_storage->index.clear();
+            return;
+        }
+
+        std::size_t tableSize = 16;
+        while (tableSize < 2 * (m_storage->map.size() + 1))
+            tableSize *= 2;
+
+        m_storage->index.assign(tableSize, {0, nullptr});
+        for (auto& pair : m_storage->map)
+            addToIndex(RendererPropertyId{pair.first}, &pair.second);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererPropertyMap::detach()
+    {
+        if (!m_storage)
+        {
+            m_storage = std::make_shared<Storage>();
+            return;
+        }
+
+        if (m_storage.use_count() == 1)
+            return;
+
+        auto storage = std::make_shared<Storage>();
+        storage->map = m_storage->map;
+        m_storage = std::move(storage);
+        rebuildIndex();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     RendererData::RendererData(const RendererData& other) :
@@ -86,6 +499,9 @@ namespace tgui
             rendererData->propertyValuePairs[nestedProperty->name] = {String("{\n" + ss.str() + "}")};
         }
 
+        // Deserialize the values in the same way as when loading a theme, so that nested renderers are saved again as sections
+        rendererData->propertyValuePairs.deserializeValues();
+
         return rendererData;
     }
 
@@ -152,15 +568,18 @@ namespace tgui
 
     Font WidgetRenderer::getFont() const
     {
-        auto it = m_data->propertyValuePairs.find("Font");
-        if (it != m_data->propertyValuePairs.end())
-            return it->second.getFont();
+        static const RendererPropertyId propertyId{U"Font"};
+        ObjectConverter* value = m_data->propertyValuePairs.lookup(propertyId);
+        if (value)
+            return value->getFont();
         else
             return {};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TGUI_RENDERER_PROPERTY_REGISTER_TYPE(WidgetRenderer, TextSize, Number)
+
     void WidgetRenderer::setTextSize(unsigned int size)
     {
         setProperty("TextSize", static_cast<float>(size));
@@ -170,9 +589,10 @@ namespace tgui
 
     unsigned int WidgetRenderer::getTextSize() const
     {
-        auto it = m_data->propertyValuePairs.find("TextSize");
-        if (it != m_data->propertyValuePairs.end())
-            return static_cast<unsigned int>(it->second.getNumber());
+        static const RendererPropertyId propertyId{U"TextSize"};
+        ObjectConverter* value = m_data->propertyValuePairs.lookup(propertyId);
+        if (value)
+            return static_cast<unsigned int>(value->getNumber());
         else
             return 0;
     }
@@ -203,8 +623,9 @@ namespace tgui
 
     ObjectConverter WidgetRenderer::getProperty(const String& property) const
     {
-        auto it = m_data->propertyValuePairs.find(property);
-        if (it != m_data->propertyValuePairs.end())
+        const auto& properties = m_data->propertyValuePairs.getMap();
+        const auto it = properties.find(property);
+        if (it != properties.end())
             return it->second;
         else
             return {};
@@ -214,7 +635,7 @@ namespace tgui
 
     const std::map<String, ObjectConverter>& WidgetRenderer::getPropertyValuePairs() const
     {
-        return m_data->propertyValuePairs;
+        return m_data->propertyValuePairs.getMap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
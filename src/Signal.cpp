@@ -30,6 +30,7 @@
 
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <set>
 #endif
 
@@ -59,7 +60,7 @@ namespace tgui
         {
             m_enabled = other.m_enabled;
             m_name = other.m_name;
-            m_handlers.clear(); // signal handlers are not copied with the widget
+            m_handlers = nullptr; // signal handlers are not copied with the widget
         }
 
         return *this;
@@ -69,28 +70,55 @@ namespace tgui
 
     bool Signal::disconnect(unsigned int id)
     {
-        return (m_handlers.erase(id) != 0);
+        if (!m_handlers)
+            return false;
+
+        const auto it = std::find_if(m_handlers->begin(), m_handlers->end(),
+            [id](const HandlerList::value_type& handler){ return handler.first == id; });
+        if (it == m_handlers->end())
+            return false;
+
+        if (m_handlers->size() == 1)
+            m_handlers = nullptr;
+        else if (m_handlers.use_count() > 1)
+        {
+            // The handlers are being emitted, so leave the list that is being iterated untouched
+            auto handlers = std::make_shared<HandlerList>();
+            handlers->reserve(m_handlers->size() - 1);
+            for (const auto& handler : *m_handlers)
+            {
+                if (handler.first != id)
+                    handlers->push_back(handler);
+            }
+
+            m_handlers = std::move(handlers);
+        }
+        else
+            m_handlers->erase(it);
+
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Signal::disconnectAll()
     {
-        m_handlers.clear();
+        m_handlers = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Signal::emit(const Widget* widget)
     {
-        if (m_handlers.empty() || !m_enabled)
+        if (!m_handlers || !m_enabled)
             return false;
 
         m_parameters[0] = static_cast<const void*>(&widget);
 
-        // Copy the handlers before calling them in case the widget (and this signal) gets destroyed during the handler
-        auto handlers = m_handlers;
-        for (const auto& handler : handlers)
+        // Keep the handlers alive in case the widget (and this signal) gets destroyed during the handler.
+        // Handlers that are connected or disconnected during the loop won't affect the list that we are iterating.
+        const auto handlers = m_handlers;
+        for (const auto& handler : *handlers)
             handler.second();
 
         return true;
@@ -98,6 +126,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Signal::addHandler(unsigned int id, std::function<void()> handler)
+    {
+        if (!m_handlers)
+            m_handlers = std::make_shared<HandlerList>();
+        else if (m_handlers.use_count() > 1)
+            m_handlers = std::make_shared<HandlerList>(*m_handlers);
+
+        m_handlers->emplace_back(id, std::move(handler));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr Signal::getWidget()
     {
         return dereferenceParam<Widget*>(0)->shared_from_this();
@@ -107,7 +147,7 @@ namespace tgui
 
     bool SignalChildWindow::emit(ChildWindow* childWindow)
     {
-        if (m_handlers.empty())
+        if (!m_handlers)
             return false;
 
         m_parameters[1] = static_cast<const void*>(&childWindow);
@@ -125,7 +165,7 @@ namespace tgui
 
     bool SignalItem::emit(const Widget* widget, int index, const String& item, const String& id)
     {
-        if (m_handlers.empty())
+        if (!m_handlers)
             return false;
 
         m_parameters[1] = static_cast<const void*>(&index);
@@ -138,7 +178,7 @@ namespace tgui
 
     bool SignalPanelListBoxItem::emit(const Widget* widget, int index, const std::shared_ptr<Panel>& panel, const String& id)
     {
-        if (m_handlers.empty())
+        if (!m_handlers)
             return false;
 
         m_parameters[1] = static_cast<const void*>(&index);
@@ -158,7 +198,7 @@ namespace tgui
 
     bool SignalFileDialogPaths::emit(const Widget* widget, const std::vector<Filesystem::Path>& paths)
     {
-        if (m_handlers.empty())
+        if (!m_handlers)
             return false;
 
         assert(!paths.empty());
@@ -173,7 +213,7 @@ namespace tgui
 
     bool SignalShowEffect::emit(const Widget* widget, ShowEffectType type, bool visible)
     {
-        if (m_handlers.empty())
+        if (!m_handlers)
             return false;
 
         m_parameters[1] = static_cast<const void*>(&type);
@@ -185,7 +225,7 @@ namespace tgui
 
     bool SignalAnimationType::emit(const Widget* widget, AnimationType type)
     {
-        if (m_handlers.empty())
+        if (!m_handlers)
             return false;
 
         m_parameters[1] = static_cast<const void*>(&type);
@@ -196,7 +236,7 @@ namespace tgui
 
     bool SignalItemHierarchy::emit(const Widget* widget, const String& item, const std::vector<String>& fullItem)
     {
-        if (m_handlers.empty())
+        if (!m_handlers)
             return false;
 
         m_parameters[1] = static_cast<const void*>(&item);
@@ -66,6 +66,7 @@ namespace tgui
         m_size       (std::move(other.m_size)),
         m_texture    (std::move(other.m_texture)),
         m_svgTexture (std::move(other.m_svgTexture)),
+        m_svgRasterizationPending(other.m_svgRasterizationPending),
         m_vertices   (std::move(other.m_vertices)),
         m_indices    (std::move(other.m_indices)),
         m_visibleRect(std::move(other.m_visibleRect)),
@@ -108,6 +109,7 @@ namespace tgui
             std::swap(m_size,        temp.m_size);
             std::swap(m_texture,     temp.m_texture);
             std::swap(m_svgTexture,  temp.m_svgTexture);
+            std::swap(m_svgRasterizationPending, temp.m_svgRasterizationPending);
             std::swap(m_vertices,    temp.m_vertices);
             std::swap(m_indices,     temp.m_indices);
             std::swap(m_visibleRect, temp.m_visibleRect);
@@ -133,6 +135,7 @@ namespace tgui
             m_size        = std::move(other.m_size);
             m_texture     = std::move(other.m_texture);
             m_svgTexture  = std::move(other.m_svgTexture);
+            m_svgRasterizationPending = other.m_svgRasterizationPending;
             m_vertices    = std::move(other.m_vertices);
             m_indices     = std::move(other.m_indices);
             m_visibleRect = std::move(other.m_visibleRect);
@@ -392,19 +395,18 @@ namespace tgui
         Vector2u texCoordOffset;
         if (m_texture.getData()->svgImage)
         {
-            if (!m_svgTexture)
-            {
-                m_svgTexture = getBackend()->createTexture();
-
-                TGUI_ASSERT(isBackendSet(), "Backend must still exist when SVG texture is loaded in Sprite");
-                getBackend()->registerSvgSprite(this);
-            }
+            TGUI_ASSERT(isBackendSet(), "Backend must still exist when SVG texture is loaded in Sprite");
+            const bool registered = (m_svgTexture != nullptr);
 
             const Vector2u svgTextureSize{
                 static_cast<unsigned int>(std::round(getSize().x)),
                 static_cast<unsigned int>(std::round(getSize().y))};
 
-            m_texture.getData()->svgImage->rasterize(*m_svgTexture, svgTextureSize);
+            // The texture is shared with all other sprites that show the same image at the same size
+            m_svgTexture = m_texture.getData()->svgImage->getRasterizedTexture(svgTextureSize, m_svgRasterizationPending);
+
+            if (!registered)
+                getBackend()->registerSvgSprite(this);
 
             m_scalingType = ScalingType::Normal;
             textureSize = getSize();
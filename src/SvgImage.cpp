@@ -28,6 +28,18 @@
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Backend/Renderer/BackendTexture.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <condition_variable>
+    #include <cstdint>
+    #include <deque>
+    #include <list>
+    #include <map>
+    #include <mutex>
+    #include <thread>
+    #include <vector>
+#endif
+
 #if defined(__GNUC__)
 #   pragma GCC diagnostic push
 #   pragma GCC diagnostic ignored "-Wsign-conversion"
@@ -87,6 +99,8 @@
     // We place the functions in a namespace to prevent potential issues if the TGUI user also uses nanosvg in their own project.
     // We don't use an anonymous namespace as it leads to a warning from some compilers because SvgImageData (which has to be
     // forward declared in the header file and can't be anonymous) would have public members that have static linkage.
+    using tgui::priv::NSVGimage;
+    using tgui::priv::NSVGrasterizer;
     using tgui::priv::nsvgParseFromFile;
     using tgui::priv::nsvgDelete;
     using tgui::priv::nsvgCreateRasterizer;
@@ -112,11 +126,218 @@ namespace tgui
     {
         struct SvgImageData
         {
+            SvgImageData() = default;
+            SvgImageData(const SvgImageData&) = delete;
+            SvgImageData& operator=(const SvgImageData&) = delete;
+
+            // The data is freed by whoever releases it last, which can be a thread that was rasterizing it in the background
+            ~SvgImageData()
+            {
+                if (rasterizer)
+                    nsvgDeleteRasterizer(rasterizer);
+                if (svg)
+                    nsvgDelete(svg);
+            }
+
             NSVGimage* svg = nullptr;
-            NSVGrasterizer* rasterizer = nullptr;
+            NSVGrasterizer* rasterizer = nullptr; // Only used on the main thread, background threads have their own rasterizer
         };
     }
 
+    namespace
+    {
+        using RasterCacheKey = std::pair<const priv::SvgImageData*, std::pair<unsigned int, unsigned int>>;
+
+        struct RasterizedSvg
+        {
+            RasterCacheKey key;
+            std::weak_ptr<priv::SvgImageData> data;
+            Vector2u size;
+            std::shared_ptr<BackendTexture> texture; // Null while the image is still being rasterized in the background
+            std::size_t memoryUsage = 0;
+            std::uint64_t jobId = 0;
+        };
+
+        struct RasterizationJob
+        {
+            RasterCacheKey key;
+            std::uint64_t jobId = 0;
+            std::shared_ptr<priv::SvgImageData> data;
+            Vector2u size;
+            std::unique_ptr<std::uint8_t[]> pixels;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TGUI_NODISCARD std::unique_ptr<std::uint8_t[]> rasterizeSvg(NSVGrasterizer* rasterizer, NSVGimage* svg, Vector2u size)
+        {
+            const float scaleX = size.x / static_cast<float>(svg->width);
+            const float scaleY = size.y / static_cast<float>(svg->height);
+
+            auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(static_cast<std::size_t>(size.x) * size.y * 4);
+            nsvgRasterizeXY(rasterizer, svg, 0, 0, scaleX, scaleY,
+                            pixels.get(), static_cast<int>(size.x), static_cast<int>(size.y), static_cast<int>(size.x * 4));
+            return pixels;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Threads that rasterize images in the background. Only the pixels are produced by these threads,
+        // the textures are created on the main thread when the results are collected.
+        class RasterizationThreadPool
+        {
+        public:
+
+            RasterizationThreadPool()
+            {
+                const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+                const unsigned int threadCount = (hardwareThreads > 2) ? std::min(hardwareThreads - 1, 4u) : 1u;
+                for (unsigned int i = 0; i < threadCount; ++i)
+                    m_threads.emplace_back([this]{ rasterizeJobs(); });
+            }
+
+            ~RasterizationThreadPool()
+            {
+                {
+                    const std::lock_guard<std::mutex> lock(m_mutex);
+                    m_stopping = true;
+                }
+                m_condition.notify_all();
+
+                // Jobs that haven't been started yet are simply dropped
+                for (auto& thread : m_threads)
+                    thread.join();
+            }
+
+            RasterizationThreadPool(const RasterizationThreadPool&) = delete;
+            RasterizationThreadPool& operator=(const RasterizationThreadPool&) = delete;
+
+            void addJob(RasterizationJob job)
+            {
+                {
+                    const std::lock_guard<std::mutex> lock(m_mutex);
+                    m_pendingJobs.push_back(std::move(job));
+                }
+                m_condition.notify_one();
+            }
+
+            TGUI_NODISCARD std::vector<RasterizationJob> takeFinishedJobs()
+            {
+                std::vector<RasterizationJob> finishedJobs;
+                const std::lock_guard<std::mutex> lock(m_mutex);
+                finishedJobs.swap(m_finishedJobs);
+                return finishedJobs;
+            }
+
+        private:
+
+            void rasterizeJobs()
+            {
+                NSVGrasterizer* rasterizer = nsvgCreateRasterizer();
+                while (true)
+                {
+                    RasterizationJob job;
+                    {
+                        std::unique_lock<std::mutex> lock(m_mutex);
+                        m_condition.wait(lock, [this]{ return m_stopping || !m_pendingJobs.empty(); });
+                        if (m_stopping)
+                            break;
+
+                        job = std::move(m_pendingJobs.front());
+                        m_pendingJobs.pop_front();
+                    }
+
+                    job.pixels = rasterizeSvg(rasterizer, job.data->svg, job.size);
+                    job.data = nullptr;
+
+                    const std::lock_guard<std::mutex> lock(m_mutex);
+                    m_finishedJobs.push_back(std::move(job));
+                }
+
+                nsvgDeleteRasterizer(rasterizer);
+            }
+
+        private:
+
+            std::vector<std::thread> m_threads;
+            std::mutex m_mutex;
+            std::condition_variable m_condition;
+            std::deque<RasterizationJob> m_pendingJobs;
+            std::vector<RasterizationJob> m_finishedJobs;
+            bool m_stopping = false;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Images rasterized at a specific size, shared by all sprites. Only accessed from the main thread.
+        struct RasterCache
+        {
+            std::list<RasterizedSvg> entries; // Most recently used images are at the front
+            std::map<RasterCacheKey, std::list<RasterizedSvg>::iterator> lookup;
+            std::size_t memoryUsage = 0;
+            std::size_t memoryBudget = 64 * 1024 * 1024;
+            std::uint64_t nextJobId = 1;
+            bool asyncRasterizationEnabled = false;
+            bool jobsCancelled = false;
+            std::unique_ptr<RasterizationThreadPool> threadPool;
+        };
+
+        TGUI_NODISCARD RasterCache& getRasterCache()
+        {
+            static RasterCache cache;
+            return cache;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::list<RasterizedSvg>::iterator removeRasterizedSvg(RasterCache& cache, std::list<RasterizedSvg>::iterator it)
+        {
+            cache.memoryUsage -= it->memoryUsage;
+            cache.lookup.erase(it->key);
+            return cache.entries.erase(it);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Removes the least recently used images until the memory budget is no longer exceeded. The most recently used image
+        // is always kept. Sprites that are still showing a removed image keep its texture alive, it just won't be shared anymore.
+        void evictRasterizedSvgs(RasterCache& cache)
+        {
+            auto it = cache.entries.end();
+            while ((cache.memoryUsage > cache.memoryBudget) && (it != cache.entries.begin()))
+            {
+                --it;
+                if (it->texture && (it != cache.entries.begin()))
+                    it = removeRasterizedSvg(cache, it);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Finds the rasterized image of the svg that has a size closest to the requested size
+        TGUI_NODISCARD std::shared_ptr<BackendTexture> findNearestRasterizedSvg(const RasterCache& cache, const priv::SvgImageData* data, Vector2u size)
+        {
+            std::shared_ptr<BackendTexture> nearestTexture;
+            unsigned int smallestDistance = 0;
+            for (auto it = cache.lookup.lower_bound({data, {0, 0}}); (it != cache.lookup.end()) && (it->first.first == data); ++it)
+            {
+                const RasterizedSvg& entry = *it->second;
+                if (!entry.texture || entry.data.expired())
+                    continue;
+
+                const unsigned int distance = ((entry.size.x > size.x) ? (entry.size.x - size.x) : (size.x - entry.size.x))
+                                            + ((entry.size.y > size.y) ? (entry.size.y - size.y) : (size.y - entry.size.y));
+                if (!nearestTexture || (distance < smallestDistance))
+                {
+                    nearestTexture = entry.texture;
+                    smallestDistance = distance;
+                }
+            }
+
+            return nearestTexture;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     SvgImage::SvgImage() :
@@ -138,13 +359,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    SvgImage::~SvgImage()
-    {
-        if (m_data->rasterizer)
-            nsvgDeleteRasterizer(m_data->rasterizer);
-        if (m_data->svg)
-            nsvgDelete(m_data->svg);
-    }
+    SvgImage::~SvgImage() = default;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -177,14 +392,194 @@ namespace tgui
         size.x = static_cast<unsigned int>(size.x * fontScale);
         size.y = static_cast<unsigned int>(size.y * fontScale);
 
-        const float scaleX = size.x / static_cast<float>(m_data->svg->width);
-        const float scaleY = size.y / static_cast<float>(m_data->svg->height);
+        texture.load(size, rasterizeSvg(m_data->rasterizer, m_data->svg, size), true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> SvgImage::getRasterizedTexture(Vector2u size, bool& rasterizationPending)
+    {
+        rasterizationPending = false;
+
+        const float fontScale = getBackend()->getFontScale();
+        size.x = static_cast<unsigned int>(size.x * fontScale);
+        size.y = static_cast<unsigned int>(size.y * fontScale);
+
+        // There is nothing to rasterize or share when the svg wasn't loaded or when the image has no size
+        if (!m_data->svg || (size.x == 0) || (size.y == 0))
+            return getBackend()->createTexture();
+
+        RasterCache& cache = getRasterCache();
+        const RasterCacheKey key{m_data.get(), {size.x, size.y}};
+        auto lookupIt = cache.lookup.find(key);
+
+        // An entry of an image that no longer exists could have the same address as our image
+        if ((lookupIt != cache.lookup.end()) && lookupIt->second->data.expired())
+        {
+            removeRasterizedSvg(cache, lookupIt->second);
+            lookupIt = cache.lookup.end();
+        }
+
+        if (lookupIt != cache.lookup.end())
+        {
+            cache.entries.splice(cache.entries.begin(), cache.entries, lookupIt->second);
+            if (lookupIt->second->texture)
+                return lookupIt->second->texture;
+        }
+
+        // When the image was already rasterized at a different size then we show that one until the background thread finishes
+        if (cache.asyncRasterizationEnabled)
+        {
+            std::shared_ptr<BackendTexture> nearestTexture = findNearestRasterizedSvg(cache, m_data.get(), size);
+            if (nearestTexture)
+            {
+                if (lookupIt == cache.lookup.end())
+                {
+                    RasterizedSvg entry;
+                    entry.key = key;
+                    entry.data = m_data;
+                    entry.size = size;
+                    entry.jobId = cache.nextJobId++;
+                    cache.entries.push_front(std::move(entry));
+                    cache.lookup[key] = cache.entries.begin();
+
+                    if (!cache.threadPool)
+                        cache.threadPool = std::make_unique<RasterizationThreadPool>();
+
+                    RasterizationJob job;
+                    job.key = key;
+                    job.jobId = cache.entries.front().jobId;
+                    job.data = m_data;
+                    job.size = size;
+                    cache.threadPool->addJob(std::move(job));
+                }
+
+                rasterizationPending = true;
+                return nearestTexture;
+            }
+        }
+
+        if (!m_data->rasterizer)
+            m_data->rasterizer = nsvgCreateRasterizer();
+
+        auto texture = getBackend()->createTexture();
+        texture->load(size, rasterizeSvg(m_data->rasterizer, m_data->svg, size), true);
+
+        if (lookupIt == cache.lookup.end())
+        {
+            RasterizedSvg entry;
+            entry.key = key;
+            entry.data = m_data;
+            entry.size = size;
+            cache.entries.push_front(std::move(entry));
+            cache.lookup[key] = cache.entries.begin();
+        }
+
+        // If the image was also being rasterized in the background then that result will be ignored
+        RasterizedSvg& entry = cache.entries.front();
+        entry.texture = texture;
+        entry.memoryUsage = static_cast<std::size_t>(size.x) * size.y * 4;
+        entry.jobId = 0;
+        cache.memoryUsage += entry.memoryUsage;
+
+        evictRasterizedSvgs(cache);
+        return texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SvgImage::setAsyncRasterizationEnabled(bool enabled)
+    {
+        getRasterCache().asyncRasterizationEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool SvgImage::isAsyncRasterizationEnabled()
+    {
+        return getRasterCache().asyncRasterizationEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SvgImage::setRasterCacheMemoryBudget(std::size_t bytes)
+    {
+        RasterCache& cache = getRasterCache();
+        cache.memoryBudget = bytes;
+        evictRasterizedSvgs(cache);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t SvgImage::getRasterCacheMemoryBudget()
+    {
+        return getRasterCache().memoryBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t SvgImage::getRasterCacheMemoryUsage()
+    {
+        return getRasterCache().memoryUsage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SvgImage::clearRasterCache()
+    {
+        RasterCache& cache = getRasterCache();
+
+        // Sprites that were waiting for a background job will have to request their texture again
+        if (cache.threadPool)
+        {
+            cache.threadPool = nullptr;
+            cache.jobsCancelled = true;
+        }
+
+        cache.lookup.clear();
+        cache.entries.clear();
+        cache.memoryUsage = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool SvgImage::finishBackgroundRasterizations()
+    {
+        RasterCache& cache = getRasterCache();
+        bool texturesChanged = cache.jobsCancelled;
+        cache.jobsCancelled = false;
+
+        if (!cache.threadPool)
+            return texturesChanged;
+
+        for (auto& job : cache.threadPool->takeFinishedJobs())
+        {
+            const auto lookupIt = cache.lookup.find(job.key);
+            if ((lookupIt == cache.lookup.end()) || (lookupIt->second->jobId != job.jobId))
+                continue;
+
+            const auto entryIt = lookupIt->second;
+            if (entryIt->data.expired())
+            {
+                removeRasterizedSvg(cache, entryIt);
+                continue;
+            }
+
+            entryIt->texture = getBackend()->createTexture();
+            entryIt->texture->load(entryIt->size, std::move(job.pixels), true);
+            entryIt->memoryUsage = static_cast<std::size_t>(entryIt->size.x) * entryIt->size.y * 4;
+            entryIt->jobId = 0;
+            cache.memoryUsage += entryIt->memoryUsage;
+
+            // The sprites that requested the image will use it next, so it shouldn't be the first one to be evicted
+            cache.entries.splice(cache.entries.begin(), cache.entries, entryIt);
+            texturesChanged = true;
+        }
 
-        auto pixels = MakeUniqueForOverwrite<unsigned char[]>(size.x * size.y * 4);
-        nsvgRasterizeXY(m_data->rasterizer, m_data->svg, 0, 0, scaleX, scaleY,
-                        pixels.get(), static_cast<int>(size.x), static_cast<int>(size.y), static_cast<int>(size.x * 4));
+        if (texturesChanged)
+            evictRasterizedSvgs(cache);
 
-        texture.load(size, std::move(pixels), true);
+        return texturesChanged;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
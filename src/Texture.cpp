@@ -49,8 +49,9 @@ namespace tgui
 {
     bool Texture::m_defaultSmooth = true;
 
-    Texture::TextureLoaderFunc Texture::m_textureLoader = &TextureManager::getTexture;
-    Texture::BackendTextureLoaderFunc Texture::m_backendTextureLoader = [](BackendTexture& backendTexture, const String& filename, bool smooth)
+    namespace
+    {
+        bool loadBackendTextureFromFile(BackendTexture& backendTexture, const String& filename, bool smooth)
         {
             Vector2u imageSize;
             auto pixelPtr = ImageLoader::loadFromFile(filename, imageSize);
@@ -58,7 +59,23 @@ namespace tgui
                 return false;
 
             return backendTexture.load(imageSize, std::move(pixelPtr), smooth);
-        };
+        }
+
+        TGUI_NODISCARD String getFilenameFromId(const String& id)
+        {
+#ifdef TGUI_SYSTEM_WINDOWS
+            if ((id[0] != '/') && (id[0] != '\\') && ((id.length() <= 1) || (id[1] != ':')))
+#else
+            if (id[0] != '/')
+#endif
+                return (getResourcePath() / id).asString();
+            else
+                return id;
+        }
+    }
+
+    Texture::TextureLoaderFunc Texture::m_textureLoader = &TextureManager::getTexture;
+    Texture::BackendTextureLoaderFunc Texture::m_backendTextureLoader = &loadBackendTextureFromFile;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -185,23 +202,10 @@ namespace tgui
 
         m_data = nullptr;
 
-        std::shared_ptr<TextureData> data;
-#ifdef TGUI_SYSTEM_WINDOWS
-        if ((id[0] != '/') && (id[0] != '\\') && ((id.length() <= 1) || (id[1] != ':')))
-#else
-        if (id[0] != '/')
-#endif
-        {
-            data = m_textureLoader(*this, (getResourcePath() / id).asString(), smooth);
-            if (!data)
-                throw Exception{U"Failed to load '" + (getResourcePath() / id).asString() + U"'"};
-        }
-        else
-        {
-            data = m_textureLoader(*this, id, smooth);
-            if (!data)
-                throw Exception{U"Failed to load '" + id + U"'"};
-        }
+        const String filename = getFilenameFromId(id);
+        const std::shared_ptr<TextureData> data = m_textureLoader(*this, filename, smooth);
+        if (!data)
+            throw Exception{U"Failed to load '" + filename + U"'"};
 
         TGUI_ASSERT(data->svgImage || data->backendTexture, "TextureLoaderFunc returned non-nullptr but didn't initialized backendTexture or svgImage");
 
@@ -210,6 +214,44 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Texture::loadAsync(const String& id, std::function<void(const Texture&)> func, const UIntRect& partRect, const UIntRect& middleRect, bool smooth)
+    {
+        const auto loadTexture = [id,partRect,middleRect,smooth]{
+            Texture texture;
+            try
+            {
+                texture.load(id, partRect, middleRect, smooth);
+            }
+            catch (const Exception&)
+            {
+                texture = Texture{};
+            }
+            return texture;
+        };
+
+        if (id.empty())
+        {
+            func(Texture{});
+            return;
+        }
+
+        // Only images that would be decoded by ImageLoader can be loaded in the background
+        const String filename = getFilenameFromId(id);
+        const bool isSvg = ((filename.length() > 4) && (viewEqualIgnoreCase(StringView(filename.c_str() + (filename.length() - 4), 4), U".svg")));
+        const auto* textureLoader = m_textureLoader.target<std::shared_ptr<TextureData>(*)(Texture&, const String&, bool)>();
+        const auto* backendTextureLoader = m_backendTextureLoader.target<bool(*)(BackendTexture&, const String&, bool)>();
+        if (isSvg || !textureLoader || (*textureLoader != &TextureManager::getTexture)
+         || !backendTextureLoader || (*backendTextureLoader != &loadBackendTextureFromFile))
+        {
+            func(loadTexture());
+            return;
+        }
+
+        TextureManager::loadTextureAsync(filename, smooth, [loadTexture,func=std::move(func)]{ func(loadTexture()); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #if TGUI_HAS_RENDERER_BACKEND_SFML_GRAPHICS
     void Texture::load(const sf::Texture& texture, const UIntRect& partRect, const UIntRect& middleRect)
     {
@@ -27,12 +27,34 @@
 #include <TGUI/Texture.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Exception.hpp>
+#include <TGUI/Loading/ImageLoader.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <cstring> // memcpy
+#endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    std::map<String, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    std::unordered_map<String, std::list<TextureDataHolder>, TextureManager::FilenameHasher> TextureManager::m_imageMap;
+    TextureManager::ImageLocationMap TextureManager::m_imageLocations;
+    std::list<const TextureData*> TextureManager::m_releasedImages;
+    std::size_t TextureManager::m_memoryBudget = 0;
+    TextureManager::Statistics TextureManager::m_statistics;
+    std::unordered_map<String, std::vector<TextureManager::AsyncLoadRequest>, TextureManager::FilenameHasher> TextureManager::m_asyncLoads;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::FilenameHasher::operator()(const String& filename) const
+    {
+#if TGUI_COMPILED_WITH_CPP_VER >= 17
+        return std::hash<std::u32string_view>{}(StringView(filename));
+#else
+        return std::hash<std::u32string>{}(filename.toUtf32());
+#endif
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -54,8 +76,18 @@ namespace tgui
                 // We can reuse everything only if the image is loaded with the same settings
                 if (dataHolder.smooth == smooth)
                 {
+                    // An image that was released is no longer a candidate for removal
+                    if (dataHolder.users == 0)
+                    {
+                        const ImageLocation& location = m_imageLocations[dataHolder.data.get()];
+                        m_releasedImages.erase(location.releasedPosition);
+                        m_statistics.releasedMemoryUsage -= dataHolder.gpuMemoryUsage + dataHolder.cpuMemoryUsage;
+                        --m_statistics.releasedImages;
+                    }
+
                     // The exact same texture is now used at multiple places
                     ++dataHolder.users;
+                    ++m_statistics.hits;
                     return dataHolder.data;
                 }
             }
@@ -66,6 +98,8 @@ namespace tgui
             imageIt = it.first;
         }
 
+        ++m_statistics.misses;
+
         // Add new data to the list
         TGUI_EMPLACE_BACK(dataHolder, imageIt->second)
         dataHolder.filename = filename;
@@ -74,18 +108,23 @@ namespace tgui
         dataHolder.data = std::make_shared<TextureData>();
 
         // Load the image
-        auto data = imageIt->second.back().data;
+        auto data = dataHolder.data;
+        bool loaded = false;
         if (isSvg)
         {
             data->svgImage.emplace(filename);
-            if (data->svgImage->isSet())
-                return data;
+            loaded = data->svgImage->isSet();
         }
         else // Not an svg
         {
             data->backendTexture = getBackend()->createTexture();
-            if (texture.getBackendTextureLoader()(*data->backendTexture, filename, smooth))
-                return data;
+            loaded = texture.getBackendTextureLoader()(*data->backendTexture, filename, smooth);
+        }
+
+        if (loaded)
+        {
+            addLoadedImage(imageIt->second);
+            return data;
         }
 
         // The image could not be loaded
@@ -101,50 +140,176 @@ namespace tgui
 
     void TextureManager::copyTexture(const std::shared_ptr<TextureData>& textureDataToCopy)
     {
-        // Loop all our textures to check if we already have this one
-        for (auto& dataHolder : m_imageMap)
+        const auto locationIt = m_imageLocations.find(textureDataToCopy.get());
+        if (locationIt == m_imageLocations.end())
+            throw Exception{U"Trying to copy texture data that was not loaded by the TextureManager."};
+
+        TextureDataHolder& dataHolder = *locationIt->second.holder;
+        if (dataHolder.users == 0)
+        {
+            m_releasedImages.erase(locationIt->second.releasedPosition);
+            m_statistics.releasedMemoryUsage -= dataHolder.gpuMemoryUsage + dataHolder.cpuMemoryUsage;
+            --m_statistics.releasedImages;
+        }
+
+        // The texture is now used at multiple places
+        ++dataHolder.users;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeTexture(const std::shared_ptr<TextureData>& textureDataToRemove)
+    {
+        const auto locationIt = m_imageLocations.find(textureDataToRemove.get());
+        if ((locationIt == m_imageLocations.end()) || (locationIt->second.holder->users == 0))
+            throw Exception{U"Trying to remove a texture that was not loaded by the TextureManager."};
+
+        // If this was the only place where the texture is used then release it
+        if (--(locationIt->second.holder->users) == 0)
+            releaseImage(textureDataToRemove.get());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::loadTextureAsync(const String& filename, bool smooth, std::function<void()> func)
+    {
+        const auto imageIt = m_imageMap.find(filename);
+        if (imageIt != m_imageMap.end())
         {
-            for (auto& data : dataHolder.second)
+            for (const auto& dataHolder : imageIt->second)
             {
-                // Check if the pointer points to our texture
-                if (data.data == textureDataToCopy)
+                if (dataHolder.smooth == smooth)
                 {
-                    // The texture is now used at multiple places
-                    ++data.users;
+                    func();
                     return;
                 }
             }
         }
 
-        throw Exception{U"Trying to copy texture data that was not loaded by the TextureManager."};
+        // Only the first request for a file starts decoding it
+        auto& requests = m_asyncLoads[filename];
+        if (requests.empty())
+            ImageLoader::decodeFileAsync(filename);
+
+        requests.push_back({smooth, std::move(func)});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextureManager::removeTexture(const std::shared_ptr<TextureData>& textureDataToRemove)
+    bool TextureManager::finishAsyncLoads()
     {
-        // Loop all our textures to check which one it is
-        for (auto imageIt = m_imageMap.begin(); imageIt != m_imageMap.end(); ++imageIt)
+        if (m_asyncLoads.empty())
+            return false;
+
+        bool funcsCalled = false;
+        for (auto& decodedFile : ImageLoader::takeDecodedFiles())
         {
-            for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
+            const auto loadsIt = m_asyncLoads.find(decodedFile.filename);
+            if (loadsIt == m_asyncLoads.end())
+                continue;
+
+            const std::vector<AsyncLoadRequest> requests = std::move(loadsIt->second);
+            m_asyncLoads.erase(loadsIt);
+
+            // The images are kept alive until all functions were called, even if the first function would discard its texture
+            std::vector<std::shared_ptr<TextureData>> loadedImages;
+            if (decodedFile.pixels)
             {
-                // Check if the pointer points to our texture
-                if (dataIt->data == textureDataToRemove)
+                const bool smoothRequested = std::any_of(requests.begin(), requests.end(), [](const AsyncLoadRequest& request){ return request.smooth; });
+                const bool nonSmoothRequested = std::any_of(requests.begin(), requests.end(), [](const AsyncLoadRequest& request){ return !request.smooth; });
+                if (smoothRequested && nonSmoothRequested)
                 {
-                    // If this was the only place where the texture is used then delete it
-                    if (--(dataIt->users) == 0)
-                    {
-                        imageIt->second.erase(dataIt);
-                        if (imageIt->second.empty())
-                            m_imageMap.erase(imageIt);
-                    }
+                    const std::size_t pixelDataSize = static_cast<std::size_t>(decodedFile.size.x) * decodedFile.size.y * 4;
+                    auto pixelsCopy = MakeUniqueForOverwrite<std::uint8_t[]>(pixelDataSize);
+                    std::memcpy(pixelsCopy.get(), decodedFile.pixels.get(), pixelDataSize);
+                    loadedImages.push_back(addDecodedImage(decodedFile.filename, false, decodedFile.size, std::move(pixelsCopy)));
+                    loadedImages.push_back(addDecodedImage(decodedFile.filename, true, decodedFile.size, std::move(decodedFile.pixels)));
+                }
+                else
+                    loadedImages.push_back(addDecodedImage(decodedFile.filename, smoothRequested, decodedFile.size, std::move(decodedFile.pixels)));
+            }
 
-                    return;
+            try
+            {
+                for (const auto& request : requests)
+                    request.func();
+            }
+            catch (...)
+            {
+                for (const auto& data : loadedImages)
+                {
+                    if (data)
+                        removeTexture(data);
                 }
+                throw;
+            }
+
+            for (const auto& data : loadedImages)
+            {
+                if (data)
+                    removeTexture(data);
             }
+
+            funcsCalled = true;
         }
 
-        throw Exception{U"Trying to remove a texture that was not loaded by the TextureManager."};
+        return funcsCalled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::cancelAsyncLoads()
+    {
+        m_asyncLoads.clear();
+        ImageLoader::cancelAsyncDecoding();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getAsyncLoadsCount()
+    {
+        return m_asyncLoads.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setMemoryBudget(std::size_t bytes)
+    {
+        m_memoryBudget = bytes;
+        evictReleasedImages(m_memoryBudget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getMemoryBudget()
+    {
+        return m_memoryBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeReleasedImages()
+    {
+        evictReleasedImages(0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextureManager::Statistics TextureManager::getStatistics()
+    {
+        for (const auto& pair : m_imageLocations)
+            updatePixelMemoryUsage(*pair.second.holder);
+
+        return m_statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::resetStatistics()
+    {
+        m_statistics.hits = 0;
+        m_statistics.misses = 0;
+        m_statistics.evictions = 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -155,6 +320,143 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::addLoadedImage(std::list<TextureDataHolder>& images)
+    {
+        TextureDataHolder& dataHolder = images.back();
+        if (dataHolder.data->backendTexture)
+        {
+            const Vector2u size = dataHolder.data->backendTexture->getSize();
+            dataHolder.gpuMemoryUsage = static_cast<std::size_t>(size.x) * size.y * 4;
+            dataHolder.cpuMemoryUsage = dataHolder.data->backendTexture->getPixelMemoryUsage();
+        }
+
+        m_imageLocations[dataHolder.data.get()] = {std::prev(images.end()), m_releasedImages.end()};
+        m_statistics.gpuMemoryUsage += dataHolder.gpuMemoryUsage;
+        m_statistics.cpuMemoryUsage += dataHolder.cpuMemoryUsage;
+
+        // Make room for the new image by removing images that are no longer used
+        evictReleasedImages(m_memoryBudget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<TextureData> TextureManager::addDecodedImage(const String& filename, bool smooth, Vector2u size, std::unique_ptr<std::uint8_t[]> pixels)
+    {
+        auto& images = m_imageMap[filename];
+
+        // The image could have been loaded synchronously while it was being decoded
+        for (const auto& dataHolder : images)
+        {
+            if (dataHolder.smooth == smooth)
+            {
+                copyTexture(dataHolder.data);
+                return dataHolder.data;
+            }
+        }
+
+        ++m_statistics.misses;
+
+        TGUI_EMPLACE_BACK(dataHolder, images)
+        dataHolder.filename = filename;
+        dataHolder.users = 1;
+        dataHolder.smooth = smooth;
+        dataHolder.data = std::make_shared<TextureData>();
+        dataHolder.data->backendTexture = getBackend()->createTexture();
+
+        auto data = dataHolder.data;
+        if (!data->backendTexture->load(size, std::move(pixels), smooth))
+        {
+            images.pop_back();
+            if (images.empty())
+                m_imageMap.erase(filename);
+
+            return nullptr;
+        }
+
+        addLoadedImage(images);
+        return data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::releaseImage(const TextureData* data)
+    {
+        const auto locationIt = m_imageLocations.find(data);
+        TextureDataHolder& dataHolder = *locationIt->second.holder;
+
+        // The pixel storage may have been changed while the image was being used
+        updatePixelMemoryUsage(dataHolder);
+
+        // Images without known memory usage (i.e. svg images) can't be accounted for in the budget, so they aren't kept
+        const std::size_t memoryUsage = dataHolder.gpuMemoryUsage + dataHolder.cpuMemoryUsage;
+        if (memoryUsage == 0)
+        {
+            removeImage(locationIt);
+            return;
+        }
+
+        locationIt->second.releasedPosition = m_releasedImages.insert(m_releasedImages.end(), data);
+        m_statistics.releasedMemoryUsage += memoryUsage;
+        ++m_statistics.releasedImages;
+
+        evictReleasedImages(m_memoryBudget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::evictReleasedImages(std::size_t memoryBudget)
+    {
+        while (!m_releasedImages.empty() && (m_statistics.gpuMemoryUsage + m_statistics.cpuMemoryUsage > memoryBudget))
+        {
+            const auto locationIt = m_imageLocations.find(m_releasedImages.front());
+            m_statistics.releasedMemoryUsage -= locationIt->second.holder->gpuMemoryUsage + locationIt->second.holder->cpuMemoryUsage;
+            --m_statistics.releasedImages;
+
+            m_releasedImages.pop_front();
+            removeImage(locationIt);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeImage(ImageLocationMap::iterator locationIt)
+    {
+        const auto holderIt = locationIt->second.holder;
+        m_statistics.gpuMemoryUsage -= holderIt->gpuMemoryUsage;
+        m_statistics.cpuMemoryUsage -= holderIt->cpuMemoryUsage;
+        ++m_statistics.evictions;
+
+        const auto imageIt = m_imageMap.find(holderIt->filename);
+        if (imageIt != m_imageMap.end())
+        {
+            imageIt->second.erase(holderIt);
+            if (imageIt->second.empty())
+                m_imageMap.erase(imageIt);
+        }
+
+        m_imageLocations.erase(locationIt);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::updatePixelMemoryUsage(TextureDataHolder& dataHolder)
+    {
+        if (!dataHolder.data->backendTexture)
+            return;
+
+        const std::size_t cpuMemoryUsage = dataHolder.data->backendTexture->getPixelMemoryUsage();
+        if (cpuMemoryUsage == dataHolder.cpuMemoryUsage)
+            return;
+
+        m_statistics.cpuMemoryUsage = m_statistics.cpuMemoryUsage - dataHolder.cpuMemoryUsage + cpuMemoryUsage;
+        if (dataHolder.users == 0)
+            m_statistics.releasedMemoryUsage = m_statistics.releasedMemoryUsage - dataHolder.cpuMemoryUsage + cpuMemoryUsage;
+
+        dataHolder.cpuMemoryUsage = cpuMemoryUsage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -56,6 +56,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::vector<std::shared_ptr<Timer>> Timer::m_activeTimers;
+    Duration Timer::m_currentTime;
+    std::uint64_t Timer::m_lastScheduleId = 0;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -106,21 +108,22 @@ namespace tgui
 
     void Timer::setEnabled(bool enabled)
     {
-        if (m_enabled != enabled)
+        if (enabled)
         {
-            if (enabled)
-                m_activeTimers.push_back(shared_from_this());
-            else
+            if (!m_enabled)
             {
-                const auto it = std::find(m_activeTimers.begin(), m_activeTimers.end(), shared_from_this());
-                if (it != m_activeTimers.end())
-                    m_activeTimers.erase(it);
+                m_enabled = true;
+                m_heapIndex = m_activeTimers.size();
+                m_activeTimers.push_back(shared_from_this());
             }
-        }
 
-        m_enabled = enabled;
-        if (enabled)
             restart();
+        }
+        else if (m_enabled)
+        {
+            m_enabled = false;
+            removeFromHeap(m_heapIndex); // This could destroy the timer, so we can't access any members afterwards
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -148,31 +151,37 @@ namespace tgui
 
     void Timer::restart()
     {
-        m_remainingDuration = m_interval;
+        m_deadline = m_currentTime + m_interval;
+        m_scheduleId = ++m_lastScheduleId;
+
+        if (m_enabled)
+            updateHeapPosition(m_heapIndex);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Timer::updateTime(Duration elapsedTime)
     {
-        if (m_activeTimers.empty())
-            return false;
+        m_currentTime += elapsedTime;
+
+        // Timers that are started from within a callback function are only triggered during the next update
+        const std::uint64_t lastScheduleIdBeforeUpdate = m_lastScheduleId;
 
         bool timerTriggered = false;
-        auto activeTimers = m_activeTimers; // The callback could start and stop timers, so we need to operate on a copy
-        for (auto& timer : activeTimers)
+        while (!m_activeTimers.empty())
         {
-            if (timer->m_remainingDuration > elapsedTime)
-                timer->m_remainingDuration -= elapsedTime;
+            // The timer is copied to keep it alive while its callback is being executed
+            const auto timer = m_activeTimers.front();
+            if ((timer->m_deadline > m_currentTime) || (timer->m_scheduleId > lastScheduleIdBeforeUpdate))
+                break;
+
+            timerTriggered = true;
+            if (timer->m_repeats)
+                timer->restart();
             else
-            {
-                timerTriggered = true;
-                timer->m_callback();
-                timer->m_remainingDuration = timer->m_interval;
+                timer->setEnabled(false);
 
-                if (!timer->m_repeats)
-                    timer->setEnabled(false);
-            }
+            timer->m_callback();
         }
 
         return timerTriggered;
@@ -186,22 +195,91 @@ namespace tgui
         if (m_activeTimers.empty())
             return {};
 
-        // Find the timer with the smallest remaining duration
-        Duration minDuration = m_activeTimers[0]->m_remainingDuration;
-        for (std::size_t i = 1; i < m_activeTimers.size(); ++i)
+        // The first timer in the heap is always the one that has to be triggered first
+        const Duration remainingDuration = m_activeTimers.front()->m_deadline - m_currentTime;
+        return std::max(remainingDuration, Duration());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::clearTimers()
+    {
+        for (auto& timer : m_activeTimers)
+            timer->m_enabled = false;
+
+        m_activeTimers.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Timer::isScheduledBefore(const Timer& first, const Timer& second)
+    {
+        if (first.m_deadline != second.m_deadline)
+            return first.m_deadline < second.m_deadline;
+        else
+            return first.m_scheduleId < second.m_scheduleId;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::updateHeapPosition(std::size_t index)
+    {
+        auto timer = std::move(m_activeTimers[index]);
+
+        // Move the timer up the heap while it has to be triggered before its parent
+        while (index > 0)
         {
-            if (m_activeTimers[i]->m_remainingDuration < minDuration)
-                minDuration = m_activeTimers[i]->m_remainingDuration;
+            const std::size_t parentIndex = (index - 1) / 2;
+            if (!isScheduledBefore(*timer, *m_activeTimers[parentIndex]))
+                break;
+
+            placeInHeap(index, std::move(m_activeTimers[parentIndex]));
+            index = parentIndex;
         }
 
-        return minDuration;
+        // Move the timer down the heap while one of its children has to be triggered before it
+        while (true)
+        {
+            std::size_t childIndex = 2 * index + 1;
+            if (childIndex >= m_activeTimers.size())
+                break;
+
+            if ((childIndex + 1 < m_activeTimers.size()) && isScheduledBefore(*m_activeTimers[childIndex + 1], *m_activeTimers[childIndex]))
+                ++childIndex;
+
+            if (!isScheduledBefore(*m_activeTimers[childIndex], *timer))
+                break;
+
+            placeInHeap(index, std::move(m_activeTimers[childIndex]));
+            index = childIndex;
+        }
+
+        placeInHeap(index, std::move(timer));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Timer::clearTimers()
+    void Timer::placeInHeap(std::size_t index, std::shared_ptr<Timer> timer)
     {
-        m_activeTimers.clear();
+        timer->m_heapIndex = index;
+        m_activeTimers[index] = std::move(timer);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::removeFromHeap(std::size_t index)
+    {
+        // Keep the timer alive until the heap is valid again, in case this is the last reference to it
+        const auto removedTimer = std::move(m_activeTimers[index]);
+
+        if (index + 1 < m_activeTimers.size())
+        {
+            placeInHeap(index, std::move(m_activeTimers.back()));
+            m_activeTimers.pop_back();
+            updateHeapPosition(index);
+        }
+        else
+            m_activeTimers.pop_back();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,16 +28,73 @@
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <algorithm>
     #include <cmath>
+    #include <cstddef>
 
     #if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
         #include <numbers>
     #endif
 #endif
 
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #define TGUI_TRANSFORM_USE_SSE 1
+    #include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+    #define TGUI_TRANSFORM_USE_NEON 1
+    #include <arm_neon.h>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    // Transforms points that are stored 'stride' bytes apart from each other (e.g. the positions inside an array of vertices).
+    // Loads happen before stores for each pair of points, so input and output are allowed to be the same memory.
+    static void transformPointsStrided(const std::array<float, 16>& matrix, const unsigned char* input, unsigned char* output,
+                                       std::size_t stride, std::size_t count)
+    {
+        std::size_t i = 0;
+#if TGUI_TRANSFORM_USE_SSE
+        // Two points are transformed at once: x' = m0*x + m4*y + m12 and y' = m1*x + m5*y + m13
+        const __m128 col0 = _mm_setr_ps(matrix[0], matrix[1], matrix[0], matrix[1]);
+        const __m128 col1 = _mm_setr_ps(matrix[4], matrix[5], matrix[4], matrix[5]);
+        const __m128 col3 = _mm_setr_ps(matrix[12], matrix[13], matrix[12], matrix[13]);
+        for (; i + 2 <= count; i += 2)
+        {
+            __m128 points = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(input + i * stride));
+            points = _mm_loadh_pi(points, reinterpret_cast<const __m64*>(input + (i + 1) * stride));
+
+            const __m128 xs = _mm_shuffle_ps(points, points, _MM_SHUFFLE(2, 2, 0, 0));
+            const __m128 ys = _mm_shuffle_ps(points, points, _MM_SHUFFLE(3, 3, 1, 1));
+            const __m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, col0), _mm_mul_ps(ys, col1)), col3);
+
+            _mm_storel_pi(reinterpret_cast<__m64*>(output + i * stride), result);
+            _mm_storeh_pi(reinterpret_cast<__m64*>(output + (i + 1) * stride), result);
+        }
+#elif TGUI_TRANSFORM_USE_NEON
+        const float32x2_t col0 = {matrix[0], matrix[1]};
+        const float32x2_t col1 = {matrix[4], matrix[5]};
+        const float32x2_t col3 = {matrix[12], matrix[13]};
+        for (; i < count; ++i)
+        {
+            const float32x2_t point = vld1_f32(reinterpret_cast<const float*>(input + i * stride));
+            const float32x2_t result = vmla_lane_f32(vmla_lane_f32(col3, col0, point, 0), col1, point, 1);
+            vst1_f32(reinterpret_cast<float*>(output + i * stride), result);
+        }
+#endif
+
+        // Scalar fallback, also used for the last point when the SIMD loop processes two points at a time
+        for (; i < count; ++i)
+        {
+            const auto* point = reinterpret_cast<const float*>(input + i * stride);
+            const float x = matrix[0] * point[0] + matrix[4] * point[1] + matrix[12];
+            const float y = matrix[1] * point[0] + matrix[5] * point[1] + matrix[13];
+
+            auto* result = reinterpret_cast<float*>(output + i * stride);
+            result[0] = x;
+            result[1] = y;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Transform::Transform() :
@@ -107,6 +164,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Transform::transformPoints(const Vector2f* points, Vector2f* output, std::size_t count) const
+    {
+        static_assert(sizeof(Vector2f) == 2 * sizeof(float), "Vector2f must consist of only 2 floats");
+        transformPointsStrided(m_matrix, reinterpret_cast<const unsigned char*>(points), reinterpret_cast<unsigned char*>(output),
+                               sizeof(Vector2f), count);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Transform::transformPoints(const Vertex* vertices, Vertex* output, std::size_t count) const
+    {
+        if (output != vertices)
+            std::copy(vertices, vertices + count, output);
+
+        static_assert(offsetof(Vertex, position) == 0, "Position must be the first member of Vertex");
+        transformPointsStrided(m_matrix, reinterpret_cast<const unsigned char*>(output), reinterpret_cast<unsigned char*>(output),
+                               sizeof(Vertex), count);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     FloatRect Transform::transformRect(const FloatRect& rectangle) const
     {
         // Transform the 4 corners of the rectangle
@@ -185,7 +185,8 @@ namespace tgui
         m_fontCached                   {other.m_fontCached},
         m_opacityCached                {other.m_opacityCached},
         m_textSizeCached               {other.m_textSizeCached},
-        m_mouseCursor                  {other.m_mouseCursor}
+        m_mouseCursor                  {other.m_mouseCursor},
+        m_renderCache                  {other.m_renderCache ? std::make_unique<BackendRenderTarget::RenderCache>() : nullptr}
     {
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -232,7 +233,8 @@ namespace tgui
         m_fontCached                   {std::move(other.m_fontCached)},
         m_opacityCached                {std::move(other.m_opacityCached)},
         m_textSizeCached               {std::move(other.m_textSizeCached)},
-        m_mouseCursor                  {std::move(other.m_mouseCursor)}
+        m_mouseCursor                  {std::move(other.m_mouseCursor)},
+        m_renderCache                  {std::move(other.m_renderCache)}
     {
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -294,6 +296,7 @@ namespace tgui
             m_opacityCached        = other.m_opacityCached;
             m_textSizeCached       = other.m_textSizeCached;
             m_mouseCursor          = other.m_mouseCursor;
+            m_renderCache          = other.m_renderCache ? std::make_unique<BackendRenderTarget::RenderCache>() : nullptr;
 
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -349,6 +352,7 @@ namespace tgui
             m_opacityCached        = std::move(other.m_opacityCached);
             m_textSizeCached       = std::move(other.m_textSizeCached);
             m_mouseCursor          = std::move(other.m_mouseCursor);
+            m_renderCache          = std::move(other.m_renderCache);
 
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -398,6 +402,7 @@ namespace tgui
                     if (!parentRenderer || parentRenderer->propertyValuePairs.empty())
                         continue;
 
+                    // The properties aren't actually copied, the storage is shared until one of the renderers is changed
                     rendererData->propertyValuePairs = parentRenderer->propertyValuePairs;
                     break;
                 }
@@ -412,7 +417,7 @@ namespace tgui
                 const auto& defaultSubwidgetsMap = Theme::getRendererDefaultSubwidgets(parentType);
                 for (const auto& pair : defaultSubwidgetsMap)
                 {
-                    if (rendererData->propertyValuePairs.find(pair.first) != rendererData->propertyValuePairs.end())
+                    if (rendererData->propertyValuePairs.getMap().count(pair.first) > 0)
                         continue;
 
                     const String& subwidgetType = pair.second.empty() ? pair.first : pair.second;
@@ -427,7 +432,7 @@ namespace tgui
                 const auto& globalPropertiesMap = Theme::getRendererInheritedGlobalProperties(parentType);
                 for (const auto& pair : globalPropertiesMap)
                 {
-                    if (rendererData->propertyValuePairs.find(pair.first) != rendererData->propertyValuePairs.end())
+                    if (rendererData->propertyValuePairs.getMap().count(pair.first) > 0)
                         continue;
 
                     const String& propertyName = pair.second.empty() ? pair.first : pair.second;
@@ -463,10 +468,13 @@ namespace tgui
         m_renderer->subscribe(this);
         rendererData->shared = true;
 
-        // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value
-        auto oldIt = oldData->propertyValuePairs.begin();
-        auto newIt = rendererData->propertyValuePairs.begin();
-        while (oldIt != oldData->propertyValuePairs.end() && newIt != rendererData->propertyValuePairs.end())
+        // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value.
+        // Copies of the maps are iterated, as the handlers could change the renderer (which doesn't copy the properties).
+        const RendererPropertyMap oldProperties = oldData->propertyValuePairs;
+        const RendererPropertyMap newProperties = rendererData->propertyValuePairs;
+        auto oldIt = oldProperties.begin();
+        auto newIt = newProperties.begin();
+        while (oldIt != oldProperties.end() && newIt != newProperties.end())
         {
             if (oldIt->first < newIt->first)
             {
@@ -488,16 +496,21 @@ namespace tgui
                 }
             }
         }
-        while (oldIt != oldData->propertyValuePairs.end())
+        while (oldIt != oldProperties.end())
         {
             rendererChanged(oldIt->first);
             ++oldIt;
         }
-        while (newIt != rendererData->propertyValuePairs.end())
+        while (newIt != newProperties.end())
         {
             rendererChanged(newIt->first);
             ++newIt;
         }
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
+
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -542,10 +555,12 @@ namespace tgui
             m_prevPosition = getPosition();
             onPositionChange.emit(this, getPosition());
 
-            // Update the connected layouts, but make a copy of the set before iterating over it to prevent issues
-            // with the list being changed during the loop if some layout gets copied in a called setSize or setPosition function.
-            for (auto* layout : std::unordered_set<Layout*>(m_boundPositionLayouts))
-                layout->recalculateValue();
+            invalidateRenderCache();
+            if (m_parent)
+                m_parent->childWidgetBoundsChanged(this);
+
+            // Update the connected layouts (or mark them for recalculation when layout updates are deferred)
+            Layout::recalculateLayouts(m_boundPositionLayouts);
         }
     }
 
@@ -562,19 +577,18 @@ namespace tgui
             m_prevSize = getSize();
             onSizeChange.emit(this, getSize());
 
-            // Update the connected layouts, but make a copy of the set before iterating over it to prevent issues
-            // with the list being changed during the loop if some layout gets copied in a called setSize or setPosition function.
-            for (auto* layout : std::unordered_set<Layout*>(m_boundSizeLayouts))
-                layout->recalculateValue();
+            invalidateRenderCache();
+            if (m_parent)
+                m_parent->childWidgetBoundsChanged(this);
+
+            // Update the connected layouts (or mark them for recalculation when layout updates are deferred)
+            Layout::recalculateLayouts(m_boundSizeLayouts);
 
             // If the origin isn't in the top left then changing the size also changes the position of the widget.
             // Note that getPosition() will still return the same value (hence we don't trigger onPositionChange), but if a
             // layout was bound the the left or top of the widget as opposed to the X/Y coordinate then it needs to be recalculated.
             if ((m_origin.x != 0) || (m_origin.y != 0))
-            {
-                for (auto* layout : std::unordered_set<Layout*>(m_boundPositionLayouts))
-                    layout->recalculateValue();
-            }
+                Layout::recalculateLayouts(m_boundPositionLayouts);
         }
     }
 
@@ -624,6 +638,10 @@ namespace tgui
     void Widget::setOrigin(Vector2f origin)
     {
         m_origin = origin;
+
+        invalidateRenderCache();
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -632,6 +650,10 @@ namespace tgui
     {
         m_scaleFactors = scaleFactors;
         m_scaleOrigin.reset();
+
+        invalidateRenderCache();
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -640,6 +662,10 @@ namespace tgui
     {
         m_scaleFactors = scaleFactors;
         m_scaleOrigin = origin;
+
+        invalidateRenderCache();
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -658,6 +684,10 @@ namespace tgui
     {
         m_rotationDeg = angle;
         m_rotationOrigin.reset();
+
+        invalidateRenderCache();
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -666,6 +696,10 @@ namespace tgui
     {
         m_rotationDeg = angle;
         m_rotationOrigin = origin;
+
+        invalidateRenderCache();
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -942,6 +976,7 @@ namespace tgui
     void Widget::setVisible(bool visible)
     {
         m_visible = visible;
+        invalidateRenderCache();
 
         // If the widget is hiden while still focused then it must be unfocused
         if (!visible)
@@ -964,6 +999,7 @@ namespace tgui
     void Widget::setEnabled(bool enabled)
     {
         m_enabled = enabled;
+        invalidateRenderCache();
 
         if (!enabled)
         {
@@ -1001,6 +1037,8 @@ namespace tgui
             m_focused = false;
             onUnfocus.emit(this);
         }
+
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1039,6 +1077,7 @@ namespace tgui
     {
         m_inheritedFont = font;
         rendererChanged("Font");
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1054,6 +1093,7 @@ namespace tgui
     {
         m_inheritedOpacity = opacity;
         rendererChanged("Opacity");
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1075,6 +1115,7 @@ namespace tgui
             m_textSizeCached = m_textSize;
 
         updateTextSize();
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1153,6 +1194,55 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::setRenderCachingEnabled(bool enabled)
+    {
+        if (!enabled)
+            m_renderCache = nullptr;
+        else if (!m_renderCache)
+            m_renderCache = std::make_unique<BackendRenderTarget::RenderCache>();
+
+        // Parents that are drawn from their cache would otherwise not draw this widget again to record it
+        invalidateRenderCache();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::isRenderCachingEnabled() const
+    {
+        return m_renderCache != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidateRenderCache()
+    {
+        // The recorded draw calls of the parents include the draw calls of this widget
+        bool scaledOrRotated = false;
+        for (Widget* widget = this; widget != nullptr; widget = widget->m_parent)
+        {
+            if (widget->m_renderCache)
+                widget->m_renderCache->valid = false;
+
+            if ((widget->getScale().x != 1) || (widget->getScale().y != 1) || (widget->getRotation() != 0))
+                scaledOrRotated = true;
+        }
+
+        if (!m_parentGui || !m_parentGui->isPartialRedrawEnabled())
+            return;
+
+        // Both the location where the widget was previously drawn and the location where it will be drawn next have to be redrawn.
+        // The latter can't easily be calculated when the widget is rotated or scaled, so the entire gui is redrawn in that case.
+        if (m_lastDrawnArea)
+            m_parentGui->addDamagedArea(*m_lastDrawnArea);
+
+        if (scaledOrRotated)
+            m_parentGui->requestFullRedraw();
+        else
+            m_parentGui->addDamagedArea({getAbsolutePosition() + getWidgetOffset(), getFullSize()});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::finishAllAnimations()
     {
         for (auto& animation : m_showAnimations)
@@ -1385,36 +1475,38 @@ namespace tgui
 
     void Widget::rendererChanged(const String& property)
     {
-        if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            if (!m_enabled && (getSharedRenderer()->getOpacityDisabled() != -1))
-                m_opacityCached = getSharedRenderer()->getOpacityDisabled() * m_inheritedOpacity;
+        const auto onOpacityChanged = [](Widget& widget, const String&){
+            if (!widget.m_enabled && (widget.getSharedRenderer()->getOpacityDisabled() != -1))
+                widget.m_opacityCached = widget.getSharedRenderer()->getOpacityDisabled() * widget.m_inheritedOpacity;
             else
-                m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
-        }
-        else if (property == U"Font")
-        {
-            if (getSharedRenderer()->getFont())
-                m_fontCached = getSharedRenderer()->getFont();
-            else if (m_inheritedFont)
-                m_fontCached = m_inheritedFont;
-            else
-                m_fontCached = Font::getGlobalFont();
-        }
-        else if (property == U"TextSize")
-        {
-            if (getSharedRenderer()->getTextSize())
-                m_textSizeCached = getSharedRenderer()->getTextSize();
-            else
-                m_textSizeCached = m_textSize;
+                widget.m_opacityCached = widget.getSharedRenderer()->getOpacity() * widget.m_inheritedOpacity;
+        };
+
+        static const RendererPropertyHandlers<Widget> handlers{
+            {U"Opacity", onOpacityChanged},
+            {U"OpacityDisabled", onOpacityChanged},
+            {U"Font", [](Widget& widget, const String&){
+                if (widget.getSharedRenderer()->getFont())
+                    widget.m_fontCached = widget.getSharedRenderer()->getFont();
+                else if (widget.m_inheritedFont)
+                    widget.m_fontCached = widget.m_inheritedFont;
+                else
+                    widget.m_fontCached = Font::getGlobalFont();
+            }},
+            {U"TextSize", [](Widget& widget, const String&){
+                if (widget.getSharedRenderer()->getTextSize())
+                    widget.m_textSizeCached = widget.getSharedRenderer()->getTextSize();
+                else
+                    widget.m_textSizeCached = widget.m_textSize;
 
-            updateTextSize();
-        }
-        else if (property == U"TransparentTexture")
-        {
-            m_transparentTextureCached = getSharedRenderer()->getTransparentTexture();
-        }
-        else
+                widget.updateTextSize();
+            }},
+            {U"TransparentTexture", [](Widget& widget, const String&){
+                widget.m_transparentTextureCached = widget.getSharedRenderer()->getTransparentTexture();
+            }}
+        };
+
+        if (!handlers.call(*this, property))
             throw Exception{U"Could not set property '" + property + U"', widget of type '" + getWidgetType() + U"' does not has this property."};
     }
 
@@ -1681,6 +1773,7 @@ namespace tgui
 
         m_mouseHover = true;
         onMouseEnter.emit(this);
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1692,6 +1785,7 @@ namespace tgui
 
         m_mouseHover = false;
         onMouseLeave.emit(this);
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1699,6 +1793,26 @@ namespace tgui
     void Widget::rendererChangedCallback(const String& property)
     {
         rendererChanged(property);
+
+        // Properties such as borders or thumb textures can change the area that the widget occupies
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
+
+        invalidateRenderCache();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendRenderTarget::RenderCache* Widget::getRenderCache()
+    {
+        return m_renderCache.get();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::setLastDrawnArea(const FloatRect& area)
+    {
+        m_lastDrawnArea = area;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -216,6 +216,7 @@ namespace tgui
         m_textComponent->setString(caption);
 
         updateTextSize();
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -232,6 +233,7 @@ namespace tgui
         m_textPosition = position;
         m_textOrigin = origin;
         updateTextPosition();
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -325,118 +327,158 @@ namespace tgui
 
     void ButtonBase::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
-        {
-            background.borders = getSharedRenderer()->getBorders();
-            updateSize();
-        }
-        else if (property == U"RoundedBorderRadius")
-        {
-            background.roundedBorderRadius = getSharedRenderer()->getRoundedBorderRadius();
-        }
-        else if (property == U"TextColor")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColor(), priv::dev::ComponentState::Normal);
-        else if (property == U"TextColorDown")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDown(), priv::dev::ComponentState::Active);
-        else if (property == U"TextColorHover")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"TextColorDownHover")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"TextColorDisabled")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextColorDownDisabled")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"TextColorFocused")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"TextColorDownFocused")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"TextStyle")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyle(), priv::dev::ComponentState::Normal);
-        else if (property == U"TextStyleDown")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDown(), priv::dev::ComponentState::Active);
-        else if (property == U"TextStyleHover")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"TextStyleDownHover")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"TextStyleDisabled")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextStyleDownDisabled")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"TextStyleFocused")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"TextStyleDownFocused")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"Texture")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTexture(), priv::dev::ComponentState::Normal);
-        else if (property == U"TextureDown")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDown(), priv::dev::ComponentState::Active);
-        else if (property == U"TextureHover")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"TextureDownHover")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"TextureDisabled")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextureDownDisabled")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextureFocused")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"TextureDownFocused")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"BorderColor")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColor(), priv::dev::ComponentState::Normal);
-        else if (property == U"BorderColorDown")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDown(), priv::dev::ComponentState::Active);
-        else if (property == U"BorderColorHover")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"BorderColorDownHover")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"BorderColorDisabled")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"BorderColorDownDisabled")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"BorderColorFocused")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"BorderColorDownFocused")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"BackgroundColor")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColor(), priv::dev::ComponentState::Normal);
-        else if (property == U"BackgroundColorDown")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDown(), priv::dev::ComponentState::Active);
-        else if (property == U"BackgroundColorHover")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"BackgroundColorDownHover")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"BackgroundColorDisabled")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"BackgroundColorDownDisabled")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"BackgroundColorFocused")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"BackgroundColorDownFocused")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"TextOutlineThickness")
-        {
-            m_textComponent->setOutlineThickness(getSharedRenderer()->getTextOutlineThickness());
-            updateTextPosition();
-        }
-        else if (property == U"TextOutlineColor")
-        {
-            m_textComponent->setOutlineColor(getSharedRenderer()->getTextOutlineColor());
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            ClickableWidget::rendererChanged(property);
-            m_textComponent->setOpacity(m_opacityCached);
-            m_backgroundComponent->setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            ClickableWidget::rendererChanged(property);
-
-            m_textComponent->setFont(m_fontCached);
-            updateTextSize();
-        }
-        else
+        const auto onOpacityChanged = [](ButtonBase& button, const String& propertyName){
+            button.ClickableWidget::rendererChanged(propertyName);
+            button.m_textComponent->setOpacity(button.m_opacityCached);
+            button.m_backgroundComponent->setOpacity(button.m_opacityCached);
+        };
+
+        static const RendererPropertyHandlers<ButtonBase> handlers{
+            {U"Borders", [](ButtonBase& button, const String&){
+                button.background.borders = button.getSharedRenderer()->getBorders();
+                button.updateSize();
+            }},
+            {U"RoundedBorderRadius", [](ButtonBase& button, const String&){
+                button.background.roundedBorderRadius = button.getSharedRenderer()->getRoundedBorderRadius();
+            }},
+            {U"TextColor", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.text.color, button.getSharedRenderer()->getTextColor(), priv::dev::ComponentState::Normal);
+            }},
+            {U"TextColorDown", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.text.color, button.getSharedRenderer()->getTextColorDown(), priv::dev::ComponentState::Active);
+            }},
+            {U"TextColorHover", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.text.color, button.getSharedRenderer()->getTextColorHover(), priv::dev::ComponentState::Hover);
+            }},
+            {U"TextColorDownHover", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.text.color, button.getSharedRenderer()->getTextColorDownHover(), priv::dev::ComponentState::ActiveHover);
+            }},
+            {U"TextColorDisabled", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.text.color, button.getSharedRenderer()->getTextColorDisabled(), priv::dev::ComponentState::Disabled);
+            }},
+            {U"TextColorDownDisabled", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.text.color, button.getSharedRenderer()->getTextColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
+            }},
+            {U"TextColorFocused", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.text.color, button.getSharedRenderer()->getTextColorFocused(), priv::dev::ComponentState::Focused);
+            }},
+            {U"TextColorDownFocused", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.text.color, button.getSharedRenderer()->getTextColorDownFocused(), priv::dev::ComponentState::FocusedActive);
+            }},
+            {U"TextStyle", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.text.style, button.getSharedRenderer()->getTextStyle(), priv::dev::ComponentState::Normal);
+            }},
+            {U"TextStyleDown", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.text.style, button.getSharedRenderer()->getTextStyleDown(), priv::dev::ComponentState::Active);
+            }},
+            {U"TextStyleHover", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.text.style, button.getSharedRenderer()->getTextStyleHover(), priv::dev::ComponentState::Hover);
+            }},
+            {U"TextStyleDownHover", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.text.style, button.getSharedRenderer()->getTextStyleDownHover(), priv::dev::ComponentState::ActiveHover);
+            }},
+            {U"TextStyleDisabled", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.text.style, button.getSharedRenderer()->getTextStyleDisabled(), priv::dev::ComponentState::Disabled);
+            }},
+            {U"TextStyleDownDisabled", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.text.style, button.getSharedRenderer()->getTextStyleDownDisabled(), priv::dev::ComponentState::DisabledActive);
+            }},
+            {U"TextStyleFocused", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.text.style, button.getSharedRenderer()->getTextStyleFocused(), priv::dev::ComponentState::Focused);
+            }},
+            {U"TextStyleDownFocused", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.text.style, button.getSharedRenderer()->getTextStyleDownFocused(), priv::dev::ComponentState::FocusedActive);
+            }},
+            {U"Texture", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.texture, button.getSharedRenderer()->getTexture(), priv::dev::ComponentState::Normal);
+            }},
+            {U"TextureDown", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.texture, button.getSharedRenderer()->getTextureDown(), priv::dev::ComponentState::Active);
+            }},
+            {U"TextureHover", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.texture, button.getSharedRenderer()->getTextureHover(), priv::dev::ComponentState::Hover);
+            }},
+            {U"TextureDownHover", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.texture, button.getSharedRenderer()->getTextureDownHover(), priv::dev::ComponentState::ActiveHover);
+            }},
+            {U"TextureDisabled", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.texture, button.getSharedRenderer()->getTextureDisabled(), priv::dev::ComponentState::Disabled);
+            }},
+            {U"TextureDownDisabled", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.texture, button.getSharedRenderer()->getTextureDownDisabled(), priv::dev::ComponentState::Disabled);
+            }},
+            {U"TextureFocused", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.texture, button.getSharedRenderer()->getTextureFocused(), priv::dev::ComponentState::Focused);
+            }},
+            {U"TextureDownFocused", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.texture, button.getSharedRenderer()->getTextureDownFocused(), priv::dev::ComponentState::FocusedActive);
+            }},
+            {U"BorderColor", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.borderColor, button.getSharedRenderer()->getBorderColor(), priv::dev::ComponentState::Normal);
+            }},
+            {U"BorderColorDown", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.borderColor, button.getSharedRenderer()->getBorderColorDown(), priv::dev::ComponentState::Active);
+            }},
+            {U"BorderColorHover", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.borderColor, button.getSharedRenderer()->getBorderColorHover(), priv::dev::ComponentState::Hover);
+            }},
+            {U"BorderColorDownHover", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.borderColor, button.getSharedRenderer()->getBorderColorDownHover(), priv::dev::ComponentState::ActiveHover);
+            }},
+            {U"BorderColorDisabled", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.borderColor, button.getSharedRenderer()->getBorderColorDisabled(), priv::dev::ComponentState::Disabled);
+            }},
+            {U"BorderColorDownDisabled", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.borderColor, button.getSharedRenderer()->getBorderColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
+            }},
+            {U"BorderColorFocused", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.borderColor, button.getSharedRenderer()->getBorderColorFocused(), priv::dev::ComponentState::Focused);
+            }},
+            {U"BorderColorDownFocused", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.borderColor, button.getSharedRenderer()->getBorderColorDownFocused(), priv::dev::ComponentState::FocusedActive);
+            }},
+            {U"BackgroundColor", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.color, button.getSharedRenderer()->getBackgroundColor(), priv::dev::ComponentState::Normal);
+            }},
+            {U"BackgroundColorDown", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.color, button.getSharedRenderer()->getBackgroundColorDown(), priv::dev::ComponentState::Active);
+            }},
+            {U"BackgroundColorHover", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.color, button.getSharedRenderer()->getBackgroundColorHover(), priv::dev::ComponentState::Hover);
+            }},
+            {U"BackgroundColorDownHover", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.color, button.getSharedRenderer()->getBackgroundColorDownHover(), priv::dev::ComponentState::ActiveHover);
+            }},
+            {U"BackgroundColorDisabled", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.color, button.getSharedRenderer()->getBackgroundColorDisabled(), priv::dev::ComponentState::Disabled);
+            }},
+            {U"BackgroundColorDownDisabled", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.color, button.getSharedRenderer()->getBackgroundColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
+            }},
+            {U"BackgroundColorFocused", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.color, button.getSharedRenderer()->getBackgroundColorFocused(), priv::dev::ComponentState::Focused);
+            }},
+            {U"BackgroundColorDownFocused", [](ButtonBase& button, const String&){
+                priv::dev::setOptionalPropertyValue(button.background.color, button.getSharedRenderer()->getBackgroundColorDownFocused(), priv::dev::ComponentState::FocusedActive);
+            }},
+            {U"TextOutlineThickness", [](ButtonBase& button, const String&){
+                button.m_textComponent->setOutlineThickness(button.getSharedRenderer()->getTextOutlineThickness());
+                button.updateTextPosition();
+            }},
+            {U"TextOutlineColor", [](ButtonBase& button, const String&){
+                button.m_textComponent->setOutlineColor(button.getSharedRenderer()->getTextOutlineColor());
+            }},
+            {U"Opacity", onOpacityChanged},
+            {U"OpacityDisabled", onOpacityChanged},
+            {U"Font", [](ButtonBase& button, const String& propertyName){
+                button.ClickableWidget::rendererChanged(propertyName);
+
+                button.m_textComponent->setFont(button.m_fontCached);
+                button.updateTextSize();
+            }}
+        };
+
+        if (!handlers.call(*this, property))
             ClickableWidget::rendererChanged(property);
     }
 
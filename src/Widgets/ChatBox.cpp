@@ -25,6 +25,11 @@
 
 #include <TGUI/Widgets/ChatBox.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <cmath>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -126,30 +131,31 @@ namespace tgui
 
     void ChatBox::addLine(const String& text, Color color, TextStyles style)
     {
-        // Remove the oldest line if you exceed the maximum
-        if ((m_maxLines > 0) && (m_maxLines == m_lines.size()))
-        {
-            if (m_newLinesBelowOthers)
-                removeLine(0);
-            else
-                removeLine(m_maxLines-1);
-        }
+        insertLine(text, color, style);
+        recalculateFullTextHeight();
+    }
 
-        Line line;
-        line.string = text;
-        line.text.setColor(color);
-        line.text.setStyle(style);
-        line.text.setOpacity(m_opacityCached);
-        line.text.setCharacterSize(m_textSizeCached);
-        line.text.setString(text);
-        line.text.setFont(m_fontCached);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        recalculateLineText(line);
+    void ChatBox::addLines(const std::vector<String>& texts)
+    {
+        addLines(texts, m_textColor, m_textStyle);
+    }
 
-        if (m_newLinesBelowOthers)
-            m_lines.push_back(std::move(line));
-        else
-            m_lines.push_front(std::move(line));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::addLines(const std::vector<String>& texts, Color color, TextStyles style)
+    {
+        if (texts.empty())
+            return;
+
+        // Only the newest lines will remain when there are more texts than the line limit
+        std::size_t firstIndex = 0;
+        if ((m_maxLines > 0) && (texts.size() > m_maxLines))
+            firstIndex = texts.size() - m_maxLines;
+
+        for (std::size_t i = firstIndex; i < texts.size(); ++i)
+            insertLine(texts[i], color, style);
 
         recalculateFullTextHeight();
     }
@@ -194,6 +200,11 @@ namespace tgui
     {
         if (lineIndex < m_lines.size())
         {
+            // Move the lines below the removed line up
+            const float removedHeight = m_lines[lineIndex].text.getSize().y;
+            for (std::size_t i = lineIndex + 1; i < m_lines.size(); ++i)
+                m_lines[i].top -= removedHeight;
+
             m_lines.erase(m_lines.begin() + static_cast<std::ptrdiff_t>(lineIndex));
 
             recalculateFullTextHeight();
@@ -289,6 +300,7 @@ namespace tgui
     void ChatBox::setLinesStartFromTop(bool startFromTop)
     {
         m_linesStartFromTop = startFromTop;
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -317,6 +329,7 @@ namespace tgui
     void ChatBox::setScrollbarValue(unsigned int value)
     {
         m_scroll->setValue(value);
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -417,11 +430,66 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ChatBox::insertLine(const String& text, Color color, TextStyles style)
+    {
+        // Remove the oldest line if you exceed the maximum
+        if ((m_maxLines > 0) && (m_maxLines == m_lines.size()))
+        {
+            if (m_newLinesBelowOthers)
+                m_lines.pop_front();
+            else
+                m_lines.pop_back();
+        }
+
+        Line line;
+        line.string = text;
+        line.text.setColor(color);
+        line.text.setStyle(style);
+        line.text.setOpacity(m_opacityCached);
+        line.text.setCharacterSize(m_textSizeCached);
+        line.text.setFont(m_fontCached);
+
+        recalculateLineText(line);
+
+        // The positions keep growing when lines are continuously added and removed, so they are occasionally moved back
+        // to 0 before they become so large that the floats would lose precision.
+        if (!m_lines.empty() && (std::abs(m_lines.front().top) > 100000))
+        {
+            const float offset = m_lines.front().top;
+            for (auto& existingLine : m_lines)
+                existingLine.top -= offset;
+        }
+
+        // The positions of the existing lines don't change, the new line is placed directly above or below them
+        if (m_newLinesBelowOthers)
+        {
+            if (!m_lines.empty())
+                line.top = m_lines.back().top + m_lines.back().text.getSize().y;
+
+            m_lines.push_back(std::move(line));
+        }
+        else
+        {
+            if (!m_lines.empty())
+                line.top = m_lines.front().top - line.text.getSize().y;
+
+            m_lines.push_front(std::move(line));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBox::recalculateAllLines()
     {
+        float top = 0;
         for (auto& line : m_lines)
+        {
             recalculateLineText(line);
 
+            line.top = top;
+            top += line.text.getSize().y;
+        }
+
         recalculateFullTextHeight();
     }
 
@@ -429,9 +497,13 @@ namespace tgui
 
     void ChatBox::recalculateFullTextHeight()
     {
-        m_fullTextHeight = 0;
-        for (const auto& line : m_lines)
-            m_fullTextHeight += line.text.getSize().y;
+        // All changes to the lines pass through here, so the chat box can't be drawn from its cache anymore
+        invalidateRenderCache();
+
+        if (!m_lines.empty())
+            m_fullTextHeight = m_lines.back().top + m_lines.back().text.getSize().y - m_lines.front().top;
+        else
+            m_fullTextHeight = 0;
 
         // Update the maximum of the scrollbar
         const unsigned int oldMaximum = m_scroll->getMaximum();
@@ -636,13 +708,28 @@ namespace tgui
         states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached), -static_cast<float>(m_scroll->getValue())});
 
         // Put the lines at the bottom of the chat box if needed
-        if (!m_linesStartFromTop && (m_fullTextHeight + Text::getExtraVerticalPadding(m_textSizeCached) < getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()))
-            states.transform.translate({0, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - m_fullTextHeight - Text::getExtraVerticalPadding(m_textSizeCached)});
+        const float clippingHeight = getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom();
+        float startY = 0;
+        if (!m_linesStartFromTop && (m_fullTextHeight + Text::getExtraVerticalPadding(m_textSizeCached) < clippingHeight))
+        {
+            startY = clippingHeight - m_fullTextHeight - Text::getExtraVerticalPadding(m_textSizeCached);
+            states.transform.translate({0, startY});
+        }
 
-        for (const auto& line : m_lines)
+        // Only draw the lines that are visible. Lines are found with a binary search on their position.
+        if (!m_lines.empty())
         {
-            target.drawText(states, line.text);
-            states.transform.translate({0, line.text.getSize().y});
+            const float firstLineTop = m_lines.front().top;
+            const float visibleTop = firstLineTop + static_cast<float>(m_scroll->getValue()) - (startY + Text::getExtraVerticalPadding(m_textSizeCached));
+            const float visibleBottom = visibleTop + clippingHeight + 2 * Text::getExtraVerticalPadding(m_textSizeCached);
+            auto lineIt = std::partition_point(m_lines.begin(), m_lines.end(),
+                [visibleTop](const Line& line){ return line.top + line.text.getSize().y <= visibleTop; });
+            for (; (lineIt != m_lines.end()) && (lineIt->top < visibleBottom); ++lineIt)
+            {
+                RenderStates lineStates = states;
+                lineStates.transform.translate({0, lineIt->top - firstLineTop});
+                target.drawText(lineStates, lineIt->text);
+            }
         }
 
         target.removeClippingLayer();
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/Container.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cmath>
@@ -155,6 +156,11 @@ namespace tgui
             else
                 m_text.setStyle(m_textStyleCached);
 
+            if (m_parent)
+                m_parent->childWidgetBoundsChanged(this);
+
+            invalidateRenderCache();
+
             onCheck.emit(this, true);
             onChange.emit(this, true);
         }
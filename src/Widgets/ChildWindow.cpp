@@ -115,8 +115,7 @@ namespace tgui
         m_showTextOnTitleButtonsCached     {other.m_showTextOnTitleButtonsCached}
     {
         // The inner size has changed since the container created the child widgets
-        for (auto& layout : m_boundSizeLayouts)
-            layout->recalculateValue();
+        Layout::recalculateLayouts(m_boundSizeLayouts);
 
         connectTitleButtonCallbacks();
     }
@@ -157,8 +156,7 @@ namespace tgui
         m_showTextOnTitleButtonsCached     {std::move(other.m_showTextOnTitleButtonsCached)}
     {
         // The inner size has changed since the container created the child widgets
-        for (auto& layout : m_boundSizeLayouts)
-            layout->recalculateValue();
+        Layout::recalculateLayouts(m_boundSizeLayouts);
 
         connectTitleButtonCallbacks();
     }
@@ -204,8 +202,7 @@ namespace tgui
             m_showTextOnTitleButtonsCached      = other.m_showTextOnTitleButtonsCached;
 
             // The inner size has changed since the container created the child widgets
-            for (auto& layout : m_boundSizeLayouts)
-                layout->recalculateValue();
+            Layout::recalculateLayouts(m_boundSizeLayouts);
 
             connectTitleButtonCallbacks();
         }
@@ -253,8 +250,7 @@ namespace tgui
             Container::operator=(std::move(other));
 
             // The inner size has changed since the container created the child widgets
-            for (auto& layout : m_boundSizeLayouts)
-                layout->recalculateValue();
+            Layout::recalculateLayouts(m_boundSizeLayouts);
 
             connectTitleButtonCallbacks();
         }
@@ -465,6 +461,7 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -487,6 +484,7 @@ namespace tgui
 
         // Reposition the title text
         updateTitleBarHeight();
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -504,6 +502,7 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -570,6 +569,7 @@ namespace tgui
             m_minimizeButton->setVisible(false);
 
         updateTitleBarHeight();
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1102,8 +1102,7 @@ namespace tgui
                     m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
 
                 // If the title bar changes in height then the inner size will also change
-                for (auto& layout : m_boundSizeLayouts)
-                    layout->recalculateValue();
+                Layout::recalculateLayouts(m_boundSizeLayouts);
             }
         }
         else if (property == U"TextureBackground")
@@ -173,6 +173,7 @@ namespace tgui
     void EditBox::setDefaultText(const String& text)
     {
         m_defaultText.setString(text);
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -300,6 +301,8 @@ namespace tgui
             // If the caret was behind the limit, then set it at the end
             if (m_selEnd > m_displayedText.length())
                 setCaretPosition(m_selEnd);
+
+            invalidateRenderCache();
         }
     }
 
@@ -1054,6 +1057,9 @@ namespace tgui
 
     void EditBox::recalculateTextPositions()
     {
+        // All changes to the text or selection pass through here, so the edit box can't be drawn from its cache anymore
+        invalidateRenderCache();
+
         // If the edit box is resized then it might happen that text which previously didn't fit will now fit inside it
         if (m_textCropPosition != 0)
         {
@@ -430,6 +430,9 @@ namespace tgui
 
     void Knob::recalculateRotation()
     {
+        // Every change to the value or rotation passes through here, so the knob can't be drawn from its cache anymore
+        invalidateRenderCache();
+
         // Calculate the difference in degrees between the start and end rotation
         float allowedAngle = 0;
         if (compareFloats(m_startRotation, m_endRotation))
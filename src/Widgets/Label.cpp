@@ -188,6 +188,7 @@ namespace tgui
     void Label::setScrollbarValue(unsigned int value)
     {
         m_scrollbar->setValue(value);
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -581,6 +582,9 @@ namespace tgui
 
     void Label::rearrangeText()
     {
+        // Every change to the text passes through here, so the label can't be drawn from its cache anymore
+        invalidateRenderCache();
+
         m_lines.clear();
 
         if (m_fontCached == nullptr)
@@ -140,6 +140,7 @@ namespace tgui
         m_items.emplace_back();
         m_items.back().text = std::move(newItem);
         m_items.back().id = id;
+        invalidateRenderCache();
         return m_items.size() - 1;
     }
 
@@ -197,6 +198,8 @@ namespace tgui
             triggerOnScroll();
         }
 
+        invalidateRenderCache();
+
         return true;
     }
 
@@ -205,6 +208,7 @@ namespace tgui
     void ListBox::deselectItem()
     {
         updateSelectedItem(-1);
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -258,6 +262,7 @@ namespace tgui
         m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
         updateItemPositions();
         triggerOnScroll();
+        invalidateRenderCache();
 
         return true;
     }
@@ -275,6 +280,7 @@ namespace tgui
 
         m_scroll->setMaximum(0);
         triggerOnScroll();
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -378,6 +384,7 @@ namespace tgui
             return false;
 
         m_items[index].text.setString(newValue);
+        invalidateRenderCache();
         return true;
     }
 
@@ -441,6 +448,7 @@ namespace tgui
         m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
         updateItemPositions();
         triggerOnScroll();
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -484,6 +492,7 @@ namespace tgui
             m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
             updateItemPositions();
             triggerOnScroll();
+            invalidateRenderCache();
         }
     }
 
@@ -513,6 +522,7 @@ namespace tgui
     void ListBox::setTextAlignment(TextAlignment alignment)
     {
         m_textAlignment = alignment;
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -542,6 +552,7 @@ namespace tgui
     {
         m_scroll->setValue(value);
         triggerOnScroll();
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,10 @@
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cmath>
+    #include <atomic>
+    #include <limits>
+    #include <numeric>
+    #include <thread>
 #endif
 
 #if TGUI_HAS_WINDOW_BACKEND_SFML
@@ -40,6 +44,105 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Value stored in ListView::m_itemRows for items that are hidden by the filter
+        constexpr std::size_t hiddenRow = std::numeric_limits<std::size_t>::max();
+
+        // When more items are added at once to a sorted or filtered list view, their position is calculated in the background
+        constexpr std::size_t maxItemsToInsertDirectly = 16;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Sorts the values with std::stable_sort, while splitting the work over multiple threads when there are many values
+        template <typename Compare>
+        void parallelStableSort(std::vector<std::size_t>& values, const Compare& compare)
+        {
+            const std::size_t minValuesPerThread = 16384;
+            const std::size_t threadCount = std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()), values.size() / minValuesPerThread);
+            if (threadCount <= 1)
+            {
+                std::stable_sort(values.begin(), values.end(), compare);
+                return;
+            }
+
+            const auto begin = values.begin();
+            std::vector<std::ptrdiff_t> chunkStarts(threadCount + 1);
+            for (std::size_t i = 0; i <= threadCount; ++i)
+                chunkStarts[i] = static_cast<std::ptrdiff_t>(values.size() * i / threadCount);
+
+            // Sort each chunk on its own thread
+            std::vector<std::thread> threads;
+            for (std::size_t i = 1; i < threadCount; ++i)
+                threads.emplace_back([&compare,begin,first=chunkStarts[i],last=chunkStarts[i+1]]{ std::stable_sort(begin + first, begin + last, compare); });
+
+            std::stable_sort(begin, begin + chunkStarts[1], compare);
+            for (auto& thread : threads)
+                thread.join();
+
+            // Merge neighbouring chunks until only a single chunk remains, with each merge of a round running on its own thread
+            for (std::size_t width = 1; width < threadCount; width *= 2)
+            {
+                threads.clear();
+                for (std::size_t i = 0; i + width < threadCount; i += 2 * width)
+                {
+                    const auto first = begin + chunkStarts[i];
+                    const auto middle = begin + chunkStarts[i + width];
+                    const auto last = begin + chunkStarts[std::min(i + 2 * width, threadCount)];
+                    threads.emplace_back([&compare,first,middle,last]{ std::inplace_merge(first, middle, last, compare); });
+                }
+
+                for (auto& thread : threads)
+                    thread.join();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct ListView::SortFilterTask
+    {
+        ~SortFilterTask()
+        {
+            // If the task is still running then make it finish as soon as possible, its result is no longer needed
+            cancelled = true;
+            if (thread.joinable())
+                thread.join();
+        }
+
+        // Called within separate thread
+        void run()
+        {
+            std::vector<std::size_t> items;
+            items.reserve(itemCount);
+            for (std::size_t i = 0; (i < itemCount) && !cancelled; ++i)
+            {
+                if (!filter || filter(rows[i]))
+                    items.push_back(i);
+            }
+
+            // The comparator always returns false after cancelling, which makes the sort finish quickly
+            if (compare)
+                parallelStableSort(items, [this](std::size_t left, std::size_t right){ return !cancelled && compare(sortKeys[left], sortKeys[right]); });
+
+            result = std::move(items);
+            finished = true;
+        }
+
+        std::size_t itemCount = 0;
+        std::vector<String> sortKeys; // Only filled when there is a comparator
+        std::vector<std::vector<String>> rows; // Only filled when there is a filter
+        std::function<bool(const String&, const String&)> compare;
+        std::function<bool(const std::vector<String>&)> filter;
+
+        std::vector<std::size_t> result;
+        std::atomic<bool> finished{false};
+        std::atomic<bool> cancelled{false};
+        std::thread thread;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #if TGUI_COMPILED_WITH_CPP_VER < 17
     constexpr const char ListView::StaticWidgetType[];
 #endif
@@ -255,7 +358,10 @@ namespace tgui
     void ListView::setColumnAlignment(std::size_t columnIndex, ColumnAlignment alignment)
     {
         if (columnIndex < m_columns.size())
+        {
             m_columns[columnIndex].alignment = alignment;
+            invalidateRenderCache();
+        }
         else
         {
             TGUI_PRINT_WARNING("setColumnAlignment called with invalid columnIndex.");
@@ -294,6 +400,12 @@ namespace tgui
 
     std::size_t ListView::addItem(const String& text)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::addItem can't be used while a data provider is set.");
+            return 0;
+        }
+
         TGUI_EMPLACE_BACK(item, m_items)
         item.texts.push_back(createText(text));
         item.icon.setOpacity(m_opacityCached);
@@ -301,6 +413,8 @@ namespace tgui
         const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(item);
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
+
+        itemsInserted(m_items.size() - 1, 1);
         updateVerticalScrollbarMaximum();
 
         // Scroll down when auto-scrolling is enabled
@@ -314,6 +428,12 @@ namespace tgui
 
     std::size_t ListView::addItem(const std::vector<String>& itemTexts)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::addItem can't be used while a data provider is set.");
+            return 0;
+        }
+
         TGUI_EMPLACE_BACK(item, m_items)
         item.texts.reserve(itemTexts.size());
         for (const auto& text : itemTexts)
@@ -324,6 +444,8 @@ namespace tgui
         const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(item);
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
+
+        itemsInserted(m_items.size() - 1, 1);
         updateVerticalScrollbarMaximum();
 
         // Scroll down when auto-scrolling is enabled
@@ -337,8 +459,15 @@ namespace tgui
 
     void ListView::addMultipleItems(const std::vector<std::vector<String>>& items)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::addMultipleItems can't be used while a data provider is set.");
+            return;
+        }
+
         bool updatedLastColumnMaxItemWidth = false;
 
+        const std::size_t oldItemCount = m_items.size();
         for (const auto& itemToInsert : items)
         {
             TGUI_EMPLACE_BACK(item, m_items)
@@ -353,6 +482,8 @@ namespace tgui
 
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
+
+        itemsInserted(oldItemCount, items.size());
         updateVerticalScrollbarMaximum();
 
         // Scroll down when auto-scrolling is enabled
@@ -364,6 +495,12 @@ namespace tgui
 
     void ListView::insertItem(std::size_t index, const String& text)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::insertItem can't be used while a data provider is set.");
+            return;
+        }
+
         if (index >= m_items.size())
         {
             addItem(text);
@@ -377,17 +514,26 @@ namespace tgui
         const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(item);
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
+
+        itemsInserted(index, 1);
         updateVerticalScrollbarMaximum();
 
         // Scroll to the item when auto-scrolling is enabled
-        if (m_autoScroll)
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+        const int row = getRowOfItem(index);
+        if (m_autoScroll && (row >= 0))
+            m_verticalScrollbar->setValue(m_itemHeight * static_cast<unsigned int>(row));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ListView::insertItem(std::size_t index, const std::vector<String>& itemTexts)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::insertItem can't be used while a data provider is set.");
+            return;
+        }
+
         if (index >= m_items.size())
         {
             addItem(itemTexts);
@@ -404,17 +550,26 @@ namespace tgui
         const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(item);
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
+
+        itemsInserted(index, 1);
         updateVerticalScrollbarMaximum();
 
         // Scroll to the item when auto-scrolling is enabled
-        if (m_autoScroll)
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+        const int row = getRowOfItem(index);
+        if (m_autoScroll && (row >= 0))
+            m_verticalScrollbar->setValue(m_itemHeight * static_cast<unsigned int>(row));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ListView::insertMultipleItems(std::size_t index, const std::vector<std::vector<String>>& items)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::insertMultipleItems can't be used while a data provider is set.");
+            return;
+        }
+
         if (index >= m_items.size())
         {
             addMultipleItems(items);
@@ -437,17 +592,26 @@ namespace tgui
 
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
+
+        itemsInserted(index, items.size());
         updateVerticalScrollbarMaximum();
 
         // Scroll to the item when auto-scrolling is enabled
-        if (m_autoScroll)
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+        const int row = getRowOfItem(index);
+        if (m_autoScroll && (row >= 0))
+            m_verticalScrollbar->setValue(m_itemHeight * static_cast<unsigned int>(row));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListView::changeItem(std::size_t index, const std::vector<String>& itemTexts)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::changeItem can't be used while a data provider is set.");
+            return false;
+        }
+
         if (index >= m_items.size())
             return false;
 
@@ -475,7 +639,7 @@ namespace tgui
         }
 
         // Update the text color in case the changed item was selected
-        if (m_selectedItems.find(index) != m_selectedItems.end())
+        if (m_selectedItems.contains(index))
         {
             if ((static_cast<int>(index) == m_hoveredItem) && m_selectedTextColorHoverCached.isSet())
                 setItemColor(index, m_selectedTextColorHoverCached);
@@ -487,6 +651,7 @@ namespace tgui
         else if ((static_cast<int>(index) == m_hoveredItem) && m_textColorHoverCached.isSet())
             setItemColor(index, m_textColorHoverCached);
 
+        itemChanged(index);
         return true;
     }
 
@@ -494,6 +659,12 @@ namespace tgui
 
     bool ListView::changeSubItem(std::size_t index, std::size_t column, const String& itemText)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::changeSubItem can't be used while a data provider is set.");
+            return false;
+        }
+
         if (index >= m_items.size())
             return false;
 
@@ -521,7 +692,7 @@ namespace tgui
         }
 
         // Update the text color in case the changed item was selected
-        if (m_selectedItems.find(index) != m_selectedItems.end())
+        if (m_selectedItems.contains(index))
         {
             if ((static_cast<int>(index) == m_hoveredItem) && m_selectedTextColorHoverCached.isSet())
                 setItemColor(index, m_selectedTextColorHoverCached);
@@ -533,6 +704,7 @@ namespace tgui
         else if ((static_cast<int>(index) == m_hoveredItem) && m_textColorHoverCached.isSet())
             setItemColor(index, m_textColorHoverCached);
 
+        itemChanged(index);
         return true;
     }
 
@@ -540,6 +712,12 @@ namespace tgui
 
     bool ListView::removeItem(std::size_t index)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::removeItem can't be used while a data provider is set.");
+            return false;
+        }
+
         // Update the hovered item
         if (m_hoveredItem >= 0)
         {
@@ -552,34 +730,31 @@ namespace tgui
         // Update the selected items
         if (!m_selectedItems.empty())
         {
-            if (m_selectedItems.count(index))
+            if (m_selectedItems.contains(index))
             {
                 m_selectedItems.erase(index);
                 setItemColor(index, m_textColorCached);
                 if (!m_selectedItems.empty())
-                    onItemSelect.emit(this, static_cast<int>(*m_selectedItems.begin()));
+                    onItemSelect.emit(this, static_cast<int>(m_selectedItems.front()));
                 else
                     onItemSelect.emit(this, -1);
             }
 
             // Don't call updateSelectedItem here, there should not be no callback and the item hasn't been erased yet so it would point to the wrong place
-            decltype(m_selectedItems) newSelectedItems;
-            for (const auto selectedItem : m_selectedItems)
+            for (const auto& range : m_selectedItems.getRanges())
             {
-                if (selectedItem < index)
-                    newSelectedItems.insert(selectedItem);
-                else if (selectedItem > index)
-                {
-                    newSelectedItems.insert(selectedItem - 1);
+                for (std::size_t selectedItem = std::max(range.first, index + 1); selectedItem < range.second; ++selectedItem)
                     setItemColor(selectedItem, m_textColorCached);
-                }
             }
 
+            IndexRanges newSelectedItems = m_selectedItems;
+            newSelectedItems.eraseAndShift(index);
+
             if (m_firstSelectedItemIndex == static_cast<int>(index))
             {
                 // The selection started from the removed item, just arbitrarily choose a different item (the top one)
                 if (!newSelectedItems.empty())
-                    m_firstSelectedItemIndex = static_cast<int>(*newSelectedItems.begin());
+                    m_firstSelectedItemIndex = static_cast<int>(newSelectedItems.front());
                 else
                     m_firstSelectedItemIndex = -1;
             }
@@ -595,7 +770,7 @@ namespace tgui
                     m_focusedItemIndex = -1;
             }
 
-            m_selectedItems = newSelectedItems;
+            m_selectedItems = std::move(newSelectedItems);
             updateSelectedAndhoveredItemColors();
         }
 
@@ -606,6 +781,7 @@ namespace tgui
 
         const bool wasIconSet = m_items[index].icon.isSet();
         m_items.erase(m_items.begin() + static_cast<std::ptrdiff_t>(index));
+        itemRemoved(index);
 
         if (wasIconSet)
         {
@@ -658,6 +834,13 @@ namespace tgui
         updateHoveredItem(-1);
 
         m_items.clear();
+        m_dataProvider = nullptr;
+        clearDataProviderCache();
+
+        m_displayedItems.clear();
+        m_itemRows.clear();
+        m_sortFilterTask = nullptr;
+        m_sortFilterTaskNeeded = false;
 
         m_iconCount = 0;
         m_maxIconWidth = m_fixedIconSize.x;
@@ -672,7 +855,7 @@ namespace tgui
 
     void ListView::setSelectedItem(std::size_t index)
     {
-        if (index >= m_items.size())
+        if (index >= getItemCount())
         {
             updateSelectedItem(-1);
             return;
@@ -681,10 +864,15 @@ namespace tgui
         updateSelectedItem(static_cast<int>(index));
 
         // Move the scrollbar
-        if (index * getItemHeight() < m_verticalScrollbar->getValue())
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(index * getItemHeight()));
-        else if (static_cast<unsigned int>(index + 1) * getItemHeight() > m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize())
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(index + 1) * getItemHeight() - m_verticalScrollbar->getViewportSize());
+        const int rowIndex = getRowOfItem(index);
+        if (rowIndex < 0)
+            return;
+
+        const auto row = static_cast<std::size_t>(rowIndex);
+        if (row * getItemHeight() < m_verticalScrollbar->getValue())
+            m_verticalScrollbar->setValue(static_cast<unsigned int>(row * getItemHeight()));
+        else if (static_cast<unsigned int>(row + 1) * getItemHeight() > m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize())
+            m_verticalScrollbar->setValue(static_cast<unsigned int>(row + 1) * getItemHeight() - m_verticalScrollbar->getViewportSize());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -697,31 +885,29 @@ namespace tgui
             return;
         }
 
-        if (m_selectedItems == indices)
-            return;
+        IndexRanges selectedItems;
+        for (const auto index : indices)
+            selectedItems.insert(index);
 
-        for (const auto index : m_selectedItems)
-        {
-            if (indices.find(index) == indices.end())
-                setItemColor(index, m_textColorCached);
-        }
+        updateSelectedItems(std::move(selectedItems));
+    }
 
-        m_selectedItems = indices;
-        updateSelectedAndhoveredItemColors();
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if (!m_selectedItems.empty())
-        {
-            // Select first selected item arbitrarily (top one is chosen) if the previous value is no longer valid
-            if ((m_firstSelectedItemIndex < 0) || (m_selectedItems.find(static_cast<std::size_t>(m_firstSelectedItemIndex)) == m_selectedItems.end()))
-                m_firstSelectedItemIndex = static_cast<int>(*m_selectedItems.begin());
+    void ListView::setSelectedItemRange(std::size_t firstIndex, std::size_t lastIndex)
+    {
+        if (firstIndex > lastIndex)
+            std::swap(firstIndex, lastIndex);
 
-            onItemSelect.emit(this, static_cast<int>(*m_selectedItems.begin()));
-        }
-        else
+        if (!m_multiSelect)
         {
-            m_firstSelectedItemIndex = -1;
-            onItemSelect.emit(this, -1);
+            setSelectedItem(firstIndex);
+            return;
         }
+
+        IndexRanges selectedItems;
+        selectedItems.insert(firstIndex, std::min(lastIndex + 1, getItemCount()));
+        updateSelectedItems(std::move(selectedItems));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -736,7 +922,7 @@ namespace tgui
     int ListView::getSelectedItemIndex() const
     {
         if (!m_selectedItems.empty())
-            return static_cast<int>(*m_selectedItems.begin());
+            return static_cast<int>(m_selectedItems.front());
         else
             return -1;
     }
@@ -747,7 +933,7 @@ namespace tgui
     {
         m_multiSelect = multiSelect;
         if (!m_multiSelect && m_selectedItems.size() > 1)
-            updateSelectedItem(static_cast<int>(*m_selectedItems.begin()));
+            updateSelectedItem(static_cast<int>(m_selectedItems.front()));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -761,13 +947,38 @@ namespace tgui
 
     std::set<std::size_t> ListView::getSelectedItemIndices() const
     {
-        return m_selectedItems;
+        std::set<std::size_t> indices;
+        for (const auto& range : m_selectedItems.getRanges())
+        {
+            for (std::size_t index = range.first; index < range.second; ++index)
+                indices.insert(indices.end(), index);
+        }
+
+        return indices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::pair<std::size_t, std::size_t>> ListView::getSelectedItemRanges() const
+    {
+        std::vector<std::pair<std::size_t, std::size_t>> ranges;
+        ranges.reserve(m_selectedItems.getRanges().size());
+        for (const auto& range : m_selectedItems.getRanges())
+            ranges.emplace_back(range.first, range.second - 1);
+
+        return ranges;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ListView::setItemData(std::size_t index, Any data)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::setItemData can't be used while a data provider is set.");
+            return;
+        }
+
         if (index >= m_items.size())
         {
             TGUI_PRINT_WARNING("ListView::setItemData called with invalid index.");
@@ -781,6 +992,12 @@ namespace tgui
 
     void ListView::setItemIcon(std::size_t index, const Texture& texture)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::setItemIcon can't be used while a data provider is set.");
+            return;
+        }
+
         if (index >= m_items.size())
         {
             TGUI_PRINT_WARNING("ListView::setItemIcon called with invalid index.");
@@ -790,16 +1007,7 @@ namespace tgui
         const bool wasIconSet = m_items[index].icon.isSet();
         m_items[index].icon.setTexture(texture);
 
-        Vector2f iconSize;
-        if ((m_fixedIconSize.x != 0) && (m_fixedIconSize.y != 0))
-            iconSize = m_fixedIconSize;
-        else if ((m_fixedIconSize.y != 0) && (m_fixedIconSize.y != texture.getImageSize().y))
-            iconSize = {static_cast<float>(texture.getImageSize().x) / texture.getImageSize().y * m_fixedIconSize.y, static_cast<float>(m_fixedIconSize.y)};
-        else if ((m_fixedIconSize.x != 0) && (m_fixedIconSize.x != texture.getImageSize().x))
-            iconSize = {static_cast<float>(m_fixedIconSize.x), static_cast<float>(texture.getImageSize().y) / texture.getImageSize().x * m_fixedIconSize.x};
-        else
-            iconSize = Vector2f{texture.getImageSize()};
-
+        const Vector2f iconSize = calculateIconSize(texture);
         m_items[index].icon.setSize(iconSize);
 
         if (m_items[index].icon.isSet())
@@ -832,13 +1040,17 @@ namespace tgui
         const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(m_items[index]);
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
+
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Texture ListView::getItemIcon(std::size_t index) const
     {
-        if (index < m_items.size())
+        if (m_dataProvider && (index < m_dataProvider->getRowCount()))
+            return m_dataProvider->getIcon(index);
+        else if (index < m_items.size())
             return m_items[index].icon.getTexture();
         else
         {
@@ -851,19 +1063,25 @@ namespace tgui
 
     std::size_t ListView::getItemCount() const
     {
-        return m_items.size();
+        if (m_dataProvider)
+            return m_dataProvider->getRowCount();
+        else
+            return m_items.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     String ListView::getItemCell(std::size_t rowIndex, std::size_t columnIndex) const
     {
-        if (rowIndex >= m_items.size())
+        if (rowIndex >= getItemCount())
             return "";
 
         if (columnIndex != 0 && columnIndex >= m_columns.size())
             return "";
 
+        if (m_dataProvider)
+            return m_dataProvider->getCellText(rowIndex, columnIndex);
+
         if (columnIndex < m_items[rowIndex].texts.size())
             return m_items[rowIndex].texts[columnIndex].getString();
 
@@ -874,6 +1092,9 @@ namespace tgui
 
     String ListView::getItem(std::size_t index) const
     {
+        if (m_dataProvider)
+            return getItemCell(index, 0);
+
         if (index >= m_items.size())
             return "";
 
@@ -888,7 +1109,15 @@ namespace tgui
     std::vector<String> ListView::getItemRow(std::size_t index) const
     {
         std::vector<String> row;
-        if (index < m_items.size())
+        if (m_dataProvider)
+        {
+            if (index < m_dataProvider->getRowCount())
+            {
+                for (std::size_t column = 0; column < std::max<std::size_t>(1, m_columns.size()); ++column)
+                    row.push_back(m_dataProvider->getCellText(index, column));
+            }
+        }
+        else if (index < m_items.size())
         {
             for (const auto& text : m_items[index].texts)
                 row.push_back(text.getString());
@@ -902,6 +1131,12 @@ namespace tgui
 
     void ListView::sort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::sort can't be used while a data provider is set.");
+            return;
+        }
+
         if (index >= m_items.size())
             return;
 
@@ -918,15 +1153,121 @@ namespace tgui
 
                 return cmp(s1, s2);
             });
+
+        // The items have been moved, so the displayed order needs to be calculated again
+        if (isSortedOrFiltered())
+            restartSortFilterTask();
+
+        invalidateRenderCache();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setSortOrder(std::size_t column, std::function<bool(const String&, const String&)> cmp)
+    {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::setSortOrder can't be used while a data provider is set.");
+            return;
+        }
+
+        const bool wasSortedOrFiltered = isSortedOrFiltered();
+        m_sortColumn = column;
+        m_sortCompare = std::move(cmp);
+        sortOrFilterChanged(wasSortedOrFiltered);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setFilter(std::function<bool(const std::vector<String>&)> filter)
+    {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::setFilter can't be used while a data provider is set.");
+            return;
+        }
+
+        const bool wasSortedOrFiltered = isSortedOrFiltered();
+        m_filter = std::move(filter);
+        sortOrFilterChanged(wasSortedOrFiltered);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::isSortOrFilterPending() const
+    {
+        return m_sortFilterTask || m_sortFilterTaskNeeded;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::getDisplayedItemCount() const
+    {
+        if (isSortedOrFiltered())
+            return m_displayedItems.size();
+        else
+            return getItemCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::size_t> ListView::getDisplayedItemIndices() const
+    {
+        if (isSortedOrFiltered())
+            return m_displayedItems;
+
+        std::vector<std::size_t> indices(getItemCount());
+        std::iota(indices.begin(), indices.end(), std::size_t{0});
+        return indices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setDataProvider(std::shared_ptr<DataProvider> dataProvider)
+    {
+        removeAllItems();
+
+        m_dataProvider = std::move(dataProvider);
+        updateFromDataProvider();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<ListView::DataProvider> ListView::getDataProvider() const
+    {
+        return m_dataProvider;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateFromDataProvider()
+    {
+        clearDataProviderCache();
+
+        const std::size_t itemCount = getItemCount();
+        if (m_hoveredItem >= static_cast<int>(itemCount))
+            updateHoveredItem(-1);
+        if (m_focusedItemIndex >= static_cast<int>(itemCount))
+            m_focusedItemIndex = static_cast<int>(itemCount) - 1;
+
+        // Deselect the items that no longer exist
+        if (!m_selectedItems.empty() && (m_selectedItems.getRanges().back().second > itemCount))
+        {
+            IndexRanges selectedItems = m_selectedItems;
+            selectedItems.eraseFrom(itemCount);
+            updateSelectedItems(std::move(selectedItems));
+        }
+
+        updateVerticalScrollbarMaximum();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::vector<String> ListView::getItems() const
     {
-        std::vector<String> items(m_items.size());
+        std::vector<String> items(getItemCount());
 
-        for (std::size_t i = 0; i < m_items.size(); i++)
+        for (std::size_t i = 0; i < items.size(); i++)
             items[i] = getItemCell(i, 0);
 
         return items;
@@ -938,6 +1279,16 @@ namespace tgui
     {
         std::vector<std::vector<String>> rows;
 
+        if (m_dataProvider)
+        {
+            const std::size_t rowCount = m_dataProvider->getRowCount();
+            rows.reserve(rowCount);
+            for (std::size_t i = 0; i < rowCount; ++i)
+                rows.push_back(getItemRow(i));
+
+            return rows;
+        }
+
         for (const auto& item : m_items)
         {
             std::vector<String> row;
@@ -978,6 +1329,7 @@ namespace tgui
         if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
             m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
 
+        clearDataProviderCache();
         for (auto& item : m_items)
         {
             for (auto& text : item.texts)
@@ -1210,6 +1562,7 @@ namespace tgui
     void ListView::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1224,6 +1577,7 @@ namespace tgui
     void ListView::setHorizontalScrollbarValue(unsigned int value)
     {
         m_horizontalScrollbar->setValue(value);
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1242,6 +1596,8 @@ namespace tgui
 
         m_fixedIconSize = fixedIconSize;
         m_maxIconWidth = m_fixedIconSize.x; // If 0 then it will be changed below
+        clearDataProviderCache();
+        invalidateRenderCache();
 
         if (m_iconCount == 0)
             return;
@@ -1251,18 +1607,7 @@ namespace tgui
             if (!item.icon.isSet())
                 continue;
 
-            const Texture& texture = item.icon.getTexture();
-
-            Vector2f iconSize;
-            if ((m_fixedIconSize.x != 0) && (m_fixedIconSize.y != 0))
-                iconSize = m_fixedIconSize;
-            else if ((m_fixedIconSize.y != 0) && (m_fixedIconSize.y != texture.getImageSize().y))
-                iconSize = {static_cast<float>(texture.getImageSize().x) / texture.getImageSize().y * m_fixedIconSize.y, static_cast<float>(m_fixedIconSize.y)};
-            else if ((m_fixedIconSize.x != 0) && (m_fixedIconSize.x != texture.getImageSize().x))
-                iconSize = {static_cast<float>(m_fixedIconSize.x), static_cast<float>(texture.getImageSize().y) / texture.getImageSize().x * m_fixedIconSize.x};
-            else
-                iconSize = Vector2f{texture.getImageSize()};
-
+            const Vector2f iconSize = calculateIconSize(item.icon.getTexture());
             item.icon.setSize(iconSize);
             m_maxIconWidth = std::max(m_maxIconWidth, iconSize.x);
         }
@@ -1325,7 +1670,7 @@ namespace tgui
         {
             updateHoveredItemByMousePos(pos);
 
-            const bool mouseOnSelectedItem = (m_hoveredItem >= 0) && (m_selectedItems.find(static_cast<std::size_t>(m_hoveredItem)) != m_selectedItems.end());
+            const bool mouseOnSelectedItem = (m_hoveredItem >= 0) && m_selectedItems.contains(static_cast<std::size_t>(m_hoveredItem));
             if (!mouseOnSelectedItem)
                 m_possibleDoubleClick = false;
 
@@ -1502,7 +1847,7 @@ namespace tgui
                 // If the mouse is held down then select the item below the mouse
                 if ((m_hoveredItem != oldHoveredItem) && m_mouseDown && !m_verticalScrollbar->isMouseDown() && !m_horizontalScrollbar->isMouseDown())
                 {
-                    const bool mouseOnSelectedItem = (m_hoveredItem >= 0) && (m_selectedItems.find(static_cast<std::size_t>(m_hoveredItem)) != m_selectedItems.end());
+                    const bool mouseOnSelectedItem = (m_hoveredItem >= 0) && m_selectedItems.contains(static_cast<std::size_t>(m_hoveredItem));
                     if (m_multiSelect)
                     {
                         if (keyboard::isMultiselectModifierPressed())
@@ -1589,16 +1934,18 @@ namespace tgui
     void ListView::keyPressed(const Event::KeyEvent& event)
     {
         Widget::keyPressed(event);
-        if (event.code == Event::KeyboardKey::Up && (m_focusedItemIndex > 0))
+
+        const int focusedRow = (m_focusedItemIndex >= 0) ? getRowOfItem(static_cast<std::size_t>(m_focusedItemIndex)) : -1;
+        if (event.code == Event::KeyboardKey::Up && (focusedRow > 0))
         {
-            const auto indexAbove = static_cast<std::size_t>(m_focusedItemIndex - 1);
+            const std::size_t indexAbove = getItemIndexAtRow(static_cast<std::size_t>(focusedRow - 1));
             if (m_multiSelect && keyboard::isShiftPressed())
             {
                 selectRangeFromEvent(indexAbove);
             }
             else if (m_multiSelect && keyboard::isMultiselectModifierPressed())
             {
-                if (m_selectedItems.find(indexAbove) != m_selectedItems.end())
+                if (m_selectedItems.contains(indexAbove))
                     removeSelectedItem(indexAbove);
                 else
                     addSelectedItem(static_cast<int>(indexAbove));
@@ -1606,16 +1953,16 @@ namespace tgui
             else // Only one item should be selected
                 setSelectedItem(indexAbove);
         }
-        else if (event.code == Event::KeyboardKey::Down && (m_focusedItemIndex + 1 < static_cast<int>(m_items.size())))
+        else if (event.code == Event::KeyboardKey::Down && (focusedRow + 1 < static_cast<int>(getDisplayedItemCount())))
         {
-            const std::size_t indexBelow = (m_focusedItemIndex >= 0) ? static_cast<std::size_t>(m_focusedItemIndex) + 1 : 0;
+            const std::size_t indexBelow = getItemIndexAtRow(static_cast<std::size_t>(focusedRow + 1));
             if (m_multiSelect && keyboard::isShiftPressed())
             {
                 selectRangeFromEvent(indexBelow);
             }
             else if (m_multiSelect && keyboard::isMultiselectModifierPressed())
             {
-                if (m_selectedItems.find(indexBelow) != m_selectedItems.end())
+                if (m_selectedItems.contains(indexBelow))
                     removeSelectedItem(indexBelow);
                 else
                     addSelectedItem(static_cast<int>(indexBelow));
@@ -1626,17 +1973,28 @@ namespace tgui
         else if (keyboard::isKeyPressCopy(event))
         {
             String buf;
-            for (const std::size_t index : m_selectedItems)
+            for (const auto& range : m_selectedItems.getRanges())
             {
-                String temp;
-                for (const auto& text : m_items[index].texts)
-                    temp.append(text.getString() + '\t');
+                for (std::size_t index = range.first; index < range.second; ++index)
+                {
+                    String temp;
+                    if (m_dataProvider)
+                    {
+                        for (const auto& cell : getItemRow(index))
+                            temp.append(cell + '\t');
+                    }
+                    else
+                    {
+                        for (const auto& text : m_items[index].texts)
+                            temp.append(text.getString() + '\t');
+                    }
 
-                if (*temp.rbegin() == '\t')
-                    temp.pop_back();
+                    if (*temp.rbegin() == '\t')
+                        temp.pop_back();
 
-                temp.append('\n');
-                buf.append(temp);
+                    temp.append('\n');
+                    buf.append(temp);
+                }
             }
             getBackend()->setClipboard(buf);
         }
@@ -1773,6 +2131,7 @@ namespace tgui
             for (auto& column : m_columns)
                 column.text.setOpacity(m_opacityCached);
 
+            clearDataProviderCache();
             for (auto& item : m_items)
             {
                 for (auto& text : item.texts)
@@ -1788,6 +2147,7 @@ namespace tgui
             for (auto& column : m_columns)
                 column.text.setFont(m_fontCached);
 
+            clearDataProviderCache();
             for (auto& item : m_items)
             {
                 for (auto& text : item.texts)
@@ -1875,10 +2235,12 @@ namespace tgui
 
         if (!m_selectedItems.empty())
         {
-            auto it = m_selectedItems.cbegin();
-            String iList = "[" + Serializer::serialize(*it);
-            for (++it; it != m_selectedItems.cend(); ++it)
-                iList += ", " + Serializer::serialize(*it);
+            String iList;
+            for (const auto& range : m_selectedItems.getRanges())
+            {
+                for (std::size_t index = range.first; index < range.second; ++index)
+                    iList += (iList.empty() ? "[" : ", ") + Serializer::serialize(index);
+            }
 
             iList += "]";
 
@@ -2090,7 +2452,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Text ListView::createText(const String& caption)
+    Text ListView::createText(const String& caption) const
     {
         Text text;
         text.setFont(m_fontCached);
@@ -2123,12 +2485,49 @@ namespace tgui
 
     void ListView::setItemColor(std::size_t index, const Color& color)
     {
+        // Items from a data provider aren't stored, they get their color when they are drawn
+        if (index >= m_items.size())
+            return;
+
         for (auto& text : m_items[index].texts)
             text.setColor(color);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const Color& ListView::getItemTextColor(std::size_t index) const
+    {
+        const bool hovered = (static_cast<int>(index) == m_hoveredItem);
+        if (m_selectedItems.contains(index))
+        {
+            if (hovered && m_selectedTextColorHoverCached.isSet())
+                return m_selectedTextColorHoverCached;
+            else if (m_selectedTextColorCached.isSet())
+                return m_selectedTextColorCached;
+        }
+
+        if (hovered && m_textColorHoverCached.isSet())
+            return m_textColorHoverCached;
+        else
+            return m_textColorCached;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f ListView::calculateIconSize(const Texture& texture) const
+    {
+        if ((m_fixedIconSize.x != 0) && (m_fixedIconSize.y != 0))
+            return m_fixedIconSize;
+        else if ((m_fixedIconSize.y != 0) && (m_fixedIconSize.y != texture.getImageSize().y))
+            return {static_cast<float>(texture.getImageSize().x) / texture.getImageSize().y * m_fixedIconSize.y, static_cast<float>(m_fixedIconSize.y)};
+        else if ((m_fixedIconSize.x != 0) && (m_fixedIconSize.x != texture.getImageSize().x))
+            return {static_cast<float>(m_fixedIconSize.x), static_cast<float>(texture.getImageSize().y) / texture.getImageSize().x * m_fixedIconSize.x};
+        else
+            return Vector2f{texture.getImageSize()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float ListView::calculateAutoColumnWidth(const Text& text)
     {
         return text.getSize().x + (2.f * text.getExtraHorizontalOffset());
@@ -2138,15 +2537,22 @@ namespace tgui
 
     void ListView::updateSelectedAndhoveredItemColors()
     {
-        for (const std::size_t selectedItem : m_selectedItems)
+        // Items from a data provider get their color when they are drawn
+        if (m_dataProvider)
+            return;
+
+        for (const auto& range : m_selectedItems.getRanges())
         {
-            if ((static_cast<int>(selectedItem) == m_hoveredItem) && m_selectedTextColorHoverCached.isSet())
-                setItemColor(selectedItem, m_selectedTextColorHoverCached);
-            else if (m_selectedTextColorCached.isSet())
-                setItemColor(selectedItem, m_selectedTextColorCached);
+            for (std::size_t selectedItem = range.first; selectedItem < range.second; ++selectedItem)
+            {
+                if ((static_cast<int>(selectedItem) == m_hoveredItem) && m_selectedTextColorHoverCached.isSet())
+                    setItemColor(selectedItem, m_selectedTextColorHoverCached);
+                else if (m_selectedTextColorCached.isSet())
+                    setItemColor(selectedItem, m_selectedTextColorCached);
+            }
         }
 
-        if ((m_hoveredItem >= 0) && (m_selectedItems.find(static_cast<std::size_t>(m_hoveredItem)) == m_selectedItems.end()))
+        if ((m_hoveredItem >= 0) && !m_selectedItems.contains(static_cast<std::size_t>(m_hoveredItem)))
         {
             if (m_textColorHoverCached.isSet())
                 setItemColor(static_cast<std::size_t>(m_hoveredItem), m_textColorHoverCached);
@@ -2185,7 +2591,7 @@ namespace tgui
 
         if (m_hoveredItem >= 0)
         {
-            if ((m_selectedItems.find(static_cast<std::size_t>(m_hoveredItem)) != m_selectedItems.end()) && m_selectedTextColorCached.isSet())
+            if (m_selectedItems.contains(static_cast<std::size_t>(m_hoveredItem)) && m_selectedTextColorCached.isSet())
                 setItemColor(static_cast<std::size_t>(m_hoveredItem), m_selectedTextColorCached);
             else
                 setItemColor(static_cast<std::size_t>(m_hoveredItem), m_textColorCached);
@@ -2202,15 +2608,23 @@ namespace tgui
     {
         if (m_selectedItems.empty() && (item < 0))
             return;
-        if ((m_selectedItems.size() == 1) && (static_cast<int>(*m_selectedItems.begin()) == item))
+        if ((m_selectedItems.size() == 1) && (static_cast<int>(m_selectedItems.front()) == item))
             return;
 
-        for (const auto selectedItem : m_selectedItems)
+        invalidateRenderCache();
+
+        if (!m_dataProvider)
         {
-            if ((static_cast<int>(selectedItem) == m_hoveredItem) && m_textColorHoverCached.isSet())
-                setItemColor(selectedItem, m_textColorHoverCached);
-            else
-                setItemColor(selectedItem, m_textColorCached);
+            for (const auto& range : m_selectedItems.getRanges())
+            {
+                for (std::size_t selectedItem = range.first; selectedItem < range.second; ++selectedItem)
+                {
+                    if ((static_cast<int>(selectedItem) == m_hoveredItem) && m_textColorHoverCached.isSet())
+                        setItemColor(selectedItem, m_textColorHoverCached);
+                    else
+                        setItemColor(selectedItem, m_textColorCached);
+                }
+            }
         }
 
         m_firstSelectedItemIndex = item;
@@ -2218,7 +2632,8 @@ namespace tgui
 
         if (item >= 0)
         {
-            m_selectedItems = {static_cast<std::size_t>(item)};
+            m_selectedItems.clear();
+            m_selectedItems.insert(static_cast<std::size_t>(item));
             onItemSelect.emit(this, item);
         }
         else
@@ -2244,19 +2659,76 @@ namespace tgui
                 m_firstSelectedItemIndex = static_cast<int>(item);
         }
 
-        std::set<std::size_t> selectedItems;
-        const std::size_t rangeStart = std::min(static_cast<std::size_t>(m_firstSelectedItemIndex), item);
-        const std::size_t rangeEnd = std::max(static_cast<std::size_t>(m_firstSelectedItemIndex), item);
-        for (std::size_t i = rangeStart; i <= rangeEnd; ++i)
-            selectedItems.insert(i);
+        IndexRanges selectedItems;
+        if (isSortedOrFiltered())
+        {
+            // Select the items that are displayed between both items
+            const int itemRow = getRowOfItem(item);
+            int firstSelectedItemRow = getRowOfItem(static_cast<std::size_t>(m_firstSelectedItemIndex));
+            if (firstSelectedItemRow < 0)
+                firstSelectedItemRow = itemRow;
 
-        setSelectedItems(selectedItems);
+            const auto rangeStart = static_cast<std::size_t>(std::min(firstSelectedItemRow, itemRow));
+            const auto rangeEnd = static_cast<std::size_t>(std::max(firstSelectedItemRow, itemRow));
+            std::vector<std::size_t> indices(m_displayedItems.begin() + static_cast<std::ptrdiff_t>(rangeStart),
+                                             m_displayedItems.begin() + static_cast<std::ptrdiff_t>(rangeEnd + 1));
+            std::sort(indices.begin(), indices.end());
+            for (const auto index : indices)
+                selectedItems.insert(index);
+        }
+        else
+        {
+            const std::size_t rangeStart = std::min(static_cast<std::size_t>(m_firstSelectedItemIndex), item);
+            const std::size_t rangeEnd = std::max(static_cast<std::size_t>(m_firstSelectedItemIndex), item);
+            selectedItems.insert(rangeStart, rangeEnd + 1);
+        }
+
+        updateSelectedItems(std::move(selectedItems));
 
         m_focusedItemIndex = static_cast<int>(item);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::updateSelectedItems(IndexRanges selectedItems)
+    {
+        if (m_selectedItems == selectedItems)
+            return;
+
+        invalidateRenderCache();
+
+        if (!m_dataProvider)
+        {
+            for (const auto& range : m_selectedItems.getRanges())
+            {
+                for (std::size_t index = range.first; index < range.second; ++index)
+                {
+                    if (!selectedItems.contains(index))
+                        setItemColor(index, m_textColorCached);
+                }
+            }
+        }
+
+        m_selectedItems = std::move(selectedItems);
+        updateSelectedAndhoveredItemColors();
+
+        if (!m_selectedItems.empty())
+        {
+            // Select first selected item arbitrarily (top one is chosen) if the previous value is no longer valid
+            if ((m_firstSelectedItemIndex < 0) || !m_selectedItems.contains(static_cast<std::size_t>(m_firstSelectedItemIndex)))
+                m_firstSelectedItemIndex = static_cast<int>(m_selectedItems.front());
+
+            onItemSelect.emit(this, static_cast<int>(m_selectedItems.front()));
+        }
+        else
+        {
+            m_firstSelectedItemIndex = -1;
+            onItemSelect.emit(this, -1);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ListView::updateLastColumnMaxItemWidth()
     {
         bool updatedLastColumnMaxItemWidth = false;
@@ -2384,7 +2856,7 @@ namespace tgui
 
         if (item < 0)
             return;
-        if (m_selectedItems.find(static_cast<std::size_t>(item)) != m_selectedItems.end())
+        if (m_selectedItems.contains(static_cast<std::size_t>(item)))
             return;
 
         if ((item == m_hoveredItem) && m_textColorHoverCached.isSet())
@@ -2401,7 +2873,7 @@ namespace tgui
 
         updateSelectedAndhoveredItemColors();
 
-        onItemSelect.emit(this, static_cast<int>(*m_selectedItems.begin()));
+        onItemSelect.emit(this, static_cast<int>(m_selectedItems.front()));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2418,7 +2890,7 @@ namespace tgui
         {
             // The selection started from the removed item, just arbitrarily choose a different item (the top one)
             if (!m_selectedItems.empty())
-                m_firstSelectedItemIndex = static_cast<int>(*m_selectedItems.begin());
+                m_firstSelectedItemIndex = static_cast<int>(m_selectedItems.front());
             else
                 m_firstSelectedItemIndex = -1;
         }
@@ -2426,7 +2898,7 @@ namespace tgui
         m_focusedItemIndex = static_cast<int>(item);
 
         if (!m_selectedItems.empty())
-            onItemSelect.emit(this, static_cast<int>(*m_selectedItems.begin()));
+            onItemSelect.emit(this, static_cast<int>(m_selectedItems.front()));
         else
             onItemSelect.emit(this, -1);
     }
@@ -2437,14 +2909,14 @@ namespace tgui
     {
         mousePos.y -= (m_bordersCached.getTop() + m_paddingCached.getTop() + getCurrentHeaderHeight());
 
-        int hoveredItem;
+        int hoveredRow;
         if (m_showHorizontalGridLines && (m_gridLinesWidth > 0))
-            hoveredItem = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight - (m_gridLinesWidth / 2.f)) / (m_itemHeight + m_gridLinesWidth)));
+            hoveredRow = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight - (m_gridLinesWidth / 2.f)) / (m_itemHeight + m_gridLinesWidth)));
         else
-            hoveredItem = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight + 1) / m_itemHeight));
+            hoveredRow = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight + 1) / m_itemHeight));
 
-        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(m_items.size())))
-            updateHoveredItem(hoveredItem);
+        if ((hoveredRow >= 0) && (hoveredRow < static_cast<int>(getDisplayedItemCount())))
+            updateHoveredItem(static_cast<int>(getItemIndexAtRow(static_cast<std::size_t>(hoveredRow))));
         else
             updateHoveredItem(-1);
     }
@@ -2558,8 +3030,253 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ListView::isSortedOrFiltered() const
+    {
+        return !m_dataProvider && (m_sortCompare || m_filter);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::getItemIndexAtRow(std::size_t row) const
+    {
+        if (isSortedOrFiltered())
+            return m_displayedItems[row];
+        else
+            return row;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListView::getRowOfItem(std::size_t index) const
+    {
+        if (!isSortedOrFiltered())
+            return static_cast<int>(index);
+
+        if ((index >= m_itemRows.size()) || (m_itemRows[index] == hiddenRow))
+            return -1;
+
+        return static_cast<int>(m_itemRows[index]);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::sortOrFilterChanged(bool wasSortedOrFiltered)
+    {
+        if (!isSortedOrFiltered())
+        {
+            // Display the items in the order in which they are stored again
+            m_displayedItems.clear();
+            m_itemRows.clear();
+            m_sortFilterTask = nullptr;
+            m_sortFilterTaskNeeded = false;
+            updateHoveredItem(-1);
+            updateVerticalScrollbarMaximum();
+            return;
+        }
+
+        // Keep showing the items in their current order until the background task finishes
+        if (!wasSortedOrFiltered)
+        {
+            m_displayedItems.resize(m_items.size());
+            std::iota(m_displayedItems.begin(), m_displayedItems.end(), std::size_t{0});
+            updateItemRows();
+        }
+
+        startSortFilterTask();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::startSortFilterTask()
+    {
+        m_sortFilterTaskNeeded = false;
+        if (!isSortedOrFiltered())
+            return;
+
+        // The task works on a copy of the texts, so that the items can still be changed while it is running
+        auto task = std::make_shared<SortFilterTask>();
+        task->itemCount = m_items.size();
+        task->compare = m_sortCompare;
+        task->filter = m_filter;
+        if (m_sortCompare)
+        {
+            task->sortKeys.reserve(m_items.size());
+            for (std::size_t i = 0; i < m_items.size(); ++i)
+                task->sortKeys.push_back(getItemCell(i, m_sortColumn));
+        }
+        if (m_filter)
+        {
+            task->rows.reserve(m_items.size());
+            for (std::size_t i = 0; i < m_items.size(); ++i)
+                task->rows.push_back(getItemRow(i));
+        }
+
+        task->thread = std::thread(&SortFilterTask::run, task.get());
+        m_sortFilterTask = std::move(task);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::restartSortFilterTask()
+    {
+        m_sortFilterTask = nullptr;
+        m_sortFilterTaskNeeded = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setDisplayedItems(std::vector<std::size_t> displayedItems)
+    {
+        m_displayedItems = std::move(displayedItems);
+        updateItemRows();
+
+        // The item below the mouse is no longer the same
+        updateHoveredItem(-1);
+
+        if ((m_focusedItemIndex >= 0) && (getRowOfItem(static_cast<std::size_t>(m_focusedItemIndex)) < 0))
+            m_focusedItemIndex = -1;
+
+        // Deselect the items that are hidden by the filter
+        if (m_filter && !m_selectedItems.empty())
+        {
+            IndexRanges selectedItems;
+            for (const auto& range : m_selectedItems.getRanges())
+            {
+                for (std::size_t index = range.first; index < range.second; ++index)
+                {
+                    if (m_itemRows[index] != hiddenRow)
+                        selectedItems.insert(index);
+                }
+            }
+
+            updateSelectedItems(std::move(selectedItems));
+        }
+
+        updateVerticalScrollbarMaximum();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::insertDisplayedItem(std::size_t index)
+    {
+        if (m_filter && !m_filter(getItemRow(index)))
+            return;
+
+        std::vector<std::size_t>::iterator it;
+        if (m_sortCompare)
+        {
+            // Items that compare equal are ordered by their index, just like when they are sorted in the background
+            const String key = getItemCell(index, m_sortColumn);
+            it = std::lower_bound(m_displayedItems.begin(), m_displayedItems.end(), index,
+                [this,&key](std::size_t displayedItem, std::size_t newItem){
+                    const String displayedKey = getItemCell(displayedItem, m_sortColumn);
+                    if (m_sortCompare(displayedKey, key))
+                        return true;
+                    else if (m_sortCompare(key, displayedKey))
+                        return false;
+                    else
+                        return displayedItem < newItem;
+                });
+        }
+        else
+            it = std::lower_bound(m_displayedItems.begin(), m_displayedItems.end(), index);
+
+        m_displayedItems.insert(it, index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::itemsInserted(std::size_t index, std::size_t count)
+    {
+        if (!isSortedOrFiltered() || (count == 0))
+            return;
+
+        for (auto& displayedItem : m_displayedItems)
+        {
+            if (displayedItem >= index)
+                displayedItem += count;
+        }
+
+        // If a new order is already being calculated, or if there are too many new items to place them one by one,
+        // then show the items at the bottom until the background task has placed them at the correct position.
+        if (m_sortFilterTask || m_sortFilterTaskNeeded || (count > maxItemsToInsertDirectly))
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                m_displayedItems.push_back(index + i);
+
+            restartSortFilterTask();
+        }
+        else
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                insertDisplayedItem(index + i);
+        }
+
+        updateItemRows();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::itemRemoved(std::size_t index)
+    {
+        if (!isSortedOrFiltered())
+            return;
+
+        if (m_itemRows[index] != hiddenRow)
+            m_displayedItems.erase(m_displayedItems.begin() + static_cast<std::ptrdiff_t>(m_itemRows[index]));
+
+        for (auto& displayedItem : m_displayedItems)
+        {
+            if (displayedItem > index)
+                --displayedItem;
+        }
+
+        // A running task would return indices that are no longer correct
+        if (m_sortFilterTask)
+            restartSortFilterTask();
+
+        updateItemRows();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::itemChanged(std::size_t index)
+    {
+        invalidateRenderCache();
+
+        if (!isSortedOrFiltered())
+            return;
+
+        // If a new order is being calculated then the item will get its new position once the recalculation is done
+        if (m_sortFilterTask || m_sortFilterTaskNeeded)
+        {
+            restartSortFilterTask();
+            return;
+        }
+
+        if (m_itemRows[index] != hiddenRow)
+            m_displayedItems.erase(m_displayedItems.begin() + static_cast<std::ptrdiff_t>(m_itemRows[index]));
+
+        insertDisplayedItem(index);
+        updateItemRows();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateItemRows()
+    {
+        m_itemRows.assign(m_items.size(), hiddenRow);
+        for (std::size_t row = 0; row < m_displayedItems.size(); ++row)
+            m_itemRows[m_displayedItems[row]] = row;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::updateScrollbars()
     {
+        // Most changes to the list view pass through here, so it can't be drawn from its cache anymore
+        invalidateRenderCache();
+
         const bool verticalScrollbarAtBottom = (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() >= m_verticalScrollbar->getMaximum());
         const Vector2f innerSize = {std::max(0.f, getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight()),
                                     std::max(0.f, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - getCurrentHeaderHeight())};
@@ -2609,9 +3326,10 @@ namespace tgui
     {
         const bool verticalScrollbarAtBottom = (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() >= m_verticalScrollbar->getMaximum());
 
-        unsigned int maximum = static_cast<unsigned int>(m_items.size() * m_itemHeight);
-        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
-            maximum += static_cast<unsigned int>((m_items.size() - 1) * m_gridLinesWidth);
+        const std::size_t itemCount = getDisplayedItemCount();
+        unsigned int maximum = static_cast<unsigned int>(itemCount * m_itemHeight);
+        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (itemCount > 0))
+            maximum += static_cast<unsigned int>((itemCount - 1) * m_gridLinesWidth);
 
         m_verticalScrollbar->setMaximum(maximum);
         updateScrollbars();
@@ -2698,16 +3416,17 @@ namespace tgui
 
             for (std::size_t i = firstItem; i < lastItem; ++i)
             {
-                if (!m_items[i].icon.isSet())
+                const Item& item = getItemForDrawing(getItemIndexAtRow(i));
+                if (!item.icon.isSet())
                 {
                     states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                     continue;
                 }
 
-                const float verticalIconOffset = (m_itemHeight - m_items[i].icon.getSize().y) / 2.f;
+                const float verticalIconOffset = (m_itemHeight - item.icon.getSize().y) / 2.f;
 
                 states.transform.translate({textPadding, verticalIconOffset});
-                target.drawSprite(states, m_items[i].icon);
+                target.drawSprite(states, item.icon);
                 states.transform.translate({-textPadding, static_cast<float>(requiredItemHeight) - verticalIconOffset});
             }
 
@@ -2725,7 +3444,8 @@ namespace tgui
         states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
         for (std::size_t i = firstItem; i < lastItem; ++i)
         {
-            if (column >= m_items[i].texts.size())
+            const Item& item = getItemForDrawing(getItemIndexAtRow(i));
+            if (column >= item.texts.size())
             {
                 states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                 continue;
@@ -2735,12 +3455,12 @@ namespace tgui
             if ((column >= m_columns.size()) || (m_columns[column].alignment == ColumnAlignment::Left))
                 translateX = textPadding;
             else if (m_columns[column].alignment == ColumnAlignment::Center)
-                translateX = (columnWidth - m_items[i].texts[column].getSize().x) / 2.f;
+                translateX = (columnWidth - item.texts[column].getSize().x) / 2.f;
             else // if (m_columns[column].alignment == ColumnAlignment::Right)
-                translateX = columnWidth - textPadding - m_items[i].texts[column].getSize().x;
+                translateX = columnWidth - textPadding - item.texts[column].getSize().x;
 
             states.transform.translate({translateX, verticalTextOffset});
-            target.drawText(states, m_items[i].texts[column]);
+            target.drawText(states, item.texts[column]);
             states.transform.translate({-translateX, static_cast<float>(requiredItemHeight) - verticalTextOffset});
         }
 
@@ -2749,9 +3469,84 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const ListView::Item& ListView::getItemForDrawing(std::size_t index) const
+    {
+        if (!m_dataProvider)
+            return m_items[index];
+
+        const std::size_t columnCount = std::max<std::size_t>(1, m_columns.size());
+
+        CachedItem* cachedItem;
+        const auto it = m_dataProviderCacheLookup.find(index);
+        if ((it != m_dataProviderCacheLookup.end()) && (m_dataProviderCache[it->second].item.texts.size() == columnCount))
+            cachedItem = &m_dataProviderCache[it->second];
+        else
+        {
+            std::size_t cacheIndex;
+            if (it != m_dataProviderCacheLookup.end())
+                cacheIndex = it->second; // The amount of columns changed, reuse the same slot
+            else if (m_dataProviderCache.size() < std::max<std::size_t>(1, m_dataProviderCacheCapacity))
+            {
+                cacheIndex = m_dataProviderCache.size();
+                m_dataProviderCache.emplace_back();
+            }
+            else // The cache is full, replace the item that wasn't drawn for the longest time
+            {
+                cacheIndex = 0;
+                for (std::size_t i = 1; i < m_dataProviderCache.size(); ++i)
+                {
+                    if (m_dataProviderCache[i].lastUsed < m_dataProviderCache[cacheIndex].lastUsed)
+                        cacheIndex = i;
+                }
+
+                m_dataProviderCacheLookup.erase(m_dataProviderCache[cacheIndex].index);
+            }
+
+            m_dataProviderCacheLookup[index] = cacheIndex;
+            cachedItem = &m_dataProviderCache[cacheIndex];
+            cachedItem->index = index;
+
+            // Reuse the Text objects of the replaced item, they already have the correct font and text size
+            Item& item = cachedItem->item;
+            if (item.texts.size() != columnCount)
+                item.texts.resize(columnCount, createText(""));
+            for (std::size_t column = 0; column < columnCount; ++column)
+                item.texts[column].setString(m_dataProvider->getCellText(index, column));
+
+            item.icon.setTexture(m_dataProvider->getIcon(index));
+            if (item.icon.isSet())
+            {
+                item.icon.setSize(calculateIconSize(item.icon.getTexture()));
+                item.icon.setOpacity(m_opacityCached);
+            }
+        }
+
+        cachedItem->lastUsed = ++m_dataProviderCacheUseCounter;
+
+        // The color depends on whether the item is selected or hovered, which may have changed since the texts were created
+        const Color& color = getItemTextColor(index);
+        if (cachedItem->item.texts[0].getColor() != color)
+        {
+            for (auto& text : cachedItem->item.texts)
+                text.setColor(color);
+        }
+
+        return cachedItem->item;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::clearDataProviderCache()
+    {
+        m_dataProviderCache.clear();
+        m_dataProviderCacheLookup.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ListView::updateTime(Duration elapsedTime)
     {
-        const bool screenRefreshRequired = Widget::updateTime(elapsedTime);
+        bool screenRefreshRequired = Widget::updateTime(elapsedTime);
 
         if (m_animationTimeElapsed >= getDoubleClickTime())
         {
@@ -2759,6 +3554,18 @@ namespace tgui
             m_possibleDoubleClick = false;
         }
 
+        // Check if the items were sorted or filtered in the background with an atomic operation
+        if (m_sortFilterTask && m_sortFilterTask->finished)
+        {
+            const auto task = std::move(m_sortFilterTask);
+            setDisplayedItems(task->result);
+            screenRefreshRequired = true;
+        }
+
+        // Items were changed while a previous task was running, so we need to start a new one
+        if (m_sortFilterTaskNeeded && !m_sortFilterTask)
+            startSortFilterTask();
+
         return screenRefreshRequired;
     }
 
@@ -2784,16 +3591,21 @@ namespace tgui
         const unsigned int totalItemHeight = m_itemHeight + (m_showHorizontalGridLines ? m_gridLinesWidth : 0);
 
         // Find out which items are visible
+        const std::size_t itemCount = getDisplayedItemCount();
         std::size_t firstItem = 0;
-        std::size_t lastItem = m_items.size();
+        std::size_t lastItem = itemCount;
         if (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum())
         {
             firstItem = m_verticalScrollbar->getValue() / totalItemHeight;
             lastItem = ((static_cast<std::size_t>(m_verticalScrollbar->getValue()) + m_verticalScrollbar->getViewportSize()) / totalItemHeight) + 1;
-            if (lastItem > m_items.size())
-                lastItem = m_items.size();
+            if (lastItem > itemCount)
+                lastItem = itemCount;
         }
 
+        // Keep enough rows from the data provider in the cache to scroll a page in either direction without recreating them
+        if (m_dataProvider)
+            m_dataProviderCacheCapacity = std::max<std::size_t>(3 * (lastItem - firstItem), 16);
+
         states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop()});
 
         // Draw the scrollbars
@@ -2838,7 +3650,7 @@ namespace tgui
             target.addClippingLayer(states, {{}, {availableWidth, innerHeight - totalHeaderHeight}});
 
             // Draw the horizontal grid lines
-            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
+            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (itemCount > 0))
             {
                 Transform transformBeforeGridLines = states.transform;
 
@@ -2854,28 +3666,33 @@ namespace tgui
                 states.transform = transformBeforeGridLines;
             }
 
-            // Draw the background of the selected item
+            // Draw the background of the selected items that are visible
             if (!m_selectedItems.empty())
             {
-                for(const std::size_t selectedItem : m_selectedItems)
+                for (std::size_t row = firstItem; row < lastItem; ++row)
                 {
-                    states.transform.translate({0, selectedItem * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
+                    const std::size_t selectedItem = getItemIndexAtRow(row);
+                    if (!m_selectedItems.contains(selectedItem))
+                        continue;
+
+                    states.transform.translate({0, row * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
 
                     if ((static_cast<int>(selectedItem) == m_hoveredItem) && m_selectedBackgroundColorHoverCached.isSet())
                         target.drawFilledRect(states, {availableWidth, static_cast<float>(m_itemHeight)}, Color::applyOpacity(m_selectedBackgroundColorHoverCached, m_opacityCached));
                     else
                         target.drawFilledRect(states, {availableWidth, static_cast<float>(m_itemHeight)}, Color::applyOpacity(m_selectedBackgroundColorCached, m_opacityCached));
 
-                    states.transform.translate({0, -static_cast<int>(selectedItem) * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
+                    states.transform.translate({0, -static_cast<int>(row) * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
                 }
             }
 
             // Draw the background of the item on which the mouse is standing
-            if ((m_hoveredItem >= 0) && (m_selectedItems.find(static_cast<std::size_t>(m_hoveredItem)) == m_selectedItems.end()) && m_backgroundColorHoverCached.isSet())
+            const int hoveredRow = (m_hoveredItem >= 0) ? getRowOfItem(static_cast<std::size_t>(m_hoveredItem)) : -1;
+            if ((hoveredRow >= 0) && !m_selectedItems.contains(static_cast<std::size_t>(m_hoveredItem)) && m_backgroundColorHoverCached.isSet())
             {
-                states.transform.translate({0, m_hoveredItem * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
+                states.transform.translate({0, hoveredRow * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
                 target.drawFilledRect(states, {availableWidth, static_cast<float>(m_itemHeight)}, Color::applyOpacity(m_backgroundColorHoverCached, m_opacityCached));
-                states.transform.translate({0, -m_hoveredItem * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
+                states.transform.translate({0, -hoveredRow * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
             }
 
             // We haven't drawn the header yet, so move back up
@@ -2977,6 +3794,129 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::IndexRanges::size() const
+    {
+        std::size_t count = 0;
+        for (const auto& range : m_ranges)
+            count += range.second - range.first;
+
+        return count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::IndexRanges::contains(std::size_t index) const
+    {
+        // Find the last range that starts at or before the index
+        auto it = std::upper_bound(m_ranges.begin(), m_ranges.end(), index,
+            [](std::size_t value, const std::pair<std::size_t, std::size_t>& range){ return value < range.first; });
+        if (it == m_ranges.begin())
+            return false;
+
+        --it;
+        return index < it->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::IndexRanges::insert(std::size_t first, std::size_t end)
+    {
+        if (first >= end)
+            return;
+
+        // Indices are usually added in increasing order, so check if we can simply add a range at the back
+        if (m_ranges.empty() || (first > m_ranges.back().second))
+        {
+            m_ranges.emplace_back(first, end);
+            return;
+        }
+
+        // Find the first range that overlaps with or is adjacent to the new range, or comes after it
+        const auto firstIt = std::lower_bound(m_ranges.begin(), m_ranges.end(), first,
+            [](const std::pair<std::size_t, std::size_t>& range, std::size_t value){ return range.second < value; });
+
+        // Merge all ranges that overlap with or are adjacent to the new range
+        auto lastIt = firstIt;
+        while ((lastIt != m_ranges.end()) && (lastIt->first <= end))
+        {
+            first = std::min(first, lastIt->first);
+            end = std::max(end, lastIt->second);
+            ++lastIt;
+        }
+
+        if (firstIt == lastIt)
+            m_ranges.emplace(firstIt, first, end);
+        else
+        {
+            *firstIt = {first, end};
+            m_ranges.erase(firstIt + 1, lastIt);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::IndexRanges::erase(std::size_t index)
+    {
+        auto it = std::upper_bound(m_ranges.begin(), m_ranges.end(), index,
+            [](std::size_t value, const std::pair<std::size_t, std::size_t>& range){ return value < range.first; });
+        if (it == m_ranges.begin())
+            return;
+
+        --it;
+        if (index >= it->second)
+            return;
+
+        if (index == it->first)
+        {
+            ++it->first;
+            if (it->first == it->second)
+                m_ranges.erase(it);
+        }
+        else if (index + 1 == it->second)
+            --it->second;
+        else // The index lies in the middle of the range, split it in two
+        {
+            const std::size_t end = it->second;
+            it->second = index;
+            m_ranges.emplace(it + 1, index + 1, end);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::IndexRanges::eraseAndShift(std::size_t index)
+    {
+        erase(index);
+
+        const auto firstShiftedIt = std::upper_bound(m_ranges.begin(), m_ranges.end(), index,
+            [](std::size_t value, const std::pair<std::size_t, std::size_t>& range){ return value < range.first; });
+        for (auto it = firstShiftedIt; it != m_ranges.end(); ++it)
+        {
+            --it->first;
+            --it->second;
+        }
+
+        // If the removed index was in the middle of a range then the two halves are now adjacent again
+        if ((firstShiftedIt != m_ranges.begin()) && (firstShiftedIt != m_ranges.end()) && ((firstShiftedIt - 1)->second == firstShiftedIt->first))
+        {
+            (firstShiftedIt - 1)->second = firstShiftedIt->second;
+            m_ranges.erase(firstShiftedIt);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::IndexRanges::eraseFrom(std::size_t index)
+    {
+        while (!m_ranges.empty() && (m_ranges.back().first >= index))
+            m_ranges.pop_back();
+
+        if (!m_ranges.empty() && (m_ranges.back().second > index))
+            m_ranges.back().second = index;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
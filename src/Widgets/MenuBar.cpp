@@ -351,6 +351,7 @@ namespace tgui
     void MenuBar::addMenu(const String& text)
     {
         createMenu(m_menus, text);
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -382,6 +383,7 @@ namespace tgui
             return false;
 
         createMenu(menu->menuItems, hierarchy.back());
+        invalidateRenderCache();
         return true;
     }
 
@@ -397,6 +399,7 @@ namespace tgui
             return false;
 
         menu->text.setString(text);
+        invalidateRenderCache();
         return true;
     }
 
@@ -405,6 +408,7 @@ namespace tgui
     void MenuBar::removeAllMenus()
     {
         m_menus.clear();
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -418,6 +422,7 @@ namespace tgui
 
             closeMenu();
             m_menus.erase(m_menus.begin() + static_cast<std::ptrdiff_t>(i));
+            invalidateRenderCache();
             return true;
         }
 
@@ -439,7 +444,10 @@ namespace tgui
         if (hierarchy.size() < 2)
             return false;
 
-        return removeMenuImpl(hierarchy, removeParentsWhenEmpty, 0, m_menus);
+        // The menu itself could be removed when it becomes empty
+        const bool removed = removeMenuImpl(hierarchy, removeParentsWhenEmpty, 0, m_menus);
+        invalidateRenderCache();
+        return removed;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -473,6 +481,7 @@ namespace tgui
 
             m_menus[i].enabled = enabled;
             updateMenuTextColor(m_menus[i], (m_visibleMenu == static_cast<int>(i)));
+            invalidateRenderCache();
             return true;
         }
 
@@ -598,6 +607,7 @@ namespace tgui
 
         updateMenuTextColor(m_menus[menuIndex], true);
         m_visibleMenu = static_cast<int>(menuIndex);
+        invalidateRenderCache();
 
         if (m_parent)
         {
@@ -619,6 +629,7 @@ namespace tgui
             return;
 
         closeSubMenus(m_menus, m_visibleMenu);
+        invalidateRenderCache();
 
         if (m_menuWidgetPlaceholder->getParent())
             m_menuWidgetPlaceholder->getParent()->remove(m_menuWidgetPlaceholder);
@@ -1610,6 +1621,9 @@ namespace tgui
         Widget{"MenuBarMenuPlaceholder", true},
         m_menuBar{menuBar}
     {
+        // The full size depends on the size of the parent. By giving the placeholder a relative size, it gets notified
+        // when the parent is resized and it can inform the parent (e.g. its spatial index) that its area has changed.
+        setSize({"100%", "100%"});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -214,6 +214,7 @@ namespace tgui
         m_textFront.setString(text);
 
         updateTextSize();
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -421,6 +422,9 @@ namespace tgui
 
     void ProgressBar::recalculateFillSize()
     {
+        // Every change to the value passes through here, so the progress bar can't be drawn from its cache anymore
+        invalidateRenderCache();
+
         Vector2f size;
         if (m_spriteFill.isSet())
         {
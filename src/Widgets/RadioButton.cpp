@@ -98,6 +98,10 @@ namespace tgui
 
         updateTextSize();
         updateTextureSizes();
+
+        // The text and textures only got their new size after the parent was informed about the new widget size
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -163,6 +167,12 @@ namespace tgui
             m_text.setStyle(m_textStyleCheckedCached);
         else
             m_text.setStyle(m_textStyleCached);
+
+        // The text can have a different style (e.g. bold) when checked, which changes the area occupied by the widget
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
+
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -170,6 +180,12 @@ namespace tgui
     void RadioButton::setText(const String& text)
     {
         m_text.setString(text);
+
+        // The text is part of the area that can be clicked
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
+
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -201,6 +217,9 @@ namespace tgui
             m_textSizeCached = Text::findBestTextSize(m_fontCached, getSize().y * 0.8f);
 
         m_text.setCharacterSize(m_textSizeCached);
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/RangeSlider.hpp>
+#include <TGUI/Container.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cmath>
@@ -200,6 +201,10 @@ namespace tgui
         m_thumbs.second.height = m_thumbs.first.height;
 
         updateThumbPositions();
+
+        // The thumb only got its new size after the parent was informed about the new widget size
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -657,6 +662,9 @@ namespace tgui
 
     void RangeSlider::updateThumbPositions()
     {
+        // Every change to the selection passes through here, so the slider can't be drawn from its cache anymore
+        invalidateRenderCache();
+
         const Vector2f innerSize = getInnerSize();
 
         if (m_verticalScroll)
@@ -91,6 +91,9 @@ namespace tgui
 
     void RichTextLabel::rearrangeText()
     {
+        // Every change to the text passes through here, so the label can't be drawn from its cache anymore
+        invalidateRenderCache();
+
         if (m_fontCached == nullptr)
         {
             m_lines.clear();
@@ -441,6 +441,7 @@ namespace tgui
     void ScrollablePanel::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -455,6 +456,7 @@ namespace tgui
     void ScrollablePanel::setHorizontalScrollbarValue(unsigned int value)
     {
         m_horizontalScrollbar->setValue(value);
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -787,6 +789,9 @@ namespace tgui
 
     void ScrollablePanel::updateScrollbars()
     {
+        // Changes to the content size or scrollbar policies pass through here, so the panel can't be drawn from its cache anymore
+        invalidateRenderCache();
+
         const Vector2f scrollbarSpace = {getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
                                          getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()};
 
@@ -194,6 +194,7 @@ namespace tgui
     void Scrollbar::setAutoHide(bool autoHide)
     {
         m_autoHide = autoHide;
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -635,6 +636,9 @@ namespace tgui
 
     void Scrollbar::updateSize()
     {
+        // Every change to the value, maximum or viewport size passes through here, so the scrollbar can't be drawn from its cache anymore
+        invalidateRenderCache();
+
         if (getSize().x < getSize().y)
             m_verticalScroll = true;
         else if (getSize().x > getSize().y)
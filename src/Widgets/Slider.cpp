@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Slider.hpp>
+#include <TGUI/Container.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cmath>
@@ -179,6 +180,10 @@ namespace tgui
         }
 
         updateThumbPosition();
+
+        // The thumb only got its new size after the parent was informed about the new widget size
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -657,6 +662,9 @@ namespace tgui
 
     void Slider::updateThumbPosition()
     {
+        // Every change to the value passes through here, so the slider can't be drawn from its cache anymore
+        invalidateRenderCache();
+
         if (m_verticalScroll)
         {
             m_thumb.left = m_bordersCached.getLeft() + (getInnerSize().x - m_thumb.width) / 2.0f;
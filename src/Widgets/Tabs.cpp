@@ -499,6 +499,9 @@ namespace tgui
 
     void Tabs::recalculateTabsWidth()
     {
+        // Changes to the tabs pass through here, so the tabs can't be drawn from their cache anymore
+        invalidateRenderCache();
+
         std::size_t visibleTabs = 0;
         for (const auto& tab : m_tabs)
         {
@@ -777,6 +780,9 @@ namespace tgui
 
     void Tabs::updateTextColors()
     {
+        // Changes to the selected or enabled tabs pass through here
+        invalidateRenderCache();
+
         for (auto& tab : m_tabs)
         {
             if ((!m_enabled || !tab.enabled) && m_textColorDisabledCached.isSet())
@@ -134,6 +134,8 @@ namespace tgui
         // Don't allow the text to contain carriage returns
         text.replace('\r', U"");
 
+        const std::size_t oldLength = m_text.length();
+
         // Remove all the excess characters when a character limit is set
         if ((m_maxChars > 0) && (text.length() > m_maxChars))
             m_text = text.toUtf32().substr(0, m_maxChars);
@@ -142,6 +144,7 @@ namespace tgui
 
         rearrangeText(false);
 
+        onTextEdit.emit(this, TextEdit{0, oldLength, m_text});
         onTextChange.emit(this, m_text);
     }
 
@@ -149,7 +152,18 @@ namespace tgui
 
     void TextArea::addText(String text)
     {
-        setText(m_text + std::move(text));
+        // Don't allow the text to contain carriage returns
+        text.replace('\r', U"");
+
+        // Remove all the excess characters when a character limit is set
+        if ((m_maxChars > 0) && (m_text.length() + text.length() > m_maxChars))
+            text.erase(m_maxChars - std::min(m_maxChars, m_text.length()));
+
+        // Only the last paragraph has to be word-wrapped again, the caret is placed behind the new text
+        const std::size_t oldLength = m_text.length();
+        replaceTextRange(oldLength, 0, text, oldLength + text.length());
+
+        onTextChange.emit(this, m_text);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -164,6 +178,7 @@ namespace tgui
     void TextArea::setDefaultText(const String& text)
     {
         m_defaultText.setString(text);
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -245,8 +260,7 @@ namespace tgui
         if ((m_maxChars > 0) && (m_text.length() > m_maxChars))
         {
             // Remove all the excess characters
-            m_text.erase(m_maxChars, String::npos);
-            rearrangeText(false);
+            replaceTextRange(m_maxChars, m_text.length() - m_maxChars, U"", m_maxChars);
         }
     }
 
@@ -327,26 +341,13 @@ namespace tgui
         if (charactersBeforeCaret > m_text.length())
             charactersBeforeCaret = m_text.length();
 
-        // Find the line and position on that line on which the caret is located
-        std::size_t count = 0;
-        for (std::size_t i = 0; i < m_lines.size(); ++i)
-        {
-            if (count + m_lines[i].length() < charactersBeforeCaret)
-            {
-                count += m_lines[i].length();
-                if ((count < m_text.length()) && (m_text[count] == U'\n'))
-                    count += 1;
-            }
-            else
-            {
-                m_selStart.y = i;
-                m_selStart.x = charactersBeforeCaret - count;
+        if (m_lines.empty())
+            return;
 
-                m_selEnd = m_selStart;
-                updateSelectionTexts();
-                break;
-            }
-        }
+        // Find the line and position on that line on which the caret is located
+        m_selStart = findSelectionPos(charactersBeforeCaret);
+        m_selEnd = m_selStart;
+        updateSelectionTexts();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -418,6 +419,7 @@ namespace tgui
     void TextArea::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -432,6 +434,7 @@ namespace tgui
     void TextArea::setHorizontalScrollbarValue(unsigned int value)
     {
         m_horizontalScrollbar->setValue(value);
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -735,18 +738,7 @@ namespace tgui
             deleteSelectedCharacters();
 
             const std::size_t caretPosition = getSelectionEnd();
-
-            m_text.insert(caretPosition, 1, key);
-            m_lines[m_selEnd.y].insert(m_selEnd.x, 1, key);
-
-            // Increment the caret position, unless you type a newline at the start of a line while that line only existed due to word wrapping
-            if ((key != U'\n') || (m_selEnd.x > 0) || (m_selEnd.y == 0) || m_lines[m_selEnd.y-1].empty() || (m_text[caretPosition-1] == U'\n'))
-            {
-                m_selStart.x++;
-                m_selEnd.x++;
-            }
-
-            rearrangeText(true);
+            replaceTextRange(caretPosition, 0, String(1, key), caretPosition + 1);
         };
 
         // If there is a scrollbar then inserting can't go wrong
@@ -757,21 +749,36 @@ namespace tgui
         else // There is no scrollbar, the text may not fit
         {
             // Store the data so that it can be reverted
-            const auto oldText = m_text;
             const auto oldSelStart = m_selStart;
             const auto oldSelEnd = m_selEnd;
+            const String oldSelectedText = getSelectedText();
+            const std::size_t insertPosition = std::min(getSelectionStart(), getSelectionEnd());
 
-            // Try to insert the character
+            // Try to insert the character. The edits aren't reported yet, as they might still be undone.
+            const bool textEditSignalEnabled = onTextEdit.isEnabled();
+            onTextEdit.setEnabled(false);
             insert();
 
             // Undo the insert if the text does not fit
-            if (m_lines.size() > static_cast<std::size_t>(getInnerSize().y / m_lineHeight))
+            const bool textFits = (m_lines.size() <= static_cast<std::size_t>(getInnerSize().y / m_lineHeight));
+            if (!textFits)
             {
-                m_text = oldText;
+                replaceTextRange(insertPosition, 1, oldSelectedText, insertPosition);
+
                 m_selStart = oldSelStart;
                 m_selEnd = oldSelEnd;
+                updateSelectionTexts();
+            }
 
-                rearrangeText(true);
+            // Report the same edits as when the character was inserted directly
+            onTextEdit.setEnabled(textEditSignalEnabled);
+            if (textFits)
+            {
+                if (!oldSelectedText.empty())
+                    onTextEdit.emit(this, TextEdit{insertPosition, oldSelectedText.length(), U""});
+
+                const String insertedText(1, key);
+                onTextEdit.emit(this, TextEdit{insertPosition, 0, insertedText});
             }
         }
 
@@ -873,20 +880,33 @@ namespace tgui
 
     std::size_t TextArea::getIndexOfSelectionPos(Vector2<std::size_t> selectionPos) const
     {
-        auto findIndex = [this](std::size_t line)
-        {
-            std::size_t counter = 0;
-            for (std::size_t i = 0; i < line; ++i)
-            {
-                counter += m_lines[i].length();
-                if ((counter < m_text.length()) && (m_text[counter] == U'\n'))
-                    counter += 1;
-            }
+        if (selectionPos.y >= m_linesStartIndex.size())
+            return selectionPos.x;
 
-            return counter;
-        };
+        return m_linesStartIndex[selectionPos.y] + selectionPos.x;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2<std::size_t> TextArea::findSelectionPos(std::size_t index) const
+    {
+        if (m_lines.empty())
+            return {0, 0};
+
+        // Binary search for the first line that ends at or behind the index
+        std::size_t low = 0;
+        std::size_t high = m_lines.size() - 1;
+        while (low < high)
+        {
+            const std::size_t mid = low + (high - low) / 2;
+            if (m_linesStartIndex[mid] + m_lines[mid].length() < index)
+                low = mid + 1;
+            else
+                high = mid;
+        }
 
-        return findIndex(selectionPos.y) + selectionPos.x;
+        const std::size_t lineStart = std::min(m_linesStartIndex[low], index);
+        return {std::min(index - lineStart, m_lines[low].length()), low};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -898,17 +918,9 @@ namespace tgui
             const std::size_t selStart = getSelectionStart();
             const std::size_t selEnd = getSelectionEnd();
             if (selStart <= selEnd)
-            {
-                m_text.erase(selStart, selEnd - selStart);
-                m_selEnd = m_selStart;
-            }
+                replaceTextRange(selStart, selEnd - selStart, U"", selStart);
             else
-            {
-                m_text.erase(selEnd, selStart - selEnd);
-                m_selStart = m_selEnd;
-            }
-
-            rearrangeText(true);
+                replaceTextRange(selEnd, selStart - selEnd, U"", selEnd);
         }
     }
 
@@ -1112,39 +1124,11 @@ namespace tgui
         // Check that we did not select any characters
         if (m_selStart == m_selEnd)
         {
+            // When removing the last character of a line that was placed there by word wrap, the caret ends up
+            // at the end of the line above it, as positions on a word-wrap boundary belong to the upper line.
             const std::size_t pos = getSelectionEnd();
             if (pos > 0)
-            {
-                if (m_selEnd.x > 0)
-                {
-                    // There is a specific case that we have to watch out for. When we are removing the last character on
-                    // a line which was placed there by word wrap and a newline follows this character then the caret
-                    // has to be placed at the line above (before the newline) instead of at the same line (after the newline)
-                    if ((m_lines[m_selEnd.y].length() == 1) && (pos > 1) && (pos < m_text.length()) && (m_text[pos-2] != '\n') && (m_text[pos] == '\n') && (m_selEnd.y > 0))
-                    {
-                        m_selEnd.y--;
-                        m_selEnd.x = m_lines[m_selEnd.y].length();
-                    }
-                    else // Just remove the character normally
-                        --m_selEnd.x;
-                }
-                else // At the beginning of the line
-                {
-                    if (m_selEnd.y > 0)
-                    {
-                        --m_selEnd.y;
-                        m_selEnd.x = m_lines[m_selEnd.y].length();
-
-                        if ((m_text[pos-1] != '\n') && m_selEnd.x > 0)
-                            --m_selEnd.x;
-                    }
-                }
-
-                m_selStart = m_selEnd;
-
-                m_text.erase(pos - 1, 1);
-                rearrangeText(true);
-            }
+                replaceTextRange(pos - 1, 1, U"", pos - 1);
         }
         else // When you did select some characters then delete them
             deleteSelectedCharacters();
@@ -1166,8 +1150,9 @@ namespace tgui
         // Check that we did not select any characters
         if (m_selStart == m_selEnd)
         {
-            m_text.erase(getSelectionEnd(), 1);
-            rearrangeText(true);
+            const std::size_t pos = getSelectionEnd();
+            if (pos < m_text.length())
+                replaceTextRange(pos, 1, U"", pos);
         }
         else // You did select some characters, so remove them
             deleteSelectedCharacters();
@@ -1214,12 +1199,8 @@ namespace tgui
         {
             deleteSelectedCharacters();
 
-            m_text.insert(getSelectionEnd(), clipboardContents);
-            m_lines[m_selEnd.y].insert(m_selEnd.x, clipboardContents);
-
-            m_selEnd.x += clipboardContents.length();
-            m_selStart = m_selEnd;
-            rearrangeText(true);
+            const std::size_t caretPosition = getSelectionEnd();
+            replaceTextRange(caretPosition, 0, clipboardContents, caretPosition + clipboardContents.length());
 
             onTextChange.emit(this, m_text);
         }
@@ -1236,129 +1217,223 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextArea::replaceTextRange(std::size_t offset, std::size_t removedCount, const String& insertedText, std::size_t caretIndex)
+    {
+        TGUI_ASSERT(offset + removedCount <= m_text.length(), "Range passed to TextArea::replaceTextRange can't extend past the end of the text");
+
+        const float maxLineWidth = (m_horizontalScrollbarPolicy == Scrollbar::Policy::Never) ? getWordWrapWidth() : 0;
+
+        // The lines can't be updated when there is no font yet or when there is no room for the text
+        if ((m_lineHeight == 0) || (m_fontCached == nullptr) || m_lines.empty()
+         || ((m_horizontalScrollbarPolicy == Scrollbar::Policy::Never) && (maxLineWidth <= 0)))
+        {
+            m_text.erase(offset, removedCount);
+            m_text.insert(offset, insertedText);
+            rearrangeText(false);
+        }
+        else
+        {
+            // Find the lines that belong to the paragraphs that are touched by the change
+            std::size_t firstLine = findSelectionPos(offset).y;
+            while ((firstLine > 0) && (m_text[m_linesStartIndex[firstLine] - 1] != U'\n'))
+                --firstLine;
+
+            std::size_t lastLine = findSelectionPos(offset + removedCount).y;
+            while ((lastLine + 1 < m_lines.size()) && (m_linesStartIndex[lastLine + 1] == m_linesStartIndex[lastLine] + m_lines[lastLine].length()))
+                ++lastLine;
+
+            // If the longest line is removed then we may have to search for the new longest line
+            float removedLinesWidth = 0;
+            if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
+            {
+                for (std::size_t i = firstLine; i <= lastLine; ++i)
+                    removedLinesWidth = std::max(removedLinesWidth, Text::getLineWidth(m_lines[i], m_fontCached, m_textSizeCached));
+            }
+
+            const std::size_t paragraphsStart = m_linesStartIndex[firstLine];
+            const std::size_t paragraphsEnd = m_linesStartIndex[lastLine] + m_lines[lastLine].length() - removedCount + insertedText.length();
+
+            m_text.erase(offset, removedCount);
+            m_text.insert(offset, insertedText);
+
+            std::vector<String> newLines;
+            std::vector<std::size_t> newLinesStartIndex;
+            splitTextIntoLines(paragraphsStart, paragraphsEnd, maxLineWidth, newLines, newLinesStartIndex);
+
+            float newLinesWidth = 0;
+            if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
+            {
+                for (const auto& line : newLines)
+                    newLinesWidth = std::max(newLinesWidth, Text::getLineWidth(line, m_fontCached, m_textSizeCached));
+            }
+
+            // Replace the old lines and shift the start index of all lines behind them
+            const std::size_t newLineCount = newLines.size();
+            m_lines.erase(m_lines.begin() + static_cast<std::ptrdiff_t>(firstLine), m_lines.begin() + static_cast<std::ptrdiff_t>(lastLine + 1));
+            m_lines.insert(m_lines.begin() + static_cast<std::ptrdiff_t>(firstLine), std::make_move_iterator(newLines.begin()), std::make_move_iterator(newLines.end()));
+
+            m_linesStartIndex.erase(m_linesStartIndex.begin() + static_cast<std::ptrdiff_t>(firstLine), m_linesStartIndex.begin() + static_cast<std::ptrdiff_t>(lastLine + 1));
+            m_linesStartIndex.insert(m_linesStartIndex.begin() + static_cast<std::ptrdiff_t>(firstLine), newLinesStartIndex.begin(), newLinesStartIndex.end());
+            for (std::size_t i = firstLine + newLineCount; i < m_linesStartIndex.size(); ++i)
+                m_linesStartIndex[i] = m_linesStartIndex[i] - removedCount + insertedText.length();
+
+            if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
+            {
+                if (newLinesWidth >= m_maxLineWidth)
+                    m_maxLineWidth = newLinesWidth;
+                else if (removedLinesWidth >= m_maxLineWidth)
+                    recalculateMaxLineWidth();
+            }
+
+            m_selStart = findSelectionPos(std::min(caretIndex, m_text.length()));
+            m_selEnd = m_selStart;
+
+            updateTextLayout();
+        }
+
+        if ((removedCount > 0) || !insertedText.empty())
+            onTextEdit.emit(this, TextEdit{offset, removedCount, insertedText});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextArea::rearrangeText(bool keepSelection)
     {
         // Don't continue when line height is 0 or when there is no font yet
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
             return;
 
-        String string;
-        if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
-            string = m_text;
-        else
+        float maxLineWidth = 0;
+        if (m_horizontalScrollbarPolicy == Scrollbar::Policy::Never)
         {
-            // Find the maximum width of one line
-            const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
-            float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
-            if (m_verticalScrollbar->isShown())
-                maxLineWidth -= m_verticalScrollbar->getSize().x;
+            maxLineWidth = getWordWrapWidth();
 
             // Don't do anything when there is no room for the text
             if (maxLineWidth <= 0)
                 return;
-
-            string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSizeCached, false);
         }
 
         // Store the current selection position when we are keeping the selection
         const std::size_t selStart = keepSelection ? getSelectionStart() : 0;
         const std::size_t selEnd = keepSelection ? getSelectionEnd() : 0;
 
-        // Split the string in multiple lines
-        m_maxLineWidth = 0;
+        // Split the text in multiple lines
         m_lines.clear();
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        std::size_t longestLineCharCount = 0;
-        std::size_t longestLineIndex = 0;
-        while (newLinePos != String::npos)
+        m_linesStartIndex.clear();
+        splitTextIntoLines(0, m_text.length(), maxLineWidth, m_lines, m_linesStartIndex);
+        recalculateMaxLineWidth();
+
+        // Keep the selection when possible, otherwise set the caret at the back of the text
+        if (keepSelection && (selStart <= m_text.length()) && (selEnd <= m_text.length()))
         {
-            newLinePos = string.find('\n', searchPosStart);
+            m_selStart = findSelectionPos(selStart);
+            m_selEnd = findSelectionPos(selEnd);
+        }
+        else
+        {
+            m_selStart = Vector2<std::size_t>(m_lines[m_lines.size()-1].length(), m_lines.size()-1);
+            m_selEnd = m_selStart;
+        }
 
-            if (newLinePos != String::npos)
-                m_lines.push_back(string.substr(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.push_back(string.substr(searchPosStart));
+        updateTextLayout();
+    }
 
-            if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
-            {
-                if (m_monospacedFontOptimizationEnabled)
-                {
-                    if (m_lines.back().length() > longestLineCharCount)
-                    {
-                        longestLineCharCount = m_lines.back().length();
-                        longestLineIndex = m_lines.size() - 1;
-                    }
-                }
-                else // Not using optimization for monospaced font, so really calculate the width of every line
-                {
-                    float lineWidth = Text::getLineWidth(m_lines.back(), m_fontCached, m_textSizeCached);
-                    if (lineWidth > m_maxLineWidth)
-                        m_maxLineWidth = lineWidth;
-                }
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            searchPosStart = newLinePos + 1;
-        }
+    float TextArea::getWordWrapWidth() const
+    {
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
+        float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
+        if (m_verticalScrollbar->isShown())
+            maxLineWidth -= m_verticalScrollbar->getSize().x;
 
-        if ((m_horizontalScrollbarPolicy != Scrollbar::Policy::Never) && m_monospacedFontOptimizationEnabled)
-            m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSizeCached);
+        return maxLineWidth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Check if we should try to keep our selection
-        if (keepSelection)
+    void TextArea::splitTextIntoLines(std::size_t startIndex, std::size_t endIndex, float maxLineWidth,
+                                      std::vector<String>& lines, std::vector<std::size_t>& linesStartIndex) const
+    {
+        // Word wrap is applied to each paragraph separately, so that an edit only requires the paragraphs it touched to be processed
+        std::size_t paragraphStart = startIndex;
+        while (true)
         {
-            std::size_t index = 0;
-            Vector2<std::size_t> newSelStart;
-            Vector2<std::size_t> newSelEnd;
-            bool newSelStartFound = false;
-            bool newSelEndFound = false;
+            std::size_t paragraphEnd = m_text.find('\n', paragraphStart);
+            if ((paragraphEnd == String::npos) || (paragraphEnd > endIndex))
+                paragraphEnd = endIndex;
 
-            // Look for the new locations of our selection
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
+            const String paragraph = m_text.substr(paragraphStart, paragraphEnd - paragraphStart);
+            if ((maxLineWidth > 0) && !paragraph.empty())
             {
-                index += m_lines[i].length();
+                const String wrappedParagraph = Text::wordWrap(maxLineWidth, paragraph, m_fontCached, m_textSizeCached, false);
 
-                if (!newSelStartFound && (index >= selStart))
+                // The newlines in the word-wrapped string don't exist in the text itself
+                std::size_t lineStart = paragraphStart;
+                std::size_t searchPosStart = 0;
+                std::size_t newLinePos = 0;
+                while (newLinePos != String::npos)
                 {
-                    newSelStart = Vector2<std::size_t>(m_lines[i].length() - (index - selStart), i);
+                    newLinePos = wrappedParagraph.find('\n', searchPosStart);
 
-                    newSelStartFound = true;
-                    if (newSelEndFound)
-                        break;
-                }
-
-                if (!newSelEndFound && (index >= selEnd))
-                {
-                    newSelEnd = Vector2<std::size_t>(m_lines[i].length() - (index - selEnd), i);
+                    if (newLinePos != String::npos)
+                        lines.push_back(wrappedParagraph.substr(searchPosStart, newLinePos - searchPosStart));
+                    else
+                        lines.push_back(wrappedParagraph.substr(searchPosStart));
 
-                    newSelEndFound = true;
-                    if (newSelStartFound)
-                        break;
+                    linesStartIndex.push_back(lineStart);
+                    lineStart += lines.back().length();
+                    searchPosStart = newLinePos + 1;
                 }
-
-                // Skip newlines in the text
-                if (m_text[index] == U'\n')
-                    ++index;
             }
-
-            // Keep the selection when possible
-            if (newSelStartFound && newSelEndFound)
+            else
             {
-                m_selStart = newSelStart;
-                m_selEnd = newSelEnd;
+                lines.push_back(paragraph);
+                linesStartIndex.push_back(paragraphStart);
             }
-            else // The text has changed too much, the selection can't be kept
+
+            if (paragraphEnd >= endIndex)
+                break;
+
+            paragraphStart = paragraphEnd + 1;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::recalculateMaxLineWidth()
+    {
+        m_maxLineWidth = 0;
+        if (m_horizontalScrollbarPolicy == Scrollbar::Policy::Never)
+            return;
+
+        if (m_monospacedFontOptimizationEnabled)
+        {
+            std::size_t longestLineCharCount = 0;
+            std::size_t longestLineIndex = 0;
+            for (std::size_t i = 0; i < m_lines.size(); ++i)
             {
-                m_selStart = Vector2<std::size_t>(m_lines[m_lines.size()-1].length(), m_lines.size()-1);
-                m_selEnd = m_selStart;
+                if (m_lines[i].length() > longestLineCharCount)
+                {
+                    longestLineCharCount = m_lines[i].length();
+                    longestLineIndex = i;
+                }
             }
+
+            if (!m_lines.empty())
+                m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSizeCached);
         }
-        else // Set the caret at the back of the text
+        else // Not using optimization for monospaced font, so really calculate the width of every line
         {
-            m_selStart = Vector2<std::size_t>(m_lines[m_lines.size()-1].length(), m_lines.size()-1);
-            m_selEnd = m_selStart;
+            for (const auto& line : m_lines)
+                m_maxLineWidth = std::max(m_maxLineWidth, Text::getLineWidth(line, m_fontCached, m_textSizeCached));
         }
+    }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::updateTextLayout()
+    {
         updateScrollbars();
 
         // Tell the scrollbars how many pixels the text contains
@@ -1423,70 +1498,8 @@ namespace tgui
 
     void TextArea::updateSelectionTexts()
     {
-        // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
-        {
-            String displayedText;
-            for (const auto& line : m_lines)
-                displayedText += line + U"\n";
-
-            m_textBeforeSelection.setString(displayedText);
-            m_textSelection1.setString(U"");
-            m_textSelection2.setString(U"");
-            m_textAfterSelection1.setString(U"");
-            m_textAfterSelection2.setString(U"");
-        }
-        else // Some text is selected
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            // Set the text before the selection
-            if (selectionStart.y > 0)
-            {
-                String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
-                    string += m_lines[i] + U"\n";
-
-                string += m_lines[selectionStart.y].substr(0, selectionStart.x);
-                m_textBeforeSelection.setString(string);
-            }
-            else
-                m_textBeforeSelection.setString(m_lines[0].substr(0, selectionStart.x));
-
-            // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, selectionEnd.x - selectionStart.x));
-                m_textSelection2.setString(U"");
-            }
-            else
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, m_lines[selectionStart.y].length() - selectionStart.x));
-
-                String string;
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                    string += m_lines[i] + U"\n";
-
-                string += m_lines[selectionEnd.y].substr(0, selectionEnd.x);
-
-                m_textSelection2.setString(string);
-            }
-
-            // Set the text after the selection
-            {
-                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substr(selectionEnd.x, m_lines[selectionEnd.y].length() - selectionEnd.x));
-
-                String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
-                    string += m_lines[i] + U"\n";
-
-                m_textAfterSelection2.setString(string);
-            }
-        }
+        // All changes to the text or selection pass through here, so the text area can't be drawn from its cache anymore
+        invalidateRenderCache();
 
         // Check if the caret is located above or below the view
         if (m_verticalScrollbarPolicy != Scrollbar::Policy::Never)
@@ -1585,17 +1598,41 @@ namespace tgui
 
     void TextArea::recalculatePositions()
     {
-        if (!m_fontCached)
+        if ((m_lineHeight == 0) || !m_fontCached)
             return;
 
+        // Only the lines near the visible area are placed in the text objects
+        const std::size_t topLine = m_verticalScrollbar->isShown() ? static_cast<std::size_t>(m_verticalScrollbar->getValue() / m_lineHeight) : 0;
+        const std::size_t linesPerPage = static_cast<std::size_t>(getInnerSize().y / m_lineHeight) + 2;
+        m_displayedLinesStart = (topLine > linesPerPage) ? (topLine - linesPerPage) : 0;
+        m_displayedLinesEnd = std::min(m_lines.size(), topLine + 2 * linesPerPage);
+
+        const auto isLineDisplayed = [this](std::size_t line){ return (line >= m_displayedLinesStart) && (line < m_displayedLinesEnd); };
+        const auto joinDisplayedLines = [this](std::size_t begin, std::size_t end)
+            {
+                String string;
+                for (std::size_t i = std::max(begin, m_displayedLinesStart); i < std::min(end, m_displayedLinesEnd); ++i)
+                    string += m_lines[i] + U"\n";
+                return string;
+            };
+
         const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
 
         // Calculate the position of the text objects
         m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({textOffset, 0});
+        m_textBeforeSelection.setPosition({textOffset, static_cast<float>(m_displayedLinesStart) * m_lineHeight});
         m_defaultText.setPosition({ textOffset, 0 });
 
-        if (m_selStart != m_selEnd)
+        // If there is no selection then just put the whole text in m_textBeforeSelection
+        if (m_selStart == m_selEnd)
+        {
+            m_textBeforeSelection.setString(joinDisplayedLines(0, m_lines.size()));
+            m_textSelection1.setString(U"");
+            m_textSelection2.setString(U"");
+            m_textAfterSelection1.setString(U"");
+            m_textAfterSelection2.setString(U"");
+        }
+        else // Some text is selected, split the text in five pieces so that it can be easily drawn
         {
             auto selectionStart = m_selStart;
             auto selectionEnd = m_selEnd;
@@ -1603,6 +1640,42 @@ namespace tgui
             if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
                 std::swap(selectionStart, selectionEnd);
 
+            // Set the text before the selection
+            {
+                String string = joinDisplayedLines(0, selectionStart.y);
+                if (isLineDisplayed(selectionStart.y))
+                    string += m_lines[selectionStart.y].substr(0, selectionStart.x);
+
+                m_textBeforeSelection.setString(string);
+            }
+
+            // Set the selected text
+            if (!isLineDisplayed(selectionStart.y))
+                m_textSelection1.setString(U"");
+            else if (selectionStart.y == selectionEnd.y)
+                m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, selectionEnd.x - selectionStart.x));
+            else
+                m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, m_lines[selectionStart.y].length() - selectionStart.x));
+
+            if (selectionStart.y == selectionEnd.y)
+                m_textSelection2.setString(U"");
+            else
+            {
+                String string = joinDisplayedLines(selectionStart.y + 1, selectionEnd.y);
+                if (isLineDisplayed(selectionEnd.y))
+                    string += m_lines[selectionEnd.y].substr(0, selectionEnd.x);
+
+                m_textSelection2.setString(string);
+            }
+
+            // Set the text after the selection
+            if (isLineDisplayed(selectionEnd.y))
+                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substr(selectionEnd.x, m_lines[selectionEnd.y].length() - selectionEnd.x));
+            else
+                m_textAfterSelection1.setString(U"");
+
+            m_textAfterSelection2.setString(joinDisplayedLines(selectionEnd.y + 1, m_lines.size()));
+
             float kerningSelectionStart = 0;
             if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].length()))
                 kerningSelectionStart = m_fontCached.getKerning(m_lines[selectionStart.y][selectionStart.x-1], m_lines[selectionStart.y][selectionStart.x], m_textSizeCached, false);
@@ -1614,45 +1687,52 @@ namespace tgui
             if (selectionStart.x > 0)
             {
                 m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().length()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
+                                              static_cast<float>(selectionStart.y) * m_lineHeight});
             }
             else
-                m_textSelection1.setPosition({textOffset, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
+                m_textSelection1.setPosition({textOffset, static_cast<float>(selectionStart.y) * m_lineHeight});
 
-            m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
+            m_textSelection2.setPosition({textOffset, static_cast<float>(std::max(selectionStart.y + 1, m_displayedLinesStart)) * m_lineHeight});
 
-            if (!m_textSelection2.getString().empty() || (selectionEnd.x == 0))
+            if (selectionStart.y != selectionEnd.y)
             {
                 m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().length()).x + kerningSelectionEnd,
-                                                   m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
+                                                   static_cast<float>(selectionEnd.y) * m_lineHeight});
             }
             else
                 m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x + kerningSelectionEnd,
                                                    m_textSelection1.getPosition().y});
 
-            m_textAfterSelection2.setPosition({textOffset, static_cast<float>(selectionEnd.y + 1) * m_lineHeight});
+            m_textAfterSelection2.setPosition({textOffset, static_cast<float>(std::max(selectionEnd.y + 1, m_displayedLinesStart)) * m_lineHeight});
 
-            // Recalculate the selection rectangles
+            // Recalculate the selection rectangles of the displayed lines
+            /// TODO: Implement a way to calculate text size without creating a text object?
+            Text tempText;
+            tempText.setFont(m_fontCached);
+            tempText.setCharacterSize(getTextSize());
+            for (std::size_t i = std::max(selectionStart.y, m_displayedLinesStart); (i <= selectionEnd.y) && (i < m_displayedLinesEnd); ++i)
             {
-                m_selectionRects.emplace_back(m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y) * m_lineHeight, 0.f, m_lineHeight);
-
-                if (!m_lines[selectionStart.y].empty())
+                if (i == selectionStart.y)
                 {
-                    m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x;
+                    m_selectionRects.emplace_back(m_textSelection1.getPosition().x, static_cast<float>(i) * m_lineHeight, 0.f, m_lineHeight);
 
-                    // There is kerning when the selection is on just this line
-                    if (selectionStart.y == selectionEnd.y)
-                        m_selectionRects.back().width += kerningSelectionEnd;
-                }
+                    if (!m_lines[i].empty())
+                    {
+                        m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x;
 
-                /// TODO: Implement a way to calculate text size without creating a text object?
-                Text tempText;
-                tempText.setFont(m_fontCached);
-                tempText.setCharacterSize(getTextSize());
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
+                        // There is kerning when the selection is on just this line
+                        if (selectionStart.y == selectionEnd.y)
+                            m_selectionRects.back().width += kerningSelectionEnd;
+                    }
+                }
+                else if (i == selectionEnd.y)
                 {
-                    m_selectionRects.back().width += textOffset;
-                    m_selectionRects.emplace_back(m_textSelection2.getPosition().x - textOffset, static_cast<float>(i) * m_lineHeight, textOffset, m_lineHeight);
+                    m_selectionRects.emplace_back(0.f, static_cast<float>(i) * m_lineHeight,
+                                                  textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().length()).x + kerningSelectionEnd, m_lineHeight);
+                }
+                else
+                {
+                    m_selectionRects.emplace_back(0.f, static_cast<float>(i) * m_lineHeight, textOffset, m_lineHeight);
 
                     if (!m_lines[i].empty())
                     {
@@ -1661,19 +1741,9 @@ namespace tgui
                     }
                 }
 
-                if (selectionStart.y != selectionEnd.y)
-                {
+                // The selection continues on the next line
+                if (i != selectionEnd.y)
                     m_selectionRects.back().width += textOffset;
-
-                    if (m_textSelection2.getString() != U"")
-                    {
-                        tempText.setString(m_lines[selectionEnd.y].substr(0, selectionEnd.x));
-                        m_selectionRects.emplace_back(m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y) * m_lineHeight,
-                                                      textOffset + tempText.findCharacterPos(tempText.getString().length()).x + kerningSelectionEnd, m_lineHeight);
-                    }
-                    else
-                        m_selectionRects.emplace_back(0.f, static_cast<float>(selectionEnd.y) * m_lineHeight, textOffset, m_lineHeight);
-                }
             }
         }
 
@@ -1713,6 +1783,10 @@ namespace tgui
             m_topLine = 0;
             m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - horiScrollOffset) / m_lineHeight), m_lines.size());
         }
+
+        // The text objects have to be updated when scrolling to lines that they don't contain
+        if ((m_topLine < m_displayedLinesStart) || (std::min(m_topLine + m_visibleLines, m_lines.size()) > m_displayedLinesEnd))
+            recalculatePositions();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1723,6 +1797,8 @@ namespace tgui
             return onTextChange;
         else if (signalName == onSelectionChange.getName())
             return onSelectionChange;
+        else if (signalName == onTextEdit.getName())
+            return onTextEdit;
         else
             return Widget::getSignal(std::move(signalName));
     }
@@ -73,6 +73,7 @@ namespace tgui
 
         m_down = down;
         updateState();
+        invalidateRenderCache();
 
         onToggle.emit(this, m_down);
     }
@@ -624,6 +624,7 @@ namespace tgui
     void TreeView::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -638,6 +639,7 @@ namespace tgui
     void TreeView::setHorizontalScrollbarValue(unsigned int value)
     {
         m_horizontalScrollbar->setValue(value);
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1220,6 +1222,9 @@ namespace tgui
 
     void TreeView::markNodesDirty()
     {
+        // All changes to the nodes pass through here, so the tree view can't be drawn from its cache anymore
+        invalidateRenderCache();
+
         Node* selectedNode = nullptr;
         if (m_selectedItem >= 0 && static_cast<std::size_t>(m_selectedItem) < m_visibleNodes.size())
             selectedNode = m_visibleNodes[static_cast<std::size_t>(m_selectedItem)].get();
@@ -1542,6 +1547,8 @@ namespace tgui
         if (m_hoveredItem == item)
             return;
 
+        invalidateRenderCache();
+
         if (m_hoveredItem >= 0)
         {
             if ((m_selectedItem == m_hoveredItem) && m_selectedTextColorCached.isSet())
@@ -1561,6 +1568,8 @@ namespace tgui
         if (m_selectedItem == item)
             return;
 
+        invalidateRenderCache();
+
         if (m_selectedItem >= 0)
         {
             if ((m_selectedItem == m_hoveredItem) && m_textColorHoverCached.isSet())
@@ -1346,4 +1346,88 @@ TEST_CASE("[Backend events]")
         }
     }
 #endif
+
+    SECTION("Event coalescing")
+    {
+        GuiNull gui;
+        REQUIRE(!gui.isEventCoalescingEnabled());
+        gui.setEventCoalescingEnabled(true);
+        REQUIRE(gui.isEventCoalescingEnabled());
+
+        auto clickable = tgui::ClickableWidget::create({100, 100});
+        gui.add(clickable);
+
+        tgui::Vector2f pressPos;
+        std::vector<tgui::Vector2f> pressMoves;
+        clickable->onMousePress([&](tgui::Vector2f pos){
+            pressPos = pos;
+            pressMoves = gui.getCoalescedMousePositions();
+        });
+
+        tgui::Event event;
+        event.type = tgui::Event::Type::MouseMoved;
+        for (int i = 1; i <= 5; ++i)
+        {
+            event.mouseMove.x = 10 * i;
+            event.mouseMove.y = 5 * i;
+            REQUIRE(!gui.handleEvent(event));
+        }
+
+        REQUIRE(gui.getEventStatistics().eventsReceived == 5);
+        REQUIRE(gui.getEventStatistics().eventsDispatched == 0);
+        REQUIRE(!clickable->isMouseDown());
+
+        // The mouse press is handled after the merged mouse move, at the last position
+        event.type = tgui::Event::Type::MouseButtonPressed;
+        event.mouseButton.button = tgui::Event::MouseButton::Left;
+        event.mouseButton.x = 50;
+        event.mouseButton.y = 25;
+        REQUIRE(gui.handleEvent(event));
+        REQUIRE(pressPos == tgui::Vector2f(50, 25));
+        REQUIRE(gui.getEventStatistics().eventsReceived == 6);
+        REQUIRE(gui.getEventStatistics().eventsDispatched == 2);
+
+        // All intermediate mouse positions are still available
+        REQUIRE(pressMoves.size() == 5);
+        REQUIRE(pressMoves.front() == tgui::Vector2f(10, 5));
+        REQUIRE(pressMoves.back() == tgui::Vector2f(50, 25));
+
+        event.type = tgui::Event::Type::MouseButtonReleased;
+        gui.handleEvent(event);
+
+        // Wheel events at the same position are added together
+        auto slider = tgui::Slider::create(0, 20);
+        slider->setPosition({0, 150});
+        slider->setSize({200, 20});
+        gui.add(slider);
+
+        event.type = tgui::Event::Type::MouseMoved;
+        event.mouseMove.x = 100;
+        event.mouseMove.y = 160;
+        gui.handleEvent(event);
+
+        gui.resetEventStatistics();
+        event.type = tgui::Event::Type::MouseWheelScrolled;
+        event.mouseWheel.x = 100;
+        event.mouseWheel.y = 160;
+        event.mouseWheel.delta = 4;
+        gui.handleEvent(event);
+        event.mouseWheel.delta = -1;
+        gui.handleEvent(event);
+        gui.handleEvent(event);
+        REQUIRE(gui.getEventStatistics().eventsReceived == 3);
+        REQUIRE(gui.getEventStatistics().eventsDispatched == 1); // The mouse move was handled before the first wheel event
+
+        REQUIRE(gui.handlePendingEvents());
+        REQUIRE(!gui.handlePendingEvents());
+        REQUIRE(gui.getEventStatistics().eventsDispatched == 2);
+        REQUIRE(slider->getValue() == 2);
+
+        // Disabling coalescing handles the event that is being held back
+        event.type = tgui::Event::Type::MouseMoved;
+        gui.handleEvent(event);
+        gui.setEventCoalescingEnabled(false);
+        REQUIRE(gui.getEventStatistics().eventsDispatched == 3);
+        REQUIRE(gui.getCoalescedMousePositions().size() == 1);
+    }
 }
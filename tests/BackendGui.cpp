@@ -0,0 +1,315 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Config.hpp>
+
+#if TGUI_HAS_WINDOW_BACKEND_SDL
+    #include <TGUI/extlibs/IncludeSDL.hpp>
+#endif
+#if TGUI_HAS_WINDOW_BACKEND_GLFW
+    #define GLFW_INCLUDE_NONE
+    #include <GLFW/glfw3.h>
+#endif
+
+#include "Tests.hpp"
+
+#if TGUI_BUILD_AS_CXX_MODULE
+    #if TGUI_HAS_WINDOW_BACKEND_SDL
+        import tgui.backend.window.sdl;
+    #endif
+    #if TGUI_HAS_WINDOW_BACKEND_GLFW
+        import tgui.backend.window.glfw;
+    #endif
+#else
+    #if TGUI_HAS_WINDOW_BACKEND_SDL
+        #include <TGUI/Backend/Window/SDL/BackendGuiSDL.hpp>
+    #endif
+    #if TGUI_HAS_WINDOW_BACKEND_GLFW
+        #include <TGUI/Backend/Window/GLFW/BackendGuiGLFW.hpp>
+    #endif
+#endif
+
+#include <chrono>
+#include <ctime>
+#include <thread>
+
+// Exposes the functions that the main loop uses to wait for events
+class WaitingGui : public GuiNull
+{
+public:
+    using GuiNull::waitForPostedTasks;
+    using GuiNull::getIdleWaitTime;
+};
+
+namespace
+{
+    struct MainLoopRun
+    {
+        tgui::BackendGui::MainLoopStatistics statistics;
+        std::chrono::steady_clock::duration elapsedTime;
+        double cpuTimeSeconds = 0;
+    };
+
+    // Runs the main loop of a real window backend until closeWindow is called by a timer or task that was set up by startFunc.
+    // Afterwards reopenWindow is called, so that the main loop can be run again.
+    template <typename ReopenFunc, typename StartFunc>
+    MainLoopRun runMainLoop(tgui::BackendGui& gui, const ReopenFunc& reopenWindow, const StartFunc& startFunc)
+    {
+        gui.resetMainLoopStatistics();
+
+        // Timers would otherwise also count the time that passed since the gui was last updated by an earlier test
+        gui.updateTime();
+
+        const std::clock_t cpuStartTime = std::clock();
+        const auto startTime = std::chrono::steady_clock::now();
+        startFunc();
+        gui.mainLoop();
+
+        MainLoopRun run;
+        run.elapsedTime = std::chrono::steady_clock::now() - startTime;
+        run.cpuTimeSeconds = static_cast<double>(std::clock() - cpuStartTime) / CLOCKS_PER_SEC;
+        run.statistics = gui.getMainLoopStatistics();
+        reopenWindow();
+
+        // The main loop no longer updates the time while drawing, which the other tests rely on
+        gui.setDrawingUpdatesTime(true);
+        gui.setMaxIdleWaitTime(std::chrono::milliseconds(50));
+        return run;
+    }
+
+    // The sendInput function is called from another thread and has to pass an input event to the gui in the same way as the
+    // operating system would, so that the main loop is woken up by the event itself
+    template <typename CloseFunc, typename ReopenFunc, typename InputFunc>
+    void testMainLoop(tgui::BackendGui& gui, const CloseFunc& closeWindow, const ReopenFunc& reopenWindow, const InputFunc& sendInput)
+    {
+        // The input that is sent is a mouse move, which is only handled when there is a widget below the mouse
+        gui.removeAllWidgets();
+        auto panel = tgui::Panel::create({"100%", "100%"});
+        gui.add(panel);
+
+        SECTION("Idle")
+        {
+            // Nothing changes until the window is closed, so the loop only wakes up when the max idle wait time expires
+            gui.setMaxIdleWaitTime(std::chrono::milliseconds(50));
+            const MainLoopRun run = runMainLoop(gui, reopenWindow, [&closeWindow]{ tgui::Timer::scheduleCallback(closeWindow, std::chrono::milliseconds(500)); });
+            REQUIRE(run.elapsedTime >= std::chrono::milliseconds(500));
+            REQUIRE(run.statistics.wakeUps >= 5);
+            REQUIRE(run.statistics.wakeUps <= 25);
+        }
+
+        SECTION("Posted task interrupts the wait")
+        {
+            gui.setMaxIdleWaitTime(std::chrono::seconds(10));
+
+            std::thread thread;
+            const MainLoopRun run = runMainLoop(gui, reopenWindow, [&gui,&closeWindow,&thread]{
+                thread = std::thread([&gui,&closeWindow]{
+                    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                    gui.post(closeWindow);
+                });
+            });
+            thread.join();
+
+            REQUIRE(run.elapsedTime < std::chrono::seconds(5));
+            REQUIRE(run.statistics.postedTasksExecuted == 1);
+        }
+
+        SECTION("Input is presented without waiting for the idle time")
+        {
+            gui.setMaxIdleWaitTime(std::chrono::seconds(10));
+
+            std::thread thread;
+            const MainLoopRun run = runMainLoop(gui, reopenWindow, [&gui,&closeWindow,&sendInput,&thread]{
+                thread = std::thread([&gui,&closeWindow,&sendInput]{
+                    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                    sendInput();
+                    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                    gui.post(closeWindow);
+                });
+            });
+            thread.join();
+
+            REQUIRE(run.elapsedTime < std::chrono::seconds(5));
+            REQUIRE(run.statistics.framesPresented >= 2);
+            REQUIRE(run.statistics.maxInputLatency > tgui::Duration{});
+            REQUIRE(run.statistics.maxInputLatency < std::chrono::seconds(1));
+        }
+
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+        SECTION("Benchmark main loop")
+        {
+            // Measure the CPU time and number of wake-ups when nothing happens for 2 seconds
+            const MainLoopRun idleRun = runMainLoop(gui, reopenWindow, [&closeWindow]{ tgui::Timer::scheduleCallback(closeWindow, std::chrono::seconds(2)); });
+            const double idleSeconds = std::chrono::duration<double>(idleRun.elapsedTime).count();
+            WARN("Idle main loop: " << (idleRun.statistics.wakeUps / idleSeconds) << " wake-ups/s, "
+                 << (idleRun.cpuTimeSeconds / idleSeconds * 100) << "% CPU time");
+
+            // Measure the time between handling an input event and presenting the frame that shows it. The events are sent
+            // with 50ms between them, so that the loop is always waiting for events when the next one arrives.
+            constexpr unsigned int inputCount = 40;
+            float totalLatencySeconds = 0;
+            std::thread thread;
+            const MainLoopRun inputRun = runMainLoop(gui, reopenWindow, [&]{
+                thread = std::thread([&]{
+                    for (unsigned int i = 0; i < inputCount; ++i)
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+                        // The latency of the previous input is known by now
+                        gui.post([&]{ totalLatencySeconds += gui.getMainLoopStatistics().lastInputLatency.asSeconds(); });
+                        sendInput();
+                    }
+
+                    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                    gui.post([&]{
+                        totalLatencySeconds += gui.getMainLoopStatistics().lastInputLatency.asSeconds();
+                        closeWindow();
+                    });
+                });
+            });
+            thread.join();
+
+            WARN("Input to present latency: " << (totalLatencySeconds / inputCount * 1000) << "ms average, "
+                 << (inputRun.statistics.maxInputLatency.asSeconds() * 1000) << "ms max");
+        }
+#endif
+
+        gui.remove(panel);
+    }
+}
+
+TEST_CASE("[BackendGui]")
+{
+    unsigned int count = 0;
+    const auto callback = [&count]{ ++count; };
+
+    SECTION("Posting tasks to the gui")
+    {
+        WaitingGui gui;
+        REQUIRE(gui.getMaxIdleWaitTime() == std::chrono::milliseconds(50));
+        REQUIRE(gui.getIdleWaitTime() <= std::chrono::milliseconds(50));
+
+        // The wait is limited by the next timer
+        auto timer = tgui::Timer::create(callback, std::chrono::milliseconds(20));
+        REQUIRE(gui.getIdleWaitTime() <= std::chrono::milliseconds(20));
+        timer->setEnabled(false);
+
+        gui.setMaxIdleWaitTime(std::chrono::milliseconds(200));
+        REQUIRE(gui.getMaxIdleWaitTime() == std::chrono::milliseconds(200));
+        REQUIRE(!gui.waitForPostedTasks(std::chrono::milliseconds(1)));
+
+        // Tasks can be posted from any thread, they are executed when the gui is updated
+        std::thread thread([&gui, &callback]{
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            gui.post(callback);
+            gui.post(callback);
+        });
+
+        // Posting a task interrupts the wait
+        const auto startTime = std::chrono::steady_clock::now();
+        REQUIRE(gui.waitForPostedTasks(std::chrono::seconds(10)));
+        REQUIRE(std::chrono::steady_clock::now() - startTime < std::chrono::seconds(5));
+        thread.join();
+        REQUIRE(count == 0);
+
+        REQUIRE(gui.updateTime(tgui::Duration()));
+        REQUIRE(count == 2);
+        REQUIRE(gui.getMainLoopStatistics().postedTasksExecuted == 2);
+
+        // A posted task can post another one, which is executed in the next update
+        gui.post([&gui, &callback]{ gui.post(callback); });
+        gui.updateTime(tgui::Duration());
+        REQUIRE(count == 2);
+        gui.updateTime(tgui::Duration());
+        REQUIRE(count == 3);
+        REQUIRE(gui.getMainLoopStatistics().postedTasksExecuted == 4);
+
+        gui.resetMainLoopStatistics();
+        REQUIRE(gui.getMainLoopStatistics().postedTasksExecuted == 0);
+    }
+
+#if TGUI_HAS_WINDOW_BACKEND_SDL
+    auto backendGuiSDL = dynamic_cast<tgui::BackendGuiSDL*>(globalGui);
+    if (backendGuiSDL)
+    {
+        SECTION("SDL main loop")
+        {
+            const auto closeWindow = []{
+                SDL_Event event;
+                event.type = SDL_EVENT_QUIT;
+                SDL_PushEvent(&event);
+            };
+
+            // The quit event was already consumed by the main loop, so there is nothing to undo
+            const auto reopenWindow = []{};
+
+            // SDL_PushEvent can be called from any thread
+            const auto sendInput = []{
+                SDL_Event event;
+                SDL_zero(event);
+                event.type = SDL_EVENT_MOUSE_MOTION;
+                event.motion.which = 1;
+                event.motion.x = 100;
+                event.motion.y = 50;
+                SDL_PushEvent(&event);
+            };
+
+            testMainLoop(*backendGuiSDL, closeWindow, reopenWindow, sendInput);
+        }
+    }
+#endif
+
+#if TGUI_HAS_WINDOW_BACKEND_GLFW
+    auto backendGuiGLFW = dynamic_cast<tgui::BackendGuiGLFW*>(globalGui);
+    if (backendGuiGLFW)
+    {
+        SECTION("GLFW main loop")
+        {
+            const auto closeWindow = [backendGuiGLFW]{ glfwSetWindowShouldClose(backendGuiGLFW->getWindow(), GLFW_TRUE); };
+
+            // The window has to remain open for the next run of the main loop and for the other tests
+            const auto reopenWindow = [backendGuiGLFW]{ glfwSetWindowShouldClose(backendGuiGLFW->getWindow(), GLFW_FALSE); };
+
+            // GLFW calls the callbacks on the gui thread, while it processes the events after waking up
+            const auto sendInput = [backendGuiGLFW]{ backendGuiGLFW->post([backendGuiGLFW]{ backendGuiGLFW->cursorPosCallback(100, 50); }); };
+            testMainLoop(*backendGuiGLFW, closeWindow, reopenWindow, sendInput);
+        }
+    }
+#endif
+
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+    SECTION("Benchmark posting tasks")
+    {
+        WaitingGui gui;
+        BENCHMARK("Waking up the gui from another thread")
+        {
+            std::thread thread([&gui]{ gui.post([]{}); });
+            gui.waitForPostedTasks(std::chrono::seconds(1));
+            thread.join();
+            return gui.updateTime(tgui::Duration());
+        };
+    }
+#endif
+}
@@ -0,0 +1,475 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+
+#if TGUI_BUILD_AS_CXX_MODULE
+    import tgui;
+#else
+    #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
+#endif
+
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    // Render target that doesn't draw anything but only keeps track of what it was asked to draw
+    class CountingRenderTarget : public tgui::BackendRenderTarget
+    {
+    public:
+        void setClearColor(const tgui::Color&) override {}
+        void clearScreen() override {}
+
+        void drawGui(const std::shared_ptr<tgui::RootContainer>& root) override
+        {
+            beginFrame();
+            root->draw(*this, {});
+            endFrame();
+        }
+
+        void drawVertexArray(const tgui::RenderStates& states, const tgui::Vertex* vertices, std::size_t vertexCount,
+                             const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<tgui::BackendTexture>& texture) override
+        {
+            if (batchVertexArray(states, vertices, vertexCount, indices, indexCount, texture))
+                return;
+
+            ++drawCount;
+            lastVertexCount = vertexCount;
+            lastIndexCount = indices ? indexCount : vertexCount;
+            lastVertexPosition = states.transform.transformPoint(vertices[vertexCount - 1].position);
+        }
+
+        std::size_t drawCount = 0;
+        std::size_t lastVertexCount = 0;
+        std::size_t lastIndexCount = 0;
+        tgui::Vector2f lastVertexPosition;
+
+    protected:
+        void updateClipping(tgui::FloatRect, tgui::FloatRect) override {}
+    };
+
+    // Render target that claims to support partial redraw and remembers which areas it was asked to redraw
+    class RetainingRenderTarget : public CountingRenderTarget
+    {
+    public:
+        bool isPartialRedrawSupported() const override
+        {
+            return true;
+        }
+
+        void drawGui(const std::shared_ptr<tgui::RootContainer>& root) override
+        {
+            lastRedrawAreas = m_redrawAreas;
+            CountingRenderTarget::drawGui(root);
+        }
+
+        tgui::Optional<std::vector<tgui::FloatRect>> lastRedrawAreas;
+    };
+
+    // Gui that isn't connected to a window
+    class WindowlessGui : public tgui::BackendGui
+    {
+    public:
+        WindowlessGui(std::shared_ptr<tgui::BackendRenderTarget> target)
+        {
+            m_backendRenderTarget = std::move(target);
+            m_framebufferSize = {400, 300};
+            updateContainerSize();
+        }
+
+        void mainLoop(tgui::Color) override {}
+    };
+}
+
+TEST_CASE("[BackendRenderTarget]")
+{
+    CountingRenderTarget target;
+    target.setView({0, 0, 400, 300}, {0, 0, 400, 300}, {400, 300});
+
+    auto root = std::make_shared<tgui::RootContainer>();
+    for (unsigned int i = 0; i < 5; ++i)
+    {
+        auto line = tgui::SeparatorLine::create({10, 20});
+        line->setPosition({i * 20.f, 30});
+        root->add(line);
+    }
+
+    SECTION("Batching disabled")
+    {
+        REQUIRE(!target.isBatchingEnabled());
+        target.drawGui(root);
+
+        REQUIRE(target.drawCount == 5);
+        REQUIRE(target.getFrameStatistics().drawCalls == 5);
+        REQUIRE(target.getFrameStatistics().mergedDrawCalls == 0);
+        REQUIRE(target.getFrameStatistics().uploadedVertices == 5 * 4);
+    }
+
+    SECTION("Batching enabled")
+    {
+        target.setBatchingEnabled(true);
+        REQUIRE(target.isBatchingEnabled());
+        target.drawGui(root);
+
+        REQUIRE(target.drawCount == 1);
+        REQUIRE(target.lastVertexCount == 5 * 4);
+        REQUIRE(target.lastIndexCount == 5 * 6);
+        REQUIRE(target.getFrameStatistics().drawCalls == 1);
+        REQUIRE(target.getFrameStatistics().mergedDrawCalls == 4);
+        REQUIRE(target.getFrameStatistics().uploadedVertices == 5 * 4);
+
+        // Vertices are transformed before being stored in the batch
+        REQUIRE(target.lastVertexPosition == tgui::Vector2f{90, 50});
+
+        SECTION("Clipping flushes the batch")
+        {
+            auto panel = tgui::Panel::create({50, 50});
+            panel->getRenderer()->setBorders(0);
+            panel->add(tgui::SeparatorLine::create({10, 10}));
+            root->add(panel);
+
+            target.drawCount = 0;
+            target.drawGui(root);
+
+            // Lines before the panel, panel background, line inside the clipped area
+            REQUIRE(target.drawCount == 2);
+            REQUIRE(target.getFrameStatistics().drawCalls == 2);
+            REQUIRE(target.getFrameStatistics().mergedDrawCalls == 5);
+        }
+
+        SECTION("Statistics are per frame")
+        {
+            target.drawGui(root);
+            REQUIRE(target.getFrameStatistics().drawCalls == 1);
+            REQUIRE(target.getFrameStatistics().mergedDrawCalls == 4);
+        }
+    }
+
+    SECTION("Render caching")
+    {
+        auto panel = tgui::Panel::create({50, 50});
+        panel->setPosition({100, 100});
+        panel->getRenderer()->setBorders(0);
+        auto line = tgui::SeparatorLine::create({10, 10});
+        line->setPosition({5, 5});
+        panel->add(line);
+        root->add(panel);
+
+        REQUIRE(!panel->isRenderCachingEnabled());
+        panel->setRenderCachingEnabled(true);
+        REQUIRE(panel->isRenderCachingEnabled());
+
+        // The draw calls are recorded in the first frame and repeated in the next frames
+        target.drawGui(root);
+        REQUIRE(target.getFrameStatistics().cachedWidgets == 0);
+        REQUIRE(target.drawCount == 7);
+        REQUIRE(target.lastVertexPosition == tgui::Vector2f{115, 115});
+
+        target.drawCount = 0;
+        target.lastVertexPosition = {};
+        target.drawGui(root);
+        REQUIRE(target.getFrameStatistics().cachedWidgets == 1);
+        REQUIRE(target.drawCount == 7);
+        REQUIRE(target.lastVertexPosition == tgui::Vector2f{115, 115});
+
+        SECTION("Changing child widget")
+        {
+            line->setSize({20, 20});
+            target.drawGui(root);
+            REQUIRE(target.getFrameStatistics().cachedWidgets == 0);
+            REQUIRE(target.lastVertexPosition == tgui::Vector2f{125, 125});
+
+            target.drawGui(root);
+            REQUIRE(target.getFrameStatistics().cachedWidgets == 1);
+            REQUIRE(target.lastVertexPosition == tgui::Vector2f{125, 125});
+        }
+
+        SECTION("Changing renderer")
+        {
+            panel->getRenderer()->setBackgroundColor(tgui::Color::Red);
+            target.drawGui(root);
+            REQUIRE(target.getFrameStatistics().cachedWidgets == 0);
+        }
+
+        SECTION("Moving widget")
+        {
+            panel->setPosition({200, 100});
+            target.drawGui(root);
+            REQUIRE(target.getFrameStatistics().cachedWidgets == 0);
+            REQUIRE(target.lastVertexPosition == tgui::Vector2f{215, 115});
+        }
+
+        SECTION("Adding child widget")
+        {
+            panel->add(tgui::SeparatorLine::create({10, 10}));
+            target.drawCount = 0;
+            target.drawGui(root);
+            REQUIRE(target.getFrameStatistics().cachedWidgets == 0);
+            REQUIRE(target.drawCount == 8);
+        }
+
+        SECTION("Widget specific setters")
+        {
+            auto progressBar = tgui::ProgressBar::create();
+            progressBar->setSize({40, 10});
+            panel->add(progressBar);
+            auto checkBox = tgui::CheckBox::create();
+            checkBox->setSize({10, 10});
+            checkBox->setPosition({0, 20});
+            panel->add(checkBox);
+
+            target.drawGui(root);
+            target.drawGui(root);
+            REQUIRE(target.getFrameStatistics().cachedWidgets == 1);
+
+            progressBar->setValue(50);
+            target.drawGui(root);
+            REQUIRE(target.getFrameStatistics().cachedWidgets == 0);
+
+            target.drawGui(root);
+            REQUIRE(target.getFrameStatistics().cachedWidgets == 1);
+
+            checkBox->setChecked(true);
+            target.drawGui(root);
+            REQUIRE(target.getFrameStatistics().cachedWidgets == 0);
+        }
+
+        SECTION("Explicit invalidation")
+        {
+            line->invalidateRenderCache();
+            target.drawGui(root);
+            REQUIRE(target.getFrameStatistics().cachedWidgets == 0);
+        }
+
+        SECTION("Nested caches")
+        {
+            line->setRenderCachingEnabled(true);
+            target.drawGui(root);
+            target.drawGui(root);
+            REQUIRE(target.getFrameStatistics().cachedWidgets == 1);
+
+            // The line is drawn from its own cache while the panel records its draw calls again
+            panel->getRenderer()->setBackgroundColor(tgui::Color::Red);
+            target.drawGui(root);
+            REQUIRE(target.getFrameStatistics().cachedWidgets == 1);
+            REQUIRE(target.lastVertexPosition == tgui::Vector2f{115, 115});
+
+            target.drawGui(root);
+            REQUIRE(target.getFrameStatistics().cachedWidgets == 1);
+            REQUIRE(target.lastVertexPosition == tgui::Vector2f{115, 115});
+        }
+
+        SECTION("Disabling render caching")
+        {
+            panel->setRenderCachingEnabled(false);
+            target.drawGui(root);
+            REQUIRE(target.getFrameStatistics().cachedWidgets == 0);
+        }
+    }
+
+    SECTION("Partial redraw")
+    {
+        auto retainingTarget = std::make_shared<RetainingRenderTarget>();
+        WindowlessGui gui{retainingTarget};
+        gui.setDrawingUpdatesTime(false);
+
+        REQUIRE(!gui.isPartialRedrawEnabled());
+        gui.setPartialRedrawEnabled(true);
+        REQUIRE(gui.isPartialRedrawEnabled());
+
+        auto line = tgui::SeparatorLine::create({10, 10});
+        line->setPosition({300, 200});
+        gui.add(line);
+
+        // The first frame is always drawn completely
+        gui.draw();
+        REQUIRE(!retainingTarget->lastRedrawAreas);
+
+        gui.draw();
+        REQUIRE(retainingTarget->lastRedrawAreas);
+        REQUIRE(retainingTarget->lastRedrawAreas->empty());
+
+        SECTION("Moving widget")
+        {
+            // Both the old and new location are redrawn, with some padding around them
+            line->setPosition({320, 200});
+            gui.draw();
+            REQUIRE(retainingTarget->lastRedrawAreas);
+            REQUIRE(retainingTarget->lastRedrawAreas->size() == 2);
+            REQUIRE((*retainingTarget->lastRedrawAreas)[0] == tgui::FloatRect{298, 198, 14, 14});
+            REQUIRE((*retainingTarget->lastRedrawAreas)[1] == tgui::FloatRect{318, 198, 14, 14});
+
+            // Overlapping areas are merged
+            line->setPosition({325, 200});
+            gui.draw();
+            REQUIRE(retainingTarget->lastRedrawAreas->size() == 1);
+            REQUIRE((*retainingTarget->lastRedrawAreas)[0] == tgui::FloatRect{318, 198, 19, 14});
+        }
+
+        SECTION("Removing widget")
+        {
+            gui.remove(line);
+            gui.draw();
+            REQUIRE(retainingTarget->lastRedrawAreas->size() == 1);
+            REQUIRE((*retainingTarget->lastRedrawAreas)[0] == tgui::FloatRect{298, 198, 14, 14});
+        }
+
+        SECTION("Widget specific setter")
+        {
+            auto progressBar = tgui::ProgressBar::create();
+            progressBar->setPosition({100, 50});
+            progressBar->setSize({40, 10});
+            gui.add(progressBar);
+            gui.draw();
+
+            // Only the area of the progress bar is redrawn when its value changes
+            progressBar->setValue(50);
+            gui.draw();
+            REQUIRE(retainingTarget->lastRedrawAreas);
+            REQUIRE(retainingTarget->lastRedrawAreas->size() == 1);
+            REQUIRE((*retainingTarget->lastRedrawAreas)[0] == tgui::FloatRect{98, 48, 44, 14});
+
+            gui.draw();
+            REQUIRE(retainingTarget->lastRedrawAreas->empty());
+        }
+
+        SECTION("Coalesced event")
+        {
+            gui.setEventCoalescingEnabled(true);
+
+            // Let the gui catch up with changes made by earlier tests first (e.g. SVG images that finished rasterizing)
+            gui.updateTime(tgui::Duration{});
+            gui.draw();
+
+            tgui::Event event;
+            event.type = tgui::Event::Type::MouseMoved;
+            event.mouseMove.x = 305;
+            event.mouseMove.y = 205;
+            REQUIRE(!gui.handleEvent(event));
+
+            // Handling the event requires a refresh, but only the widget below the mouse has to be redrawn
+            REQUIRE(gui.updateTime(tgui::Duration{}));
+            gui.draw();
+            REQUIRE(retainingTarget->lastRedrawAreas);
+            REQUIRE(retainingTarget->lastRedrawAreas->size() == 1);
+            REQUIRE((*retainingTarget->lastRedrawAreas)[0] == tgui::FloatRect{298, 198, 14, 14});
+        }
+
+        SECTION("Many areas")
+        {
+            for (unsigned int i = 0; i < 10; ++i)
+            {
+                auto smallLine = tgui::SeparatorLine::create({5, 5});
+                smallLine->setPosition({i * 20.f, 0});
+                gui.add(smallLine);
+            }
+            gui.draw();
+            REQUIRE(retainingTarget->lastRedrawAreas->size() <= 8);
+        }
+
+        SECTION("Svg image rasterized in background")
+        {
+            tgui::SvgImage::setAsyncRasterizationEnabled(true);
+
+            auto picture = tgui::Picture::create("resources/SFML.svg");
+            picture->setPosition({100, 50});
+            picture->setSize({40, 40});
+            gui.add(picture);
+            gui.updateTime(tgui::Duration{});
+            gui.draw();
+
+            // The picture is first drawn with the closest size that is available
+            picture->setSize({53, 53});
+            gui.draw();
+            REQUIRE(retainingTarget->lastRedrawAreas);
+
+            // Only the picture is redrawn when the requested size has been rasterized
+            bool refreshRequired = false;
+            const auto startTime = std::chrono::steady_clock::now();
+            while (!refreshRequired && (std::chrono::steady_clock::now() - startTime < std::chrono::seconds(10)))
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                refreshRequired = gui.updateTime(tgui::Duration{});
+            }
+            REQUIRE(refreshRequired);
+
+            gui.draw();
+            REQUIRE(retainingTarget->lastRedrawAreas);
+            REQUIRE(retainingTarget->lastRedrawAreas->size() == 1);
+            REQUIRE((*retainingTarget->lastRedrawAreas)[0] == tgui::FloatRect{98, 48, 57, 57});
+
+            tgui::SvgImage::setAsyncRasterizationEnabled(false);
+            tgui::SvgImage::clearRasterCache();
+        }
+
+        SECTION("Rotating widget")
+        {
+            line->setRotation(45);
+            gui.draw();
+            REQUIRE(!retainingTarget->lastRedrawAreas);
+        }
+
+        SECTION("Callback function")
+        {
+            // Widgets that are changed by a callback report their own areas, so a callback doesn't redraw everything
+            auto progressBar = tgui::ProgressBar::create();
+            progressBar->setPosition({100, 50});
+            progressBar->setSize({40, 10});
+            gui.add(progressBar);
+            gui.draw();
+
+            line->onPositionChange([=]{ progressBar->setValue(50); });
+            line->setPosition({320, 200});
+            gui.draw();
+            REQUIRE(retainingTarget->lastRedrawAreas);
+            REQUIRE(retainingTarget->lastRedrawAreas->size() == 3);
+            REQUIRE((*retainingTarget->lastRedrawAreas)[0] == tgui::FloatRect{98, 48, 44, 14});
+            REQUIRE((*retainingTarget->lastRedrawAreas)[1] == tgui::FloatRect{298, 198, 14, 14});
+            REQUIRE((*retainingTarget->lastRedrawAreas)[2] == tgui::FloatRect{318, 198, 14, 14});
+        }
+
+        SECTION("Posted function")
+        {
+            gui.updateTime(tgui::Duration{});
+            gui.draw();
+
+            gui.post([=]{ line->setPosition({320, 200}); });
+            REQUIRE(gui.updateTime(tgui::Duration{}));
+            gui.draw();
+            REQUIRE(retainingTarget->lastRedrawAreas);
+            REQUIRE(retainingTarget->lastRedrawAreas->size() == 2);
+            REQUIRE((*retainingTarget->lastRedrawAreas)[0] == tgui::FloatRect{298, 198, 14, 14});
+            REQUIRE((*retainingTarget->lastRedrawAreas)[1] == tgui::FloatRect{318, 198, 14, 14});
+        }
+
+        SECTION("Disabling partial redraw")
+        {
+            gui.setPartialRedrawEnabled(false);
+            line->setPosition({320, 200});
+            gui.draw();
+            REQUIRE(!retainingTarget->lastRedrawAreas);
+        }
+    }
+}
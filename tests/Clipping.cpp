@@ -110,4 +110,8 @@ TEST_CASE("[Clipping]")
 
         TEST_DRAW("Clipping_NestedLayers.png")
     }
+
+    // The gui is shared with the other tests, which expect the view to match the window
+    globalGui->setRelativeViewport({0, 0, 1, 1});
+    globalGui->setRelativeView({0, 0, 1, 1});
 }
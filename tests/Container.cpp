@@ -437,6 +437,179 @@ TEST_CASE("[Container]")
         REQUIRE(container->getWidgetBelowMouseCursor({93, 39}) == w3);
     }
 
+    SECTION("Spatial index")
+    {
+        auto group = tgui::Group::create({400, 400});
+        REQUIRE(group->getSpatialIndexCellSize() == 0);
+
+        std::vector<tgui::ClickableWidget::Ptr> widgets;
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            auto widget = tgui::ClickableWidget::create({30, 30});
+            widget->setPosition({static_cast<float>((i % 10) * 35), static_cast<float>((i / 10) * 35)});
+            group->add(widget);
+            widgets.push_back(widget);
+        }
+
+        auto background = tgui::ClickableWidget::create({400, 400});
+        group->add(background);
+        group->moveWidgetToBack(background);
+
+        // The grid has to give the same result as checking every widget
+        const auto compareWithLinearSearch = [&]{
+            std::vector<tgui::Widget::Ptr> expected;
+            group->setSpatialIndexCellSize(0);
+            for (unsigned int y = 0; y < 400; y += 7)
+            {
+                for (unsigned int x = 0; x < 400; x += 7)
+                    expected.push_back(group->getWidgetAtPosition({static_cast<float>(x), static_cast<float>(y)}));
+            }
+
+            group->setSpatialIndexCellSize(50);
+            std::size_t i = 0;
+            for (unsigned int y = 0; y < 400; y += 7)
+            {
+                for (unsigned int x = 0; x < 400; x += 7)
+                    REQUIRE(group->getWidgetAtPosition({static_cast<float>(x), static_cast<float>(y)}) == expected[i++]);
+            }
+        };
+
+        group->setSpatialIndexCellSize(50);
+        REQUIRE(group->getSpatialIndexCellSize() == 50);
+        REQUIRE(group->getWidgetAtPosition({10, 10}) == widgets[0]);
+        REQUIRE(group->getWidgetAtPosition({32, 10}) == background);
+        REQUIRE(group->getWidgetAtPosition({390, 390}) == background);
+        REQUIRE(group->getWidgetAtPosition({410, 10}) == nullptr);
+        compareWithLinearSearch();
+
+        SECTION("Moving and resizing")
+        {
+            widgets[0]->setPosition({200, 200});
+            widgets[1]->setSize({100, 5});
+            widgets[2]->setOrigin({0.5f, 0.5f});
+            widgets[3]->setRotation(45);
+            widgets[4]->setScale({2, 3});
+            REQUIRE(group->getWidgetAtPosition({205, 205}) == widgets[0]);
+            REQUIRE(group->getWidgetAtPosition({10, 10}) == background);
+            REQUIRE(group->getWidgetAtPosition({100, 2}) == widgets[1]);
+            compareWithLinearSearch();
+        }
+
+        SECTION("Changing renderer")
+        {
+            // The thumb of the slider sticks out of the track when it isn't kept within it
+            auto slider = tgui::Slider::create();
+            slider->getRenderer()->setThumbWithinTrack(true);
+            slider->setPosition({200, 300});
+            slider->setSize({100, 10});
+            group->add(slider);
+            REQUIRE(group->getWidgetAtPosition({197, 305}) != slider);
+
+            slider->getRenderer()->setThumbWithinTrack(false);
+            REQUIRE(group->getWidgetAtPosition({197, 305}) == slider);
+
+            // Replacing the renderer resets the property to its default value, which is false
+            slider->getRenderer()->setThumbWithinTrack(true);
+            REQUIRE(group->getWidgetAtPosition({197, 305}) != slider);
+            slider->setRenderer(tgui::RendererData::create());
+            REQUIRE(group->getWidgetAtPosition({197, 305}) == slider);
+            compareWithLinearSearch();
+        }
+
+        SECTION("Changing the text")
+        {
+            // The text of a radio button or check box can be clicked, so the area of the widget grows with the text
+            auto radioButton = tgui::RadioButton::create();
+            radioButton->setPosition({200, 360});
+            radioButton->setSize({20, 20});
+            group->add(radioButton);
+            REQUIRE(group->getWidgetAtPosition({260, 370}) == background);
+
+            radioButton->setText("Radio button with a long text");
+            REQUIRE(group->getWidgetAtPosition({260, 370}) == radioButton);
+            group->leftMousePressed({260, 370});
+            group->leftMouseReleased({260, 370});
+            REQUIRE(radioButton->isChecked());
+
+            auto checkBox = tgui::CheckBox::create("Check");
+            checkBox->setPosition({10, 360});
+            checkBox->setSize({20, 20});
+            checkBox->setTextSize(10);
+            group->add(checkBox);
+            REQUIRE(group->getWidgetAtPosition({70, 370}) == background);
+
+            checkBox->setTextSize(30);
+            REQUIRE(group->getWidgetAtPosition({70, 370}) == checkBox);
+            group->leftMousePressed({70, 370});
+            group->leftMouseReleased({70, 370});
+            REQUIRE(checkBox->isChecked());
+            compareWithLinearSearch();
+        }
+
+        SECTION("Changing z-order")
+        {
+            widgets[0]->setPosition({36, 0});
+            REQUIRE(group->getWidgetAtPosition({40, 10}) == widgets[1]);
+            group->moveWidgetToFront(widgets[0]);
+            REQUIRE(group->getWidgetAtPosition({40, 10}) == widgets[0]);
+            group->moveWidgetToBack(widgets[0]);
+            REQUIRE(group->getWidgetAtPosition({40, 10}) == widgets[1]);
+            group->setWidgetIndex(background, group->getWidgets().size() - 1);
+            REQUIRE(group->getWidgetAtPosition({40, 10}) == background);
+            compareWithLinearSearch();
+        }
+
+        SECTION("Hiding and removing widgets")
+        {
+            widgets[0]->setVisible(false);
+            REQUIRE(group->getWidgetAtPosition({10, 10}) == background);
+            group->remove(background);
+            REQUIRE(group->getWidgetAtPosition({10, 10}) == nullptr);
+            REQUIRE(group->getWidgetAtPosition({45, 10}) == widgets[1]);
+            compareWithLinearSearch();
+
+            group->removeAllWidgets();
+            REQUIRE(group->getWidgetAtPosition({45, 10}) == nullptr);
+            REQUIRE(group->getSpatialIndexCellSize() == 50);
+        }
+
+        SECTION("Copying")
+        {
+            auto copy = tgui::Group::copy(group);
+            REQUIRE(copy->getSpatialIndexCellSize() == 50);
+            REQUIRE(copy->getWidgetAtPosition({45, 10}) == copy->getWidgets()[2]);
+        }
+
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+        SECTION("Benchmark")
+        {
+            // The group already contains 100 widgets, more widgets are added before each pair of measurements
+            for (const unsigned int widgetCount : {100u, 1000u, 10000u})
+            {
+                for (unsigned int i = static_cast<unsigned int>(widgets.size()); i < widgetCount; ++i)
+                {
+                    auto widget = tgui::ClickableWidget::create({3, 3});
+                    widget->setPosition({static_cast<float>((i % 100) * 4), static_cast<float>((i / 100) * 4)});
+                    group->add(widget);
+                    widgets.push_back(widget);
+                }
+
+                group->setSpatialIndexCellSize(0);
+                BENCHMARK("getWidgetAtPosition with " + std::to_string(widgetCount) + " widgets without spatial index")
+                {
+                    return group->getWidgetAtPosition({201, 201});
+                };
+
+                group->setSpatialIndexCellSize(10);
+                BENCHMARK("getWidgetAtPosition with " + std::to_string(widgetCount) + " widgets with spatial index")
+                {
+                    return group->getWidgetAtPosition({201, 201});
+                };
+            }
+        }
+#endif
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
@@ -32,3 +32,119 @@ TEST_CASE("[Font]")
 
     REQUIRE_THROWS_AS(tgui::Font("NonExistentFile.ttf"), tgui::Exception);
 }
+
+TEST_CASE("[BackendFont]")
+{
+    auto font = tgui::getBackend()->createFont();
+    REQUIRE(font->loadFromFile("resources/DejaVuSans.ttf"));
+
+    // Only some font backends store their glyphs in multiple texture pages
+    if (font->getTexturePageStatistics().empty())
+        return;
+
+    SECTION("Initial page")
+    {
+        REQUIRE(font->getTexturePageCount(20) == 1);
+
+        const auto stats = font->getTexturePageStatistics();
+        REQUIRE(stats.size() == 1);
+        REQUIRE(stats[0].glyphCount == 0);
+        REQUIRE(stats[0].usedPixels == 0);
+        REQUIRE(stats[0].memoryUsage == stats[0].size.x * stats[0].size.y);
+        REQUIRE(stats[0].fillRatio == 0);
+    }
+
+    SECTION("First page grows until maximum size")
+    {
+        REQUIRE(font->getMaximumTexturePageSize() == 1024);
+        const tgui::Vector2u initialSize = font->getTexturePageStatistics()[0].size;
+
+        for (char32_t c = U'A'; c <= U'Z'; ++c)
+            REQUIRE(font->getGlyph(c, 40, false).texturePage == 0);
+
+        REQUIRE(font->getTexturePageCount(40) == 1);
+        const auto stats = font->getTexturePageStatistics();
+        REQUIRE(stats.size() == 1);
+        REQUIRE(stats[0].size.x > initialSize.x);
+        REQUIRE(stats[0].glyphCount == 26);
+        REQUIRE(stats[0].fillRatio > 0);
+        REQUIRE(font->getTexturePageSize(40, 0) == stats[0].size);
+        REQUIRE(font->getTextureSize(40) == stats[0].size);
+    }
+
+    SECTION("Kerning")
+    {
+        REQUIRE(font->getKerning(0, U'V', 20, false) == 0);
+        REQUIRE(font->getKerning(U'A', 0, 20, false) == 0);
+
+        // The kerning is cached after the first call
+        const float kerning = font->getKerning(U'A', U'V', 20, false);
+        REQUIRE(font->getKerning(U'A', U'V', 20, false) == kerning);
+
+        auto otherFont = tgui::getBackend()->createFont();
+        REQUIRE(otherFont->loadFromFile("resources/DejaVuSans.ttf"));
+        REQUIRE(otherFont->getKerning(U'A', U'V', 20, false) == kerning);
+        REQUIRE(otherFont->getKerning(U'A', U'V', 40, false) == font->getKerning(U'A', U'V', 40, false));
+    }
+
+    SECTION("Texture updates")
+    {
+        (void)font->getGlyph(U'A', 20, false);
+
+        unsigned int textureVersion;
+        const auto texture = font->getTexture(20, textureVersion);
+        REQUIRE(texture != nullptr);
+
+        // Adding a glyph that fits in the texture doesn't change the texture coordinates of existing glyphs
+        (void)font->getGlyph(U'B', 20, false);
+        unsigned int newTextureVersion;
+        REQUIRE(font->getTexture(20, newTextureVersion) == texture);
+        REQUIRE(newTextureVersion == textureVersion);
+
+        // Enlarging the texture changes the texture coordinates
+        for (char32_t c = U'A'; c <= U'Z'; ++c)
+            (void)font->getGlyph(c, 40, false);
+
+        REQUIRE(font->getTexture(20, newTextureVersion) == texture);
+        REQUIRE(newTextureVersion != textureVersion);
+        REQUIRE(texture->getSize() == font->getTextureSize(20));
+    }
+
+    SECTION("Additional pages")
+    {
+        font->setMaximumTexturePageSize(128);
+        REQUIRE(font->getMaximumTexturePageSize() == 128);
+
+        std::vector<tgui::FontGlyph> glyphs;
+        for (char32_t c = U'A'; c <= U'Z'; ++c)
+            glyphs.push_back(font->getGlyph(c, 40, false));
+
+        const auto stats = font->getTexturePageStatistics();
+        REQUIRE(stats.size() > 1);
+        REQUIRE(font->getTexturePageCount(40) == stats.size());
+
+        std::size_t glyphCount = 0;
+        for (const auto& pageStats : stats)
+        {
+            REQUIRE(pageStats.size == tgui::Vector2u{128, 128});
+            REQUIRE(pageStats.glyphCount > 0);
+            REQUIRE(pageStats.fillRatio > 0);
+            REQUIRE(pageStats.fillRatio <= 1);
+            glyphCount += pageStats.glyphCount;
+        }
+        REQUIRE(glyphCount == glyphs.size());
+
+        for (const auto& glyph : glyphs)
+        {
+            REQUIRE(glyph.texturePage < stats.size());
+            REQUIRE(glyph.textureRect.left + glyph.textureRect.width <= 128);
+            REQUIRE(glyph.textureRect.top + glyph.textureRect.height <= 128);
+        }
+
+        // Requesting a glyph again doesn't use extra space
+        REQUIRE(font->getGlyph(U'A', 40, false).texturePage == glyphs[0].texturePage);
+        REQUIRE(font->getTexturePageStatistics().size() == stats.size());
+
+        REQUIRE(font->getTexturePageSize(40, static_cast<unsigned int>(stats.size())) == tgui::Vector2u{0, 0});
+    }
+}
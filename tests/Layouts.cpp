@@ -450,6 +450,73 @@ TEST_CASE("[Layouts]")
         }
     }
 
+    SECTION("deferred updates")
+    {
+        auto group = tgui::Group::create({400, 300});
+        auto button1 = tgui::Button::create();
+        auto button2 = tgui::Button::create();
+        auto button3 = tgui::Button::create();
+        group->add(button1);
+        group->add(button2);
+        group->add(button3);
+
+        button1->setSize({"50%", "20%"});
+        button2->setSize({bindWidth(button1) + 10, bindHeight(button1)});
+        button2->setPosition({bindRight(button1), bindTop(button1)});
+        button3->setSize({bindWidth(button1) + bindWidth(button2), "&.h"});
+        REQUIRE(button3->getSize() == tgui::Vector2f(410, 300));
+
+        Layout::setDeferredUpdatesEnabled(true);
+        Layout::resetSolverStatistics();
+        REQUIRE(Layout::isDeferredUpdatesEnabled());
+
+        unsigned int sizeChangeCount = 0;
+        button3->onSizeChange([&]{ sizeChangeCount++; });
+
+        // Dependent widgets keep their size until the layouts are flushed
+        group->setSize({800, 600});
+        group->setSize({600, 500});
+        REQUIRE(group->getSize() == tgui::Vector2f(600, 500));
+        REQUIRE(button1->getSize() == tgui::Vector2f(200, 60));
+        REQUIRE(button3->getSize() == tgui::Vector2f(410, 300));
+
+        REQUIRE(Layout::flushLayouts());
+        REQUIRE(button1->getSize() == tgui::Vector2f(300, 100));
+        REQUIRE(button2->getSize() == tgui::Vector2f(310, 100));
+        REQUIRE(button2->getPosition() == tgui::Vector2f(300, 0));
+        REQUIRE(button3->getSize() == tgui::Vector2f(610, 500));
+
+        // Button3 depends on the group, button1 and button2, but it is only resized once
+        REQUIRE(sizeChangeCount == 1);
+
+        // The x and y components of the sizes of all buttons and the x position of button2 were each recalculated once
+        auto statistics = Layout::getSolverStatistics();
+        REQUIRE(statistics.flushes == 1);
+        REQUIRE(statistics.lastFlushPasses == 1);
+        REQUIRE(statistics.lastFlushEvaluations == 7);
+        REQUIRE(statistics.totalEvaluations == 7);
+
+        REQUIRE(!Layout::flushLayouts());
+        REQUIRE(Layout::getSolverStatistics().flushes == 1);
+
+        // Widgets with dirty layouts can be destroyed before the layouts are flushed
+        group->setSize({700, 500});
+        group->remove(button3);
+        button3 = nullptr;
+        REQUIRE(Layout::flushLayouts());
+        REQUIRE(button2->getSize() == tgui::Vector2f(360, 100));
+
+        // Disabling deferred updates flushes the layouts that are still dirty
+        group->setSize({800, 500});
+        Layout::setDeferredUpdatesEnabled(false);
+        REQUIRE(!Layout::isDeferredUpdatesEnabled());
+        REQUIRE(button2->getSize() == tgui::Vector2f(410, 100));
+
+        group->setSize({400, 500});
+        REQUIRE(button2->getSize() == tgui::Vector2f(210, 100));
+        REQUIRE(Layout::getSolverStatistics().flushes == 3);
+    }
+
     SECTION("Bug Fixes")
     {
         SECTION("Setting negative size and reverting back to positive (https://github.com/texus/TGUI/issues/54)")
@@ -315,4 +315,70 @@ TEST_CASE("[DataIO]")
         REQUIRE(parsedRoot->children[1]->children.empty());
         REQUIRE(parsedRoot->children[1]->propertyValuePairs.empty());
     }
+
+    SECTION("parse from memory")
+    {
+        const std::string contents = "GlobalProperty = Global  Value /* comment */ ;\n"
+                                     "Child1 {\n"
+                                     "    Property = [X, \"Y,Z\" , W]; // comment\n"
+                                     "    NestedChild { PropertyA = \"A/B\"; }\n"
+                                     "}\n"
+                                     "Child2 : Child1 { Property = \"\\u00e9\"; }\n"
+                                     "\xC3\xA9l\xC3\xA9ment { Value = \xE2\x82\xAC; }";
+
+        std::stringstream stream{contents};
+        const auto rootFromStream = tgui::DataIO::parse(stream);
+        const auto rootFromMemory = tgui::DataIO::parse(tgui::CharStringView{contents.data(), contents.size()});
+
+        std::stringstream emittedFromStream;
+        std::stringstream emittedFromMemory;
+        tgui::DataIO::emit(rootFromStream, emittedFromStream);
+        tgui::DataIO::emit(rootFromMemory, emittedFromMemory);
+        REQUIRE(emittedFromMemory.str() == emittedFromStream.str());
+
+        REQUIRE(rootFromMemory->propertyValuePairs["GlobalProperty"]->value == "Global Value");
+        REQUIRE(rootFromMemory->children.size() == 3);
+        REQUIRE(rootFromMemory->children[0]->propertyValuePairs["Property"]->valueList.size() == 3);
+        REQUIRE(rootFromMemory->children[0]->propertyValuePairs["Property"]->valueList[1] == "\"Y,Z\"");
+        REQUIRE(rootFromMemory->children[1]->children.size() == 1);
+        REQUIRE(rootFromMemory->children[2]->name == U"\u00e9l\u00e9ment");
+        REQUIRE(rootFromMemory->children[2]->propertyValuePairs[U"Value"]->value == U"\u20ac");
+
+        // Only the unread part of the stream is parsed
+        std::stringstream partiallyReadStream{"Ignored {} Child {}"};
+        std::string ignoredWord;
+        partiallyReadStream >> ignoredWord >> ignoredWord;
+        const auto partialRoot = tgui::DataIO::parse(partiallyReadStream);
+        REQUIRE(partialRoot->children.size() == 1);
+        REQUIRE(partialRoot->children[0]->name == "Child");
+
+        REQUIRE_THROWS_AS(tgui::DataIO::parse(tgui::CharStringView{"A {\nB = ;\n}"}), tgui::Exception);
+
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+        SECTION("Benchmark")
+        {
+            std::string largeContents;
+            for (unsigned int i = 0; i < 1000; ++i)
+            {
+                largeContents += "Button.Button" + std::to_string(i) + " {\n"
+                                 "    Position = (" + std::to_string(i) + ", 20);\n"
+                                 "    Size = (100, 30);\n"
+                                 "    Text = \"Button " + std::to_string(i) + "\";\n"
+                                 "    Renderer { TextColor = rgb(60, 60, 60); Borders = (1, 1, 1, 1); }\n"
+                                 "}\n";
+            }
+
+            BENCHMARK("parse 1000 widgets from stream")
+            {
+                std::stringstream largeStream{largeContents};
+                return tgui::DataIO::parse(largeStream);
+            };
+
+            BENCHMARK("parse 1000 widgets from memory")
+            {
+                return tgui::DataIO::parse(tgui::CharStringView{largeContents.data(), largeContents.size()});
+            };
+        }
+#endif
+    }
 }
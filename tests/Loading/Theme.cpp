@@ -45,6 +45,36 @@ TEST_CASE("[Theme]")
             REQUIRE_NOTHROW(theme2->getRenderer("CheckBox"));
         }
 
+        SECTION("Values are deserialized")
+        {
+            tgui::Theme theme{"resources/Black.txt"};
+
+            const auto& properties = theme.getRenderer("ChildWindow")->propertyValuePairs.getMap();
+            REQUIRE(properties.at("TextureTitleBar").getType() == tgui::ObjectConverter::Type::Texture);
+            REQUIRE(properties.at("Borders").getType() == tgui::ObjectConverter::Type::Outline);
+            REQUIRE(properties.at("DistanceToSide").getType() == tgui::ObjectConverter::Type::Number);
+            REQUIRE(properties.at("CloseButton").getType() == tgui::ObjectConverter::Type::RendererData);
+
+            // Nested renderers are deserialized as well
+            tgui::ObjectConverter closeButton = properties.at("CloseButton");
+            const auto& buttonProperties = closeButton.getRenderer()->propertyValuePairs.getMap();
+            REQUIRE(!buttonProperties.empty());
+            for (const auto& pair : buttonProperties)
+                REQUIRE(pair.second.getType() != tgui::ObjectConverter::Type::String);
+
+            REQUIRE(theme.getGlobalProperty("TextColor").getType() == tgui::ObjectConverter::Type::Color);
+
+            // Copies of the theme share the values until they are changed
+            tgui::Theme themeCopy{theme};
+            REQUIRE(themeCopy.getRenderer("ChildWindow")->propertyValuePairs.isStorageShared());
+            REQUIRE(&themeCopy.getRenderer("ChildWindow")->propertyValuePairs.getMap() == &properties);
+
+            tgui::ChildWindowRenderer(themeCopy.getRenderer("ChildWindow")).setDistanceToSide(8);
+            REQUIRE(&themeCopy.getRenderer("ChildWindow")->propertyValuePairs.getMap() != &properties);
+            REQUIRE(tgui::ChildWindowRenderer(theme.getRenderer("ChildWindow")).getDistanceToSide() == 5);
+            REQUIRE(tgui::ChildWindowRenderer(themeCopy.getRenderer("ChildWindow")).getDistanceToSide() == 8);
+        }
+
         SECTION("nonexistent file")
         {
             REQUIRE_THROWS_AS(tgui::Theme("nonexistent_file"), tgui::Exception);
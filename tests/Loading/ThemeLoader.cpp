@@ -24,6 +24,10 @@
 
 #include "Tests.hpp"
 
+#if !TGUI_BUILD_AS_CXX_MODULE
+    #include <TGUI/Loading/ImageLoader.hpp>
+#endif
+
 // Ignore warning "C4503: decorated name length exceeded, name was truncated" in Visual Studio
 #if defined _MSC_VER
     #pragma warning(disable : 4503)
@@ -110,6 +114,51 @@ TEST_CASE("[ThemeLoader]")
         REQUIRE(properties["ListBox"] == "{\nBackgroundColor = Cyan;\n\nScrollbar {\n    TrackColor = Black;\n}\n}");
     }
 
+    SECTION("binary cache")
+    {
+        loader->saveBinaryCache("resources/Black.txt", "ThemeBinaryCache.bin");
+        const auto originalCache = loader->getPropertiesCache()["resources/Black.txt"];
+
+        tgui::DefaultThemeLoader::flushCache();
+        REQUIRE(loader->loadBinaryCache("resources/Black.txt", "ThemeBinaryCache.bin"));
+        REQUIRE(loader->getPropertiesCache().size() == 1);
+        REQUIRE(loader->getPropertiesCache()["resources/Black.txt"] == originalCache);
+        REQUIRE(loader->getGlobalProperties("resources/Black.txt").size() > 0);
+
+        loader->saveBinaryCache("resources/ThemeNested.txt", "ThemeBinaryCache.bin");
+        tgui::DefaultThemeLoader::flushCache();
+        REQUIRE(loader->loadBinaryCache("resources/ThemeNested.txt", "ThemeBinaryCache.bin"));
+        REQUIRE(loader->load("resources/ThemeNested.txt", "ComboBox1").at("ListBox") == "{\nBackgroundColor = White;\nScrollbar = {\nThumbColor = Green;\nTrackColor = Red;\n};\n}");
+
+        // The cache isn't used when it was created from a different theme file or when it isn't a valid cache file
+        tgui::DefaultThemeLoader::flushCache();
+        REQUIRE(!loader->loadBinaryCache("resources/ThemeButton1.txt", "ThemeBinaryCache.bin"));
+        REQUIRE(!loader->loadBinaryCache("resources/ThemeNested.txt", "resources/ThemeButton1.txt"));
+        REQUIRE(!loader->loadBinaryCache("resources/ThemeNested.txt", "resources/nonexistent.bin"));
+        REQUIRE(loader->getPropertiesCache().size() == 0);
+    }
+
+    SECTION("image preloading")
+    {
+        tgui::ImageLoader::clearPreloadedFiles();
+
+        REQUIRE(!tgui::DefaultThemeLoader::isImagePreloadingEnabled());
+        tgui::DefaultThemeLoader::setImagePreloadingEnabled(true);
+        REQUIRE(tgui::DefaultThemeLoader::isImagePreloadingEnabled());
+
+        // All textures in the theme use the same image
+        loader->preload("resources/Black.txt");
+        REQUIRE(tgui::ImageLoader::getPreloadedFilesCount() == 1);
+
+        tgui::Vector2u imageSize;
+        REQUIRE(tgui::ImageLoader::loadFromFile((tgui::getResourcePath() / "resources/Black.png").asString(), imageSize) != nullptr);
+        REQUIRE(imageSize.x > 0);
+        REQUIRE(imageSize.y > 0);
+        REQUIRE(tgui::ImageLoader::getPreloadedFilesCount() == 0);
+
+        tgui::DefaultThemeLoader::setImagePreloadingEnabled(false);
+    }
+
     SECTION("cache")
     {
         REQUIRE(loader->getPropertiesCache().size() == 0);
@@ -138,4 +138,61 @@ TEST_CASE("[Signal]")
         signal.emit(nullptr);
         REQUIRE(x == 5);
     }
+
+    SECTION("Connect and disconnect during emit")
+    {
+        tgui::Signal signal{"Test"};
+        std::vector<int> calls;
+        unsigned int id2 = 0;
+        unsigned int id4 = 0;
+        signal.connect([&]{
+            calls.push_back(1);
+            signal.disconnect(id2);
+            id4 = signal.connect([&]{ calls.push_back(4); });
+        });
+        id2 = signal.connect([&]{ calls.push_back(2); });
+        const unsigned int id3 = signal.connect([&]{ calls.push_back(3); signal.disconnectAll(); });
+
+        // Changes made by the handlers only take effect the next time the signal is emitted
+        REQUIRE(signal.emit(nullptr));
+        REQUIRE(calls == std::vector<int>{1, 2, 3});
+        REQUIRE(!signal.disconnect(id2));
+        REQUIRE(!signal.disconnect(id3));
+        REQUIRE(!signal.disconnect(id4));
+        REQUIRE(!signal.emit(nullptr));
+
+        calls.clear();
+        signal.connect([&]{ calls.push_back(1); });
+        id2 = signal.connect([&]{ calls.push_back(2); });
+        signal.connect([&]{ calls.push_back(3); });
+        REQUIRE(signal.disconnect(id2));
+        REQUIRE(signal.emit(nullptr));
+        REQUIRE(calls == std::vector<int>{1, 3});
+    }
+
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+    SECTION("Benchmark")
+    {
+        tgui::SignalFloat signal{"Test"};
+        float total = 0;
+
+        BENCHMARK("emit without handlers")
+        {
+            return signal.emit(widget.get(), 1);
+        };
+
+        signal.connect([&](float value){ total += value; });
+        BENCHMARK("emit with 1 handler")
+        {
+            return signal.emit(widget.get(), 1);
+        };
+
+        for (unsigned int i = 1; i < 8; ++i)
+            signal.connect([&](float value){ total += value; });
+        BENCHMARK("emit with 8 handlers")
+        {
+            return signal.emit(widget.get(), 1);
+        };
+    }
+#endif
 }
@@ -28,6 +28,9 @@
     #include <TGUI/SvgImage.hpp>
 #endif
 
+#include <chrono>
+#include <thread>
+
 TEST_CASE("[SvgImage]")
 {
     SECTION("Empty image")
@@ -54,6 +57,77 @@ TEST_CASE("[SvgImage]")
         REQUIRE(tgui::Vector2u{texture->getSize()} == tgui::Vector2u{100, 100});
     }
 
+    SECTION("Raster cache")
+    {
+        tgui::SvgImage::clearRasterCache();
+        REQUIRE(tgui::SvgImage::getRasterCacheMemoryUsage() == 0);
+
+        // Sprites showing the same image at the same size share the texture
+        const tgui::Texture texture{"resources/SFML.svg"};
+        tgui::Sprite sprite1{texture};
+        tgui::Sprite sprite2{texture};
+        const auto defaultSizeTexture = sprite1.getSvgTexture();
+        REQUIRE(sprite2.getSvgTexture() == defaultSizeTexture);
+        REQUIRE(defaultSizeTexture->getSize() == tgui::Vector2u{130, 130});
+        REQUIRE(tgui::SvgImage::getRasterCacheMemoryUsage() == 130 * 130 * 4);
+
+        sprite1.setSize({100, 100});
+        sprite2.setSize({50, 50});
+        REQUIRE(sprite1.getSvgTexture()->getSize() == tgui::Vector2u{100, 100});
+        REQUIRE(sprite2.getSvgTexture()->getSize() == tgui::Vector2u{50, 50});
+        REQUIRE(tgui::SvgImage::getRasterCacheMemoryUsage() == (130 * 130 + 100 * 100 + 50 * 50) * 4);
+
+        SECTION("Memory budget")
+        {
+            const std::size_t oldBudget = tgui::SvgImage::getRasterCacheMemoryBudget();
+
+            // The least recently used image is removed from the cache, the textures used by sprites remain valid
+            tgui::SvgImage::setRasterCacheMemoryBudget((100 * 100 + 50 * 50) * 4);
+            REQUIRE(tgui::SvgImage::getRasterCacheMemoryBudget() == (100 * 100 + 50 * 50) * 4);
+            REQUIRE(tgui::SvgImage::getRasterCacheMemoryUsage() == (100 * 100 + 50 * 50) * 4);
+
+            // The most recently used image is kept even when it doesn't fit within the budget on its own
+            tgui::Sprite sprite3{texture};
+            REQUIRE(sprite3.getSvgTexture() != defaultSizeTexture);
+            REQUIRE(sprite3.getSvgTexture()->getSize() == tgui::Vector2u{130, 130});
+            REQUIRE(tgui::SvgImage::getRasterCacheMemoryUsage() == 130 * 130 * 4);
+
+            tgui::SvgImage::setRasterCacheMemoryBudget(oldBudget);
+        }
+
+        SECTION("Async rasterization")
+        {
+            REQUIRE(!tgui::SvgImage::isAsyncRasterizationEnabled());
+            tgui::SvgImage::setAsyncRasterizationEnabled(true);
+            REQUIRE(tgui::SvgImage::isAsyncRasterizationEnabled());
+
+            // The closest size is shown while the requested size is being rasterized
+            const unsigned int svgTextureVersion = tgui::getBackend()->getSvgTextureVersion();
+            sprite1.setSize({80, 80});
+            REQUIRE(sprite1.isSvgRasterizationPending());
+            REQUIRE(sprite1.getSvgTexture()->getSize() == tgui::Vector2u{100, 100});
+
+            const auto startTime = std::chrono::steady_clock::now();
+            while (!tgui::getBackend()->updatePendingSvgSprites() && (std::chrono::steady_clock::now() - startTime < std::chrono::seconds(10)))
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+            REQUIRE(!sprite1.isSvgRasterizationPending());
+            REQUIRE(sprite1.getSvgTexture()->getSize() == tgui::Vector2u{80, 80});
+            REQUIRE(tgui::getBackend()->getSvgTextureVersion() != svgTextureVersion);
+
+            // An image that isn't cached at any size is still rasterized immediately
+            tgui::SvgImage::clearRasterCache();
+            sprite2.setSize({60, 60});
+            REQUIRE(!sprite2.isSvgRasterizationPending());
+            REQUIRE(sprite2.getSvgTexture()->getSize() == tgui::Vector2u{60, 60});
+
+            tgui::SvgImage::setAsyncRasterizationEnabled(false);
+        }
+
+        tgui::SvgImage::clearRasterCache();
+        REQUIRE(tgui::SvgImage::getRasterCacheMemoryUsage() == 0);
+    }
+
     SECTION("Drawing svg")
     {
         auto picture = tgui::Picture::create("resources/SFML.svg");
@@ -138,4 +138,93 @@ TEST_CASE("[Text]")
             REQUIRE(text.getSize().y == text3.getSize().y);
         }
     }
+
+    SECTION("CharacterPosition")
+    {
+        text.setCharacterSize(20);
+        text.setFont("resources/DejaVuSans.ttf");
+        text.setString("AV\tb\r\nxyz");
+
+        const tgui::Font& font = text.getFont();
+        const float spaceWidth = font.getGlyph(U' ', 20, false).advance;
+        REQUIRE(text.findCharacterPos(0) == tgui::Vector2f(0, 0));
+        REQUIRE(text.findCharacterPos(1).x == font.getGlyph(U'A', 20, false).advance);
+        REQUIRE(text.findCharacterPos(2).x == Approx(text.findCharacterPos(1).x + font.getKerning(U'A', U'V', 20, false) + font.getGlyph(U'V', 20, false).advance));
+        REQUIRE(text.findCharacterPos(3).x == Approx(text.findCharacterPos(2).x + 4 * spaceWidth + font.getKerning(U'V', U'\t', 20, false)));
+        REQUIRE(text.findCharacterPos(5) == text.findCharacterPos(4));
+        REQUIRE(text.findCharacterPos(6) == tgui::Vector2f(0, font.getLineSpacing(20)));
+        REQUIRE(text.findCharacterPos(100) == text.findCharacterPos(9));
+
+        // Positions are recalculated when the text changes
+        const float oldPos = text.findCharacterPos(2).x;
+        text.setString("AAV");
+        REQUIRE(text.findCharacterPos(2).x > oldPos);
+        text.setCharacterSize(10);
+        REQUIRE(text.findCharacterPos(2).x < oldPos);
+        text.setStyle(tgui::TextStyle::Bold);
+        REQUIRE(text.findCharacterPos(3).x > text.findCharacterPos(2).x);
+    }
+
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+    SECTION("Benchmark")
+    {
+        text.setCharacterSize(16);
+        text.setFont("resources/DejaVuSans.ttf");
+
+        tgui::String str;
+        for (unsigned int i = 0; i < 200; ++i)
+            str += U"The quick brown fox jumps over the lazy dog. AVAWAY To.\n";
+        text.setString(str);
+
+        BENCHMARK_ADVANCED("findCharacterPos after text change")(Catch::Benchmark::Chronometer meter)
+        {
+            meter.measure([&](int i) {
+                text.setString((i % 2) ? str : str + U"x");
+                return text.findCharacterPos(str.length() / 2);
+            });
+        };
+
+        BENCHMARK("findCharacterPos of each character")
+        {
+            float total = 0;
+            for (std::size_t i = 0; i < str.length(); i += 97)
+                total += text.findCharacterPos(i).x;
+            return total;
+        };
+
+        const tgui::Font font = text.getFont();
+        BENCHMARK_ADVANCED("getKerning with empty cache")(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<std::shared_ptr<tgui::BackendFont>> fonts(static_cast<std::size_t>(meter.runs()));
+            for (auto& backendFont : fonts)
+            {
+                backendFont = tgui::getBackend()->createFont();
+                (void)backendFont->loadFromFile("resources/DejaVuSans.ttf");
+                for (char32_t c = U'A'; c <= U'Z'; ++c)
+                    (void)backendFont->getGlyph(c, 16, false);
+            }
+
+            meter.measure([&](int i) {
+                float total = 0;
+                for (char32_t first = U'A'; first <= U'Z'; ++first)
+                {
+                    for (char32_t second = U'A'; second <= U'Z'; ++second)
+                        total += fonts[static_cast<std::size_t>(i)]->getKerning(first, second, 16, false);
+                }
+                return total;
+            });
+        };
+
+        BENCHMARK("getKerning with filled cache")
+        {
+            float total = 0;
+            for (char32_t first = U'A'; first <= U'Z'; ++first)
+            {
+                for (char32_t second = U'A'; second <= U'Z'; ++second)
+                    total += font.getKerning(first, second, 16, false);
+            }
+            return total;
+        };
+    }
+#endif
 }
@@ -33,6 +33,9 @@
     #include <TGUI/TextureManager.hpp>
 #endif
 
+#include <chrono>
+#include <thread>
+
 #if TGUI_HAS_BACKEND_SFML_GRAPHICS
     #if TGUI_BUILD_AS_CXX_MODULE
         import tgui.backend.renderer.sfml_graphics;
@@ -128,6 +131,57 @@ TEST_CASE("[Texture]")
         }
     }
 
+    SECTION("loadAsync")
+    {
+        const auto waitForAsyncLoads = []{
+            const auto startTime = std::chrono::steady_clock::now();
+            while ((tgui::TextureManager::getAsyncLoadsCount() > 0)
+                && (std::chrono::steady_clock::now() - startTime < std::chrono::seconds(10)))
+            {
+                tgui::TextureManager::finishAsyncLoads();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        };
+
+        // Widgets from earlier tests can still be using images, so the count isn't necessarily 0
+        const std::size_t cachedImagesCount = tgui::TextureManager::getCachedImagesCount();
+        {
+            unsigned int count = 0;
+            tgui::Texture texture1;
+            tgui::Texture texture2;
+            tgui::Texture::loadAsync("resources/image.png", [&](const tgui::Texture& texture){ texture1 = texture; count++; });
+            tgui::Texture::loadAsync("resources/image.png", [&](const tgui::Texture& texture){ texture2 = texture; count++; }, {10, 5, 40, 30});
+
+            // Both requests are served by a single decoding job
+            REQUIRE(count == 0);
+            REQUIRE(tgui::TextureManager::getAsyncLoadsCount() == 1);
+
+            waitForAsyncLoads();
+            REQUIRE(count == 2);
+            REQUIRE(tgui::TextureManager::getAsyncLoadsCount() == 0);
+
+            REQUIRE(texture1.getId() == "resources/image.png");
+            REQUIRE(texture1.getData() != nullptr);
+            REQUIRE(texture1.getData()->backendTexture != nullptr);
+            REQUIRE(texture1.getImageSize() == tgui::Vector2u(50, 50));
+            REQUIRE(texture2.getData() == texture1.getData());
+            REQUIRE(texture2.getPartRect() == tgui::UIntRect(10, 5, 40, 30));
+
+            // The callback is called immediately when the image was already loaded
+            tgui::Texture texture3;
+            tgui::Texture::loadAsync("resources/image.png", [&](const tgui::Texture& texture){ texture3 = texture; });
+            REQUIRE(tgui::TextureManager::getAsyncLoadsCount() == 0);
+            REQUIRE(texture3.getData() == texture1.getData());
+        }
+
+        REQUIRE(tgui::TextureManager::getCachedImagesCount() == cachedImagesCount);
+
+        bool failed = false;
+        tgui::Texture::loadAsync("resources/nonexistent.png", [&](const tgui::Texture& texture){ failed = (texture.getData() == nullptr); });
+        waitForAsyncLoads();
+        REQUIRE(failed);
+    }
+
     SECTION("Copy and destruct")
     {
         unsigned int copyCount = 0;
@@ -246,6 +300,115 @@ TEST_CASE("[Texture]")
     }
 #endif
 
+    SECTION("Updating region")
+    {
+        auto pixels = std::make_unique<std::uint8_t[]>(2 * 2 * 4);
+        for (unsigned int i = 0; i < 2 * 2 * 4; ++i)
+            pixels[i] = 255;
+
+        tgui::BackendTexture backendTexture;
+        REQUIRE(backendTexture.load({2, 2}, std::move(pixels), true));
+        REQUIRE(!backendTexture.isTransparentPixel({1, 0}));
+
+        // The base class has no texture to update, but it does update the stored pixels
+        const std::uint8_t newPixels[] = {255, 255, 255, 0};
+        REQUIRE(!backendTexture.updateTextureRegion({1, 0, 1, 1}, newPixels));
+        REQUIRE(!backendTexture.isTransparentPixel({0, 0}));
+        REQUIRE(backendTexture.isTransparentPixel({1, 0}));
+        REQUIRE(!backendTexture.isTransparentPixel({0, 1}));
+        REQUIRE(!backendTexture.isTransparentPixel({1, 1}));
+
+        const std::uint8_t newAlphaPixels[] = {0, 255};
+        REQUIRE(!backendTexture.updateAlphaTextureRegion({0, 1, 2, 1}, newAlphaPixels));
+        REQUIRE(backendTexture.isTransparentPixel({0, 1}));
+        REQUIRE(!backendTexture.isTransparentPixel({1, 1}));
+    }
+
+    SECTION("Pixel storage")
+    {
+        // Image of 5x3 pixels where only the pixels on the diagonal are transparent
+        const auto createPixels = []{
+            auto pixels = std::make_unique<std::uint8_t[]>(5 * 3 * 4);
+            for (unsigned int i = 0; i < 5 * 3; ++i)
+            {
+                pixels[i * 4 + 0] = 255;
+                pixels[i * 4 + 1] = 255;
+                pixels[i * 4 + 2] = 255;
+                pixels[i * 4 + 3] = ((i % 5) == (i / 5)) ? 0 : 255;
+            }
+            return pixels;
+        };
+
+        const auto checkTransparentPixels = [](const tgui::BackendTexture& backendTexture){
+            for (unsigned int y = 0; y < 3; ++y)
+            {
+                for (unsigned int x = 0; x < 5; ++x)
+                    REQUIRE(backendTexture.isTransparentPixel({x, y}) == (x == y));
+            }
+        };
+
+        REQUIRE(tgui::BackendTexture::getDefaultPixelStorage() == tgui::BackendTexture::PixelStorage::Full);
+
+        SECTION("Full")
+        {
+            tgui::BackendTexture backendTexture;
+            REQUIRE(backendTexture.getPixelStorage() == tgui::BackendTexture::PixelStorage::Full);
+            REQUIRE(backendTexture.load({5, 3}, createPixels(), true));
+            REQUIRE(backendTexture.getPixels() != nullptr);
+            REQUIRE(backendTexture.getPixelMemoryUsage() == 5 * 3 * 4);
+            REQUIRE(backendTexture.getPixelMemorySaved() == 0);
+            checkTransparentPixels(backendTexture);
+
+            // Reducing the storage of a loaded texture frees the pixels
+            backendTexture.setPixelStorage(tgui::BackendTexture::PixelStorage::AlphaMask);
+            REQUIRE(backendTexture.getPixels() == nullptr);
+            REQUIRE(backendTexture.getPixelMemoryUsage() == 2);
+            REQUIRE(backendTexture.getPixelMemorySaved() == 5 * 3 * 4 - 2);
+            checkTransparentPixels(backendTexture);
+        }
+
+        SECTION("AlphaMask")
+        {
+            tgui::BackendTexture::setDefaultPixelStorage(tgui::BackendTexture::PixelStorage::AlphaMask);
+            tgui::BackendTexture backendTexture;
+            tgui::BackendTexture::setDefaultPixelStorage(tgui::BackendTexture::PixelStorage::Full);
+
+            REQUIRE(backendTexture.getPixelStorage() == tgui::BackendTexture::PixelStorage::AlphaMask);
+            REQUIRE(backendTexture.load({5, 3}, createPixels(), true));
+            REQUIRE(backendTexture.getPixels() == nullptr);
+            REQUIRE(backendTexture.getPixelMemoryUsage() == 2);
+            REQUIRE(backendTexture.getPixelMemorySaved() == 5 * 3 * 4 - 2);
+            checkTransparentPixels(backendTexture);
+
+            // The mask is updated together with the texture
+            const std::uint8_t newPixels[] = {255, 255, 255, 255, 255, 255, 255, 0};
+            REQUIRE(!backendTexture.updateTextureRegion({0, 2, 2, 1}, newPixels));
+            REQUIRE(!backendTexture.isTransparentPixel({0, 2}));
+            REQUIRE(backendTexture.isTransparentPixel({1, 2}));
+            REQUIRE(backendTexture.isTransparentPixel({2, 2}));
+            REQUIRE(!backendTexture.isTransparentPixel({3, 2}));
+        }
+
+        SECTION("None")
+        {
+            tgui::BackendTexture backendTexture;
+            backendTexture.setPixelStorage(tgui::BackendTexture::PixelStorage::None);
+            REQUIRE(backendTexture.load({5, 3}, createPixels(), true));
+            REQUIRE(backendTexture.getPixels() == nullptr);
+            REQUIRE(backendTexture.getPixelMemoryUsage() == 0);
+            REQUIRE(backendTexture.getPixelMemorySaved() == 5 * 3 * 4);
+            REQUIRE(!backendTexture.isTransparentPixel({0, 0}));
+        }
+
+        SECTION("loadTextureOnly")
+        {
+            tgui::BackendTexture backendTexture;
+            REQUIRE(backendTexture.loadTextureOnly({5, 3}, createPixels().get(), true));
+            REQUIRE(backendTexture.getPixelMemoryUsage() == 0);
+            REQUIRE(backendTexture.getPixelMemorySaved() == 0);
+        }
+    }
+
     SECTION("BackendTextureLoader")
     {
         unsigned int count = 0;
@@ -30,6 +30,12 @@
 
 TEST_CASE("[TextureManager]")
 {
+    // Widgets from earlier tests may still be in the gui and could be sharing the images loaded below
+    globalGui->removeAllWidgets();
+
+    // Images can also be kept alive elsewhere (e.g. by the theme), so the count isn't necessarily 0
+    const std::size_t cachedImagesCount = tgui::TextureManager::getCachedImagesCount();
+
     tgui::Texture texture;
     REQUIRE(tgui::TextureManager::getTexture(texture, "NonExistent.png", true) == nullptr);
 
@@ -56,4 +62,123 @@ TEST_CASE("[TextureManager]")
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
 
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData3));
+
+    SECTION("Memory budget and statistics")
+    {
+        REQUIRE(tgui::TextureManager::getMemoryBudget() == 0);
+        tgui::TextureManager::resetStatistics();
+
+        std::size_t imageMemoryUsage = 0;
+        {
+            tgui::Texture texture4{"resources/image.png"};
+            tgui::Texture texture5{"resources/image.png"};
+
+            const auto statistics = tgui::TextureManager::getStatistics();
+            REQUIRE(statistics.misses == 1);
+            REQUIRE(statistics.hits == 1);
+            REQUIRE(statistics.evictions == 0);
+            REQUIRE(statistics.gpuMemoryUsage == texture4.getImageSize().x * texture4.getImageSize().y * 4);
+            REQUIRE(statistics.releasedImages == 0);
+            imageMemoryUsage = statistics.gpuMemoryUsage + statistics.cpuMemoryUsage;
+        }
+
+        // Without a budget, the image is removed as soon as it is no longer used
+        REQUIRE(tgui::TextureManager::getCachedImagesCount() == cachedImagesCount);
+        REQUIRE(tgui::TextureManager::getStatistics().evictions == 1);
+        REQUIRE(tgui::TextureManager::getStatistics().gpuMemoryUsage == 0);
+        REQUIRE(tgui::TextureManager::getStatistics().cpuMemoryUsage == 0);
+
+        // With a budget, released images are kept until the budget is exceeded
+        tgui::TextureManager::setMemoryBudget(imageMemoryUsage);
+        REQUIRE(tgui::TextureManager::getMemoryBudget() == imageMemoryUsage);
+        {
+            tgui::Texture texture4{"resources/image.png"};
+        }
+        REQUIRE(tgui::TextureManager::getCachedImagesCount() == cachedImagesCount + 1);
+        REQUIRE(tgui::TextureManager::getStatistics().releasedImages == 1);
+        REQUIRE(tgui::TextureManager::getStatistics().releasedMemoryUsage == imageMemoryUsage);
+
+        {
+            tgui::Texture texture4{"resources/image.png"};
+            REQUIRE(tgui::TextureManager::getStatistics().misses == 2);
+            REQUIRE(tgui::TextureManager::getStatistics().hits == 2);
+            REQUIRE(tgui::TextureManager::getStatistics().releasedImages == 0);
+            REQUIRE(tgui::TextureManager::getStatistics().releasedMemoryUsage == 0);
+
+            // Loading the image with different settings exceeds the budget, but images in use are never removed
+            tgui::Texture texture5{"resources/image.png", {}, {}, false};
+            REQUIRE(tgui::TextureManager::getStatistics().misses == 3);
+            REQUIRE(tgui::TextureManager::getStatistics().gpuMemoryUsage + tgui::TextureManager::getStatistics().cpuMemoryUsage == 2 * imageMemoryUsage);
+        }
+
+        // Only one of the released images fits within the budget
+        REQUIRE(tgui::TextureManager::getCachedImagesCount() == cachedImagesCount + 1);
+        REQUIRE(tgui::TextureManager::getStatistics().releasedImages == 1);
+        REQUIRE(tgui::TextureManager::getStatistics().evictions == 2);
+
+        tgui::TextureManager::removeReleasedImages();
+        REQUIRE(tgui::TextureManager::getCachedImagesCount() == cachedImagesCount);
+        REQUIRE(tgui::TextureManager::getStatistics().releasedImages == 0);
+        REQUIRE(tgui::TextureManager::getStatistics().evictions == 3);
+
+        tgui::TextureManager::resetStatistics();
+        REQUIRE(tgui::TextureManager::getStatistics().hits == 0);
+        REQUIRE(tgui::TextureManager::getStatistics().misses == 0);
+        REQUIRE(tgui::TextureManager::getStatistics().evictions == 0);
+
+        tgui::TextureManager::setMemoryBudget(0);
+    }
+
+    SECTION("Changing the pixel storage of a loaded image")
+    {
+        tgui::Texture texture4{"resources/image.png"};
+        const auto backendTexture = texture4.getData()->backendTexture;
+        REQUIRE(tgui::TextureManager::getStatistics().cpuMemoryUsage == backendTexture->getPixelMemoryUsage());
+
+        backendTexture->setPixelStorage(tgui::BackendTexture::PixelStorage::AlphaMask);
+        REQUIRE(tgui::TextureManager::getStatistics().cpuMemoryUsage == backendTexture->getPixelMemoryUsage());
+
+        backendTexture->setPixelStorage(tgui::BackendTexture::PixelStorage::None);
+        REQUIRE(tgui::TextureManager::getStatistics().cpuMemoryUsage == 0);
+    }
+
+    SECTION("Released image uses its current pixel storage for the memory budget")
+    {
+        {
+            tgui::Texture texture4{"resources/image.png"};
+            const auto backendTexture = texture4.getData()->backendTexture;
+            const auto statistics = tgui::TextureManager::getStatistics();
+            tgui::TextureManager::setMemoryBudget(statistics.gpuMemoryUsage + statistics.cpuMemoryUsage - backendTexture->getPixelMemoryUsage());
+            REQUIRE(backendTexture->getPixelMemoryUsage() > 0);
+
+            // Without the pixels, the image fits in the budget and can be kept after being released
+            backendTexture->setPixelStorage(tgui::BackendTexture::PixelStorage::None);
+        }
+        REQUIRE(tgui::TextureManager::getCachedImagesCount() == cachedImagesCount + 1);
+        REQUIRE(tgui::TextureManager::getStatistics().releasedImages == 1);
+
+        tgui::TextureManager::setMemoryBudget(0);
+        REQUIRE(tgui::TextureManager::getCachedImagesCount() == cachedImagesCount);
+    }
+
+    SECTION("Released images are destroyed together with the backend")
+    {
+        tgui::TextureManager::setMemoryBudget(1024 * 1024);
+        {
+            tgui::Texture texture4{"resources/image.png"};
+        }
+        REQUIRE(tgui::TextureManager::getCachedImagesCount() == cachedImagesCount + 1);
+
+        // Resetting the backend also resets the global font and theme, so they have to be restored afterwards
+        const auto backend = tgui::getBackend();
+        const tgui::Font globalFont = tgui::Font::getGlobalFont();
+        const auto defaultTheme = tgui::Theme::getDefault();
+        tgui::setBackend(nullptr);
+        REQUIRE(tgui::TextureManager::getCachedImagesCount() == cachedImagesCount);
+
+        tgui::setBackend(backend);
+        tgui::Font::setGlobalFont(globalFont);
+        tgui::Theme::setDefault(defaultTheme);
+        tgui::TextureManager::setMemoryBudget(0);
+    }
 }
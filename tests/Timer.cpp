@@ -168,4 +168,77 @@ TEST_CASE("[Timer]")
         duration = tgui::Timer::getNextScheduledTime();
         REQUIRE(!duration); // No active timers
     }
+
+    SECTION("Many timers")
+    {
+        std::vector<unsigned int> triggerCounts(100, 0);
+        std::vector<std::shared_ptr<tgui::Timer>> timers;
+        for (unsigned int i = 0; i < 100; ++i)
+            timers.push_back(tgui::Timer::create([&triggerCounts,i]{ ++triggerCounts[i]; }, std::chrono::milliseconds(((i * 37) % 100) + 1)));
+
+        // Disabling timers in a random order shouldn't affect the other timers
+        for (unsigned int i = 1; i < 100; i += 3)
+            timers[(i * 7) % 100]->setEnabled(false);
+
+        REQUIRE(*tgui::Timer::getNextScheduledTime() == std::chrono::milliseconds(1));
+        for (unsigned int i = 0; i < 100; ++i)
+            tgui::Timer::updateTime(std::chrono::milliseconds(1));
+
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            if (timers[i]->isEnabled())
+                REQUIRE(triggerCounts[i] == 100 / (((i * 37) % 100) + 1));
+            else
+                REQUIRE(triggerCounts[i] == 0);
+        }
+
+        for (auto& timer : timers)
+            timer->setEnabled(false);
+        REQUIRE(!tgui::Timer::getNextScheduledTime());
+    }
+
+    SECTION("Starting and stopping timers from callback")
+    {
+        std::shared_ptr<tgui::Timer> timer2;
+        auto timer1 = tgui::Timer::create([&]{ ++count; timer2->setEnabled(false); tgui::Timer::scheduleCallback(callback); }, 100);
+        timer2 = tgui::Timer::create(callback, 100);
+
+        tgui::Timer::updateTime(std::chrono::milliseconds(100));
+        REQUIRE(count == 1); // The second timer was stopped and the scheduled callback wasn't triggered yet
+
+        tgui::Timer::updateTime(tgui::Duration());
+        REQUIRE(count == 2);
+
+        timer1->setEnabled(false);
+    }
+
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+    SECTION("Benchmark")
+    {
+        std::vector<std::shared_ptr<tgui::Timer>> timers;
+        for (unsigned int i = 0; i < 10000; ++i)
+            timers.push_back(tgui::Timer::create(callback, std::chrono::milliseconds(500 + (i % 1000))));
+
+        BENCHMARK("updateTime with 10000 active timers")
+        {
+            return tgui::Timer::updateTime(std::chrono::milliseconds(1));
+        };
+
+        BENCHMARK("getNextScheduledTime with 10000 active timers")
+        {
+            return tgui::Timer::getNextScheduledTime();
+        };
+
+        std::size_t index = 0;
+        BENCHMARK("setEnabled with 10000 active timers")
+        {
+            index = (index + 7919) % timers.size();
+            timers[index]->setEnabled(false);
+            timers[index]->setEnabled(true);
+        };
+
+        for (auto& timer : timers)
+            timer->setEnabled(false);
+    }
+#endif
 }
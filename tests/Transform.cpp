@@ -0,0 +1,119 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+
+TEST_CASE("[Transform]")
+{
+    tgui::Transform transform;
+    transform.translate({10, 20});
+    transform.rotate(30, {5, 5});
+    transform.scale({2, 0.5f});
+
+    SECTION("transformPoint")
+    {
+        REQUIRE(tgui::Transform().transformPoint({3, 4}) == tgui::Vector2f(3, 4));
+        REQUIRE(tgui::Transform().translate({1, 2}).transformPoint({3, 4}) == tgui::Vector2f(4, 6));
+        REQUIRE(tgui::Transform().scale({2, 3}).transformPoint({3, 4}) == tgui::Vector2f(6, 12));
+    }
+
+    SECTION("transformPoints")
+    {
+        SECTION("Points")
+        {
+            // Use an odd amount of points so that the last one isn't part of a pair
+            std::vector<tgui::Vector2f> points;
+            for (int i = 0; i < 7; ++i)
+                points.emplace_back(static_cast<float>(i * 3 - 5), static_cast<float>(i * i));
+
+            std::vector<tgui::Vector2f> output(points.size());
+            transform.transformPoints(points.data(), output.data(), points.size());
+            for (std::size_t i = 0; i < points.size(); ++i)
+            {
+                const tgui::Vector2f expected = transform.transformPoint(points[i]);
+                REQUIRE(output[i].x == Approx(expected.x));
+                REQUIRE(output[i].y == Approx(expected.y));
+            }
+
+            // The points can also be transformed in place
+            transform.transformPoints(points.data(), points.data(), points.size());
+            for (std::size_t i = 0; i < points.size(); ++i)
+                REQUIRE(points[i] == output[i]);
+        }
+
+        SECTION("Vertices")
+        {
+            std::vector<tgui::Vertex> vertices;
+            for (int i = 0; i < 5; ++i)
+            {
+                vertices.emplace_back(tgui::Vector2f{static_cast<float>(i), static_cast<float>(10 - i)},
+                                      tgui::Vertex::Color{static_cast<std::uint8_t>(i), 2, 3, 4},
+                                      tgui::Vector2f{0.5f, static_cast<float>(i) / 4});
+            }
+
+            std::vector<tgui::Vertex> output(vertices.size());
+            transform.transformPoints(vertices.data(), output.data(), vertices.size());
+            for (std::size_t i = 0; i < vertices.size(); ++i)
+            {
+                const tgui::Vector2f expected = transform.transformPoint(vertices[i].position);
+                REQUIRE(output[i].position.x == Approx(expected.x));
+                REQUIRE(output[i].position.y == Approx(expected.y));
+                REQUIRE(output[i].color.red == vertices[i].color.red);
+                REQUIRE(output[i].color.alpha == 4);
+                REQUIRE(output[i].texCoords == vertices[i].texCoords);
+            }
+        }
+
+        SECTION("No points")
+        {
+            transform.transformPoints(static_cast<const tgui::Vector2f*>(nullptr), nullptr, 0);
+        }
+    }
+
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+    SECTION("Benchmark")
+    {
+        std::vector<tgui::Vertex> vertices(10000);
+        for (std::size_t i = 0; i < vertices.size(); ++i)
+            vertices[i].position = {static_cast<float>(i % 100), static_cast<float>(i / 100)};
+
+        std::vector<tgui::Vertex> output(vertices.size());
+        BENCHMARK("transformPoint on 10000 vertices")
+        {
+            for (std::size_t i = 0; i < vertices.size(); ++i)
+            {
+                output[i] = vertices[i];
+                output[i].position = transform.transformPoint(vertices[i].position);
+            }
+            return output.back().position.x;
+        };
+
+        BENCHMARK("transformPoints on 10000 vertices")
+        {
+            transform.transformPoints(vertices.data(), output.data(), vertices.size());
+            return output.back().position.x;
+        };
+    }
+#endif
+}
@@ -460,6 +460,63 @@ TEST_CASE("[Widget]")
             REQUIRE(clonedRenderer->propertyValuePairs["Font"].getFont().getId() == "resources/DejaVuSans.ttf");
         }
 
+        SECTION("Property ids")
+        {
+            const tgui::RendererPropertyId opacityId{"Opacity"};
+            REQUIRE(opacityId.isValid());
+            REQUIRE(opacityId.getName() == "Opacity");
+            REQUIRE(tgui::RendererPropertyId{"Opacity"} == opacityId);
+            REQUIRE(tgui::RendererPropertyId::find("Opacity") == opacityId);
+            REQUIRE(tgui::RendererPropertyId::find("NeverUsedPropertyName") == tgui::RendererPropertyId{});
+            REQUIRE(!tgui::RendererPropertyId{}.isValid());
+
+            // The types of the properties of the renderers are registered when the library is loaded
+            REQUIRE(tgui::RendererPropertyId::find("Opacity").getType() == tgui::ObjectConverter::Type::Number);
+            REQUIRE(tgui::RendererPropertyId::find("TextColor").getType() == tgui::ObjectConverter::Type::Color);
+            REQUIRE(tgui::RendererPropertyId{"UntypedProperty"}.getType() == tgui::ObjectConverter::Type::None);
+            REQUIRE(tgui::RendererPropertyId("ConflictingProperty", tgui::ObjectConverter::Type::Color).getType() == tgui::ObjectConverter::Type::Color);
+            REQUIRE(tgui::RendererPropertyId("ConflictingProperty", tgui::ObjectConverter::Type::Number).getType() == tgui::ObjectConverter::Type::None);
+            REQUIRE(tgui::RendererPropertyId("ConflictingProperty", tgui::ObjectConverter::Type::Color).getType() == tgui::ObjectConverter::Type::None);
+
+            tgui::ObjectConverter serializedColor{tgui::String{"rgb(10, 20, 30)"}};
+            REQUIRE(tgui::RendererPropertyId::find("TextColor").deserializeValue(serializedColor));
+            REQUIRE(serializedColor.getType() == tgui::ObjectConverter::Type::Color);
+            REQUIRE(serializedColor.getColor() == tgui::Color{10, 20, 30});
+
+            tgui::ObjectConverter invalidColor{tgui::String{"NotAColor"}};
+            REQUIRE(!tgui::RendererPropertyId::find("TextColor").deserializeValue(invalidColor));
+            REQUIRE(invalidColor.getType() == tgui::ObjectConverter::Type::String);
+
+            renderer->setOpacity(0.5f);
+            auto& propertyValuePairs = renderer->getData()->propertyValuePairs;
+            REQUIRE(propertyValuePairs.lookup(opacityId) != nullptr);
+            REQUIRE(propertyValuePairs.lookup(opacityId)->getNumber() == 0.5f);
+            REQUIRE(propertyValuePairs.lookup(tgui::RendererPropertyId{"TextSize"}) == nullptr);
+
+            // Many properties can be added without losing track of them
+            for (unsigned int i = 0; i < 100; ++i)
+                propertyValuePairs["CustomProperty" + tgui::String(i)] = tgui::ObjectConverter{static_cast<float>(i)};
+            for (unsigned int i = 0; i < 100; ++i)
+                REQUIRE(propertyValuePairs.lookup(tgui::RendererPropertyId{"CustomProperty" + tgui::String(i)})->getNumber() == static_cast<float>(i));
+
+            propertyValuePairs.erase("CustomProperty5");
+            REQUIRE(propertyValuePairs.lookup(tgui::RendererPropertyId{"CustomProperty5"}) == nullptr);
+            REQUIRE(propertyValuePairs.lookup(tgui::RendererPropertyId{"CustomProperty6"}) != nullptr);
+
+            // Copies share the values until one of them is changed
+            auto clonedRenderer = renderer->clone();
+            REQUIRE(clonedRenderer->propertyValuePairs.isStorageShared());
+            REQUIRE(clonedRenderer->propertyValuePairs.lookup(opacityId) == propertyValuePairs.lookup(opacityId));
+
+            clonedRenderer->propertyValuePairs[opacityId] = tgui::ObjectConverter{0.25f};
+            REQUIRE(!clonedRenderer->propertyValuePairs.isStorageShared());
+            REQUIRE(!propertyValuePairs.isStorageShared());
+            REQUIRE(clonedRenderer->propertyValuePairs.lookup(opacityId) != propertyValuePairs.lookup(opacityId));
+            REQUIRE(clonedRenderer->propertyValuePairs.lookup(opacityId)->getNumber() == 0.25f);
+            REQUIRE(propertyValuePairs.lookup(opacityId)->getNumber() == 0.5f);
+            REQUIRE(clonedRenderer->propertyValuePairs.size() == propertyValuePairs.size());
+        }
+
         // TODO: Other tests with the renderer class (e.g. sharing and copying a renderer when using multiple widgets)
     }
 
@@ -72,6 +72,36 @@ TEST_CASE("[ChatBox]")
         REQUIRE(chatBox->getLineTextStyle(2) == tgui::TextStyle::Italic);
     }
 
+    SECTION("Adding multiple lines")
+    {
+        chatBox->addLine("Line 1");
+        chatBox->addLines({"Line 2", "Line 3"});
+        chatBox->addLines({"Line 4"}, tgui::Color::Blue, tgui::TextStyle::Italic);
+        REQUIRE(chatBox->getLineAmount() == 4);
+
+        REQUIRE(chatBox->getLine(0) == "Line 1");
+        REQUIRE(chatBox->getLine(1) == "Line 2");
+        REQUIRE(chatBox->getLine(2) == "Line 3");
+        REQUIRE(chatBox->getLine(3) == "Line 4");
+        REQUIRE(chatBox->getLineColor(2) == chatBox->getTextColor());
+        REQUIRE(chatBox->getLineColor(3) == tgui::Color::Blue);
+        REQUIRE(chatBox->getLineTextStyle(3) == tgui::TextStyle::Italic);
+
+        chatBox->setLineLimit(3);
+        chatBox->addLines({"Line 5", "Line 6", "Line 7", "Line 8"});
+        REQUIRE(chatBox->getLineAmount() == 3);
+        REQUIRE(chatBox->getLine(0) == "Line 6");
+        REQUIRE(chatBox->getLine(1) == "Line 7");
+        REQUIRE(chatBox->getLine(2) == "Line 8");
+
+        chatBox->setNewLinesBelowOthers(false);
+        chatBox->addLines({"Line 9", "Line 10"});
+        REQUIRE(chatBox->getLineAmount() == 3);
+        REQUIRE(chatBox->getLine(0) == "Line 10");
+        REQUIRE(chatBox->getLine(1) == "Line 9");
+        REQUIRE(chatBox->getLine(2) == "Line 6");
+    }
+
     SECTION("Removing lines")
     {
         REQUIRE(!chatBox->removeLine(0));
@@ -297,6 +297,183 @@ TEST_CASE("[ListView]")
         REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{ 1 });
         listView->deselectItems();
         REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{ });
+
+        listView->setSelectedItemRange(1, 2);
+        REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{ 1 });
+
+        SECTION("Ranges")
+        {
+            listView->addMultipleItems({{"4,1"}, {"5,1"}, {"6,1"}});
+            listView->setMultiSelect(true);
+
+            listView->setSelectedItemRange(1, 3);
+            REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{ 1, 2, 3 });
+            REQUIRE(listView->getSelectedItemRanges() == std::vector<std::pair<std::size_t, std::size_t>>{{1, 3}});
+
+            listView->setSelectedItemRange(4, 100);
+            REQUIRE(listView->getSelectedItemRanges() == std::vector<std::pair<std::size_t, std::size_t>>{{4, 5}});
+
+            listView->setSelectedItems({ 0, 2, 3, 5 });
+            REQUIRE(listView->getSelectedItemIndex() == 0);
+            REQUIRE(listView->getSelectedItemRanges() == std::vector<std::pair<std::size_t, std::size_t>>{{0, 0}, {2, 3}, {5, 5}});
+
+            // Removing an item shifts the selected items below it
+            listView->removeItem(4);
+            REQUIRE(listView->getSelectedItemRanges() == std::vector<std::pair<std::size_t, std::size_t>>{{0, 0}, {2, 4}});
+            listView->removeItem(3);
+            REQUIRE(listView->getSelectedItemRanges() == std::vector<std::pair<std::size_t, std::size_t>>{{0, 0}, {2, 3}});
+            listView->removeItem(1);
+            REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{ 0, 1, 2 });
+            listView->removeItem(0);
+            REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{ 0, 1 });
+            REQUIRE(listView->getItemCount() == 2);
+        }
+    }
+
+    SECTION("Data provider")
+    {
+        struct Provider : tgui::ListView::DataProvider
+        {
+            std::size_t getRowCount() const override
+            {
+                return rowCount;
+            }
+
+            tgui::String getCellText(std::size_t row, std::size_t column) const override
+            {
+                return tgui::String::fromNumber(row) + "," + tgui::String::fromNumber(column);
+            }
+
+            tgui::Any getRowData(std::size_t row) const override
+            {
+                return row * 2;
+            }
+
+            std::size_t rowCount = 1000000;
+        };
+
+        listView->addItem("Item");
+        listView->addColumn("Col 1");
+        listView->addColumn("Col 2");
+
+        auto provider = std::make_shared<Provider>();
+        listView->setDataProvider(provider);
+        REQUIRE(listView->getDataProvider() == provider);
+
+        // Items that were added to the list view itself are removed
+        REQUIRE(listView->getItemCount() == 1000000);
+        REQUIRE(listView->getItem(0) == "0,0");
+        REQUIRE(listView->getItemCell(123456, 1) == "123456,1");
+        REQUIRE(listView->getItemCell(123456, 2) == "");
+        REQUIRE(listView->getItemCell(1000000, 0) == "");
+        REQUIRE(listView->getItemRow(999999) == std::vector<tgui::String>{"999999,0", "999999,1"});
+        REQUIRE(listView->getItemData<std::size_t>(50) == 100);
+        REQUIRE(!listView->getItemIcon(50).getData());
+
+        // Selecting many items doesn't require storing every index
+        listView->setMultiSelect(true);
+        listView->setSelectedItemRange(10, 899999);
+        REQUIRE(listView->getSelectedItemIndex() == 10);
+        REQUIRE(listView->getSelectedItemRanges() == std::vector<std::pair<std::size_t, std::size_t>>{{10, 899999}});
+
+        // Items that no longer exist are deselected
+        provider->rowCount = 500;
+        listView->updateFromDataProvider();
+        REQUIRE(listView->getItemCount() == 500);
+        REQUIRE(listView->getSelectedItemRanges() == std::vector<std::pair<std::size_t, std::size_t>>{{10, 499}});
+
+        provider->rowCount = 5;
+        listView->updateFromDataProvider();
+        REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{});
+        REQUIRE(listView->getItemRows() == std::vector<std::vector<tgui::String>>{
+            {"0,0", "0,1"}, {"1,0", "1,1"}, {"2,0", "2,1"}, {"3,0", "3,1"}, {"4,0", "4,1"}});
+
+        listView->removeAllItems();
+        REQUIRE(listView->getDataProvider() == nullptr);
+        REQUIRE(listView->getItemCount() == 0);
+
+        listView->addItem("Item");
+        REQUIRE(listView->getItemCount() == 1);
+    }
+
+    SECTION("Sort order and filter")
+    {
+        const auto waitForSortOrFilter = [&listView]{
+            while (listView->isSortOrFilterPending())
+                static_cast<tgui::Widget&>(*listView).updateTime(std::chrono::milliseconds(1));
+        };
+
+        listView->addColumn("Col 1");
+        listView->addColumn("Col 2");
+        listView->addItem({"C", "1"});
+        listView->addItem({"A", "2"});
+        listView->addItem({"D", "3"});
+        listView->addItem({"B", "4"});
+        REQUIRE(!listView->isSortOrFilterPending());
+        REQUIRE(listView->getDisplayedItemCount() == 4);
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{0, 1, 2, 3});
+
+        listView->setSortOrder(0, [](const tgui::String& a, const tgui::String& b){ return a < b; });
+        waitForSortOrFilter();
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{1, 3, 0, 2});
+
+        // Sorting doesn't change the order of the items themselves
+        REQUIRE(listView->getItem(0) == "C");
+        REQUIRE(listView->getItemCount() == 4);
+
+        // New items are placed at the correct position immediately
+        listView->addItem({"BB", "5"});
+        REQUIRE(!listView->isSortOrFilterPending());
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{1, 3, 4, 0, 2});
+
+        listView->insertItem(0, {"E", "6"});
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{2, 4, 5, 1, 3, 0});
+
+        listView->changeItem(0, {"AA", "6"});
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{2, 0, 4, 5, 1, 3});
+
+        listView->removeItem(4);
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{2, 0, 4, 1, 3});
+
+        listView->setMultiSelect(true);
+        listView->setSelectedItems({0, 1, 2, 3});
+
+        listView->setFilter([](const std::vector<tgui::String>& row){ return row[1] != "3"; });
+        REQUIRE(listView->isSortOrFilterPending());
+        waitForSortOrFilter();
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{2, 0, 4, 1});
+        REQUIRE(listView->getDisplayedItemCount() == 4);
+
+        // Items that are filtered out are deselected
+        REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{0, 1, 2});
+
+        listView->addItem({"F", "3"});
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{2, 0, 4, 1});
+
+        listView->setSortOrder(0, nullptr);
+        waitForSortOrFilter();
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{0, 1, 2, 4});
+
+        listView->setFilter(nullptr);
+        REQUIRE(!listView->isSortOrFilterPending());
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{0, 1, 2, 3, 4, 5});
+
+        // Adding many items at once lets them be sorted in the background
+        listView->setSortOrder(1, [](const tgui::String& a, const tgui::String& b){ return a > b; });
+        std::vector<std::vector<tgui::String>> items;
+        for (unsigned int i = 0; i < 20; ++i)
+            items.push_back({"G", tgui::String(i % 10)});
+        listView->addMultipleItems(items);
+        waitForSortOrFilter();
+
+        const auto indices = listView->getDisplayedItemIndices();
+        REQUIRE(indices.size() == 26);
+        for (std::size_t i = 1; i < indices.size(); ++i)
+            REQUIRE(listView->getItemCell(indices[i-1], 1) >= listView->getItemCell(indices[i], 1));
+
+        // Items that compare equal keep the order in which they were added
+        REQUIRE(indices[0] == 15);
+        REQUIRE(indices[1] == 25);
     }
 
     SECTION("Header height")
@@ -52,6 +52,8 @@ TEST_CASE("[TextArea]")
     {
         textArea->onTextChange([](){});
         textArea->onTextChange([](const tgui::String&){});
+        textArea->onTextEdit([](){});
+        textArea->onTextEdit([](const tgui::TextArea::TextEdit&){});
     }
 
     SECTION("WidgetType")
@@ -235,6 +237,63 @@ TEST_CASE("[TextArea]")
         REQUIRE(textArea->getLinesCount() == 4);
     }
 
+    SECTION("Word-wrap after editing")
+    {
+        // Lines are only recalculated for the paragraphs that were changed, the result should be the same as when setting the text
+        textArea->setSize(165, 100);
+        textArea->setTextSize(24);
+
+        auto referenceTextArea = tgui::TextArea::create();
+        referenceTextArea->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        referenceTextArea->setSize(165, 100);
+        referenceTextArea->setTextSize(24);
+
+        const auto checkLines = [&]{
+            referenceTextArea->setText(textArea->getText());
+            REQUIRE(textArea->getLinesCount() == referenceTextArea->getLinesCount());
+        };
+
+        textArea->setText("First paragraph\nSecond paragraph\n\nFourth one");
+        checkLines();
+
+        textArea->setCaretPosition(5);
+        for (char c : std::string("with a lot of words "))
+        {
+            textArea->textEntered(static_cast<char32_t>(c));
+            checkLines();
+        }
+        REQUIRE(textArea->getText() == "Firstwith a lot of words  paragraph\nSecond paragraph\n\nFourth one");
+        REQUIRE(textArea->getCaretPosition() == 25);
+
+        textArea->textEntered('\n');
+        checkLines();
+        REQUIRE(textArea->getCaretPosition() == 26);
+
+        for (unsigned int i = 0; i < 30; ++i)
+        {
+            textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Backspace, false, false));
+            checkLines();
+        }
+        REQUIRE(textArea->getText() == " paragraph\nSecond paragraph\n\nFourth one");
+        REQUIRE(textArea->getCaretPosition() == 0);
+
+        textArea->setSelectedText(8, 20);
+        textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Delete, false, false));
+        checkLines();
+        REQUIRE(textArea->getText() == " paragraragraph\n\nFourth one");
+
+        textArea->addText(" and some more text behind the last paragraph");
+        checkLines();
+        REQUIRE(textArea->getCaretPosition() == textArea->getText().length());
+
+        textArea->setHorizontalScrollbarPolicy(tgui::Scrollbar::Policy::Automatic);
+        textArea->setCaretPosition(3);
+        textArea->textEntered('\n');
+        REQUIRE(textArea->getLinesCount() == 4);
+        textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Backspace, false, false));
+        REQUIRE(textArea->getLinesCount() == 3);
+    }
+
     SECTION("Events / Signals")
     {
         textArea->setSize(165, 100);
@@ -470,6 +529,46 @@ TEST_CASE("[TextArea]")
             REQUIRE(textArea->getText() == "ABCDEFGHIJKLMNOPQRSTUVWXYZABC");
         }
 
+        SECTION("TextEdited")
+        {
+            std::vector<std::tuple<std::size_t, std::size_t, tgui::String>> edits;
+            textArea->onTextEdit([&](const tgui::TextArea::TextEdit& edit){
+                edits.emplace_back(edit.offset, edit.removedCount, tgui::String(edit.insertedText));
+            });
+
+            textArea->setText("ABC");
+            textArea->textEntered('D');
+            textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Backspace, false, false));
+            textArea->setSelectedText(0, 2);
+            textArea->textEntered('X');
+            textArea->addText("\nEnd");
+
+            REQUIRE(edits.size() == 6);
+            REQUIRE(edits[0] == std::make_tuple(std::size_t(0), std::size_t(0), tgui::String("ABC")));
+            REQUIRE(edits[1] == std::make_tuple(std::size_t(3), std::size_t(0), tgui::String("D")));
+            REQUIRE(edits[2] == std::make_tuple(std::size_t(3), std::size_t(1), tgui::String("")));
+            REQUIRE(edits[3] == std::make_tuple(std::size_t(0), std::size_t(2), tgui::String("")));
+            REQUIRE(edits[4] == std::make_tuple(std::size_t(0), std::size_t(0), tgui::String("X")));
+            REQUIRE(edits[5] == std::make_tuple(std::size_t(2), std::size_t(0), tgui::String("\nEnd")));
+            REQUIRE(textArea->getText() == "XC\nEnd");
+
+            // A character that doesn't fit without a scrollbar isn't reported as an edit
+            textArea->setText("ABCDEFGHIJKLMNOPQRSTUVWXYZAB");
+            textArea->setVerticalScrollbarPolicy(tgui::Scrollbar::Policy::Never);
+            edits.clear();
+
+            textArea->textEntered('C');
+            REQUIRE(textArea->getText() == "ABCDEFGHIJKLMNOPQRSTUVWXYZAB");
+            REQUIRE(edits.empty());
+
+            textArea->setSelectedText(26, 28);
+            textArea->textEntered('C');
+            REQUIRE(textArea->getText() == "ABCDEFGHIJKLMNOPQRSTUVWXYZC");
+            REQUIRE(edits.size() == 2);
+            REQUIRE(edits[0] == std::make_tuple(std::size_t(26), std::size_t(2), tgui::String("")));
+            REQUIRE(edits[1] == std::make_tuple(std::size_t(26), std::size_t(0), tgui::String("C")));
+        }
+
         // TODO: TextChanged and SelectionChanged events
     }
 